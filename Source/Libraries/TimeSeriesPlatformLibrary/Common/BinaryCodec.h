@@ -0,0 +1,314 @@
+//******************************************************************************************************
+//  BinaryCodec.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __BINARY_CODEC_H
+#define __BINARY_CODEC_H
+
+#include "CommonTypes.h"
+#include <cstring>
+#include <stdexcept>
+
+#ifdef _MSC_VER
+#include <stdlib.h>
+#endif
+
+namespace GSF
+{
+    // Unsigned integer type with the same size as the values it holds the bits of.
+    template<size_t Size> struct UnsignedBits;
+    template<> struct UnsignedBits<1> { typedef uint8_t Type; };
+    template<> struct UnsignedBits<2> { typedef uint16_t Type; };
+    template<> struct UnsignedBits<4> { typedef uint32_t Type; };
+    template<> struct UnsignedBits<8> { typedef uint64_t Type; };
+
+    // Loads and stores values at unaligned positions in a given byte order.
+    //
+    // Unlike the EndianConverter, the native byte order is resolved at compile time and values
+    // are copied with memcpy rather than dereferenced through cast pointers, so each load or
+    // store compiles down to a single move plus, where needed, a byte swap instruction.
+    class ByteOrder
+    {
+    private:
+        static uint8_t Swap(uint8_t value) { return value; }
+
+        static uint16_t Swap(uint16_t value)
+        {
+#ifdef _MSC_VER
+            return _byteswap_ushort(value);
+#else
+            return __builtin_bswap16(value);
+#endif
+        }
+
+        static uint32_t Swap(uint32_t value)
+        {
+#ifdef _MSC_VER
+            return _byteswap_ulong(value);
+#else
+            return __builtin_bswap32(value);
+#endif
+        }
+
+        static uint64_t Swap(uint64_t value)
+        {
+#ifdef _MSC_VER
+            return _byteswap_uint64(value);
+#else
+            return __builtin_bswap64(value);
+#endif
+        }
+
+        template<class T>
+        static T Load(const uint8_t* source, bool swap)
+        {
+            typename UnsignedBits<sizeof(T)>::Type bits;
+            T value;
+
+            memcpy(&bits, source, sizeof(T));
+
+            if (swap)
+                bits = Swap(bits);
+
+            memcpy(&value, &bits, sizeof(T));
+            return value;
+        }
+
+        template<class T>
+        static void Store(uint8_t* target, T value, bool swap)
+        {
+            typename UnsignedBits<sizeof(T)>::Type bits;
+
+            memcpy(&bits, &value, sizeof(T));
+
+            if (swap)
+                bits = Swap(bits);
+
+            memcpy(target, &bits, sizeof(T));
+        }
+
+    public:
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        static const bool NativeBigEndian = true;
+#else
+        static const bool NativeBigEndian = false;
+#endif
+
+        template<class T>
+        static T LoadBigEndian(const uint8_t* source)
+        {
+            return Load<T>(source, !NativeBigEndian);
+        }
+
+        template<class T>
+        static T LoadLittleEndian(const uint8_t* source)
+        {
+            return Load<T>(source, NativeBigEndian);
+        }
+
+        template<class T>
+        static void StoreBigEndian(uint8_t* target, T value)
+        {
+            Store(target, value, !NativeBigEndian);
+        }
+
+        template<class T>
+        static void StoreLittleEndian(uint8_t* target, T value)
+        {
+            Store(target, value, NativeBigEndian);
+        }
+    };
+
+    // Writes binary values into a preallocated span of bytes.
+    //
+    // The writer never allocates: the caller sizes the buffer up front and the writer fills it
+    // in place. Writing past the end of the span throws std::out_of_range.
+    class BinaryWriter
+    {
+    private:
+        uint8_t* m_data;
+        uint32_t m_position;
+        uint32_t m_endPosition;
+
+        void EnsureSpace(uint32_t count) const
+        {
+            if (m_endPosition - m_position < count)
+                throw std::out_of_range("Not enough space left in the binary writer buffer");
+        }
+
+    public:
+        // Creates a writer for the given number of bytes starting at the offset in the data.
+        BinaryWriter(uint8_t* data, uint32_t offset, uint32_t length) :
+            m_data(data),
+            m_position(offset),
+            m_endPosition(offset + length)
+        {
+        }
+
+        // Creates a writer for the bytes of the buffer from the offset to its current size.
+        BinaryWriter(std::vector<uint8_t>& buffer, uint32_t offset = 0) :
+            BinaryWriter(buffer.data(), offset, static_cast<uint32_t>(buffer.size()) - offset)
+        {
+        }
+
+        // Gets the position within the data at which the next value will be written.
+        uint32_t Position() const { return m_position; }
+
+        // Gets the number of bytes that can still be written.
+        uint32_t Remaining() const { return m_endPosition - m_position; }
+
+        // Skips over the given number of bytes, e.g., to leave room for a header.
+        void Skip(uint32_t count)
+        {
+            EnsureSpace(count);
+            m_position += count;
+        }
+
+        void WriteByte(uint8_t value)
+        {
+            EnsureSpace(1);
+            m_data[m_position++] = value;
+        }
+
+        template<class T>
+        void WriteBigEndian(T value)
+        {
+            EnsureSpace(sizeof(T));
+            ByteOrder::StoreBigEndian(m_data + m_position, value);
+            m_position += sizeof(T);
+        }
+
+        template<class T>
+        void WriteLittleEndian(T value)
+        {
+            EnsureSpace(sizeof(T));
+            ByteOrder::StoreLittleEndian(m_data + m_position, value);
+            m_position += sizeof(T);
+        }
+
+        void WriteBytes(const void* source, uint32_t count)
+        {
+            EnsureSpace(count);
+
+            if (count > 0)
+                memcpy(m_data + m_position, source, count);
+
+            m_position += count;
+        }
+
+        void WriteBytes(const std::vector<uint8_t>& source)
+        {
+            WriteBytes(source.data(), static_cast<uint32_t>(source.size()));
+        }
+
+        void WriteGuid(const Guid& value)
+        {
+            WriteBytes(value.data, 16);
+        }
+    };
+
+    // Reads binary values from a span of bytes.
+    //
+    // Values are loaded with memcpy, so there are no alignment requirements on the data.
+    // Reading past the end of the span throws std::out_of_range.
+    class BinaryReader
+    {
+    private:
+        const uint8_t* m_data;
+        uint32_t m_position;
+        uint32_t m_endPosition;
+
+        void EnsureAvailable(uint32_t count) const
+        {
+            if (m_endPosition - m_position < count)
+                throw std::out_of_range("Not enough data left in the binary reader buffer");
+        }
+
+    public:
+        // Creates a reader for the given number of bytes starting at the offset in the data.
+        BinaryReader(const uint8_t* data, uint32_t offset, uint32_t length) :
+            m_data(data),
+            m_position(offset),
+            m_endPosition(offset + length)
+        {
+        }
+
+        // Creates a reader for all the bytes in the buffer.
+        BinaryReader(const std::vector<uint8_t>& buffer) :
+            BinaryReader(buffer.data(), 0, static_cast<uint32_t>(buffer.size()))
+        {
+        }
+
+        // Gets the position within the data of the next value to be read.
+        uint32_t Position() const { return m_position; }
+
+        // Gets the number of bytes that are left to read.
+        uint32_t Remaining() const { return m_endPosition - m_position; }
+
+        void Skip(uint32_t count)
+        {
+            EnsureAvailable(count);
+            m_position += count;
+        }
+
+        uint8_t ReadByte()
+        {
+            EnsureAvailable(1);
+            return m_data[m_position++];
+        }
+
+        template<class T>
+        T ReadBigEndian()
+        {
+            EnsureAvailable(sizeof(T));
+            const T value = ByteOrder::LoadBigEndian<T>(m_data + m_position);
+            m_position += sizeof(T);
+            return value;
+        }
+
+        template<class T>
+        T ReadLittleEndian()
+        {
+            EnsureAvailable(sizeof(T));
+            const T value = ByteOrder::LoadLittleEndian<T>(m_data + m_position);
+            m_position += sizeof(T);
+            return value;
+        }
+
+        // Reads the given number of bytes, returning a pointer to them within the data.
+        const uint8_t* ReadBytes(uint32_t count)
+        {
+            EnsureAvailable(count);
+            const uint8_t* bytes = m_data + m_position;
+            m_position += count;
+            return bytes;
+        }
+
+        void ReadBytes(void* target, uint32_t count)
+        {
+            if (count > 0)
+                memcpy(target, ReadBytes(count), count);
+        }
+    };
+}
+
+#endif
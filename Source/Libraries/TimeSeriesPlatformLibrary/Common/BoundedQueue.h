@@ -0,0 +1,300 @@
+//******************************************************************************************************
+//  BoundedQueue.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __BOUNDED_QUEUE_H
+#define __BOUNDED_QUEUE_H
+
+#include "CommonTypes.h"
+#include <deque>
+
+namespace GSF
+{
+    // Defines the action taken when an item is added to a full bounded queue.
+    enum class BackpressurePolicy
+    {
+        // Producer waits until the consumer makes room in the queue.
+        Block,
+        // Oldest queued item is discarded to make room for the new item.
+        DropOldest,
+        // New item is discarded, leaving queued items intact.
+        DropNewest
+    };
+
+    // Thread-safe queue with a maximum depth used to connect processing stages.
+    //
+    // The BoundedQueue was designed for a single-producer/single-consumer scenario
+    // where the producer must not outrun the consumer without limit. What happens
+    // when the queue is full is defined by its backpressure policy. Queue depth and
+    // the number of discarded items are tracked for diagnostics.
+    template<class T>
+    class BoundedQueue // NOLINT
+    {
+    private:
+        mutable Mutex m_mutex;
+        WaitHandle m_dataWaitHandle;
+        WaitHandle m_spaceWaitHandle;
+        std::deque<T> m_queue;
+        uint32_t m_capacity;
+        BackpressurePolicy m_policy;
+        uint32_t m_maxDepth;
+        uint64_t m_totalDropped;
+        bool m_release;
+
+    public:
+        // Creates a new instance.
+        BoundedQueue(uint32_t capacity = 1024, BackpressurePolicy policy = BackpressurePolicy::Block);
+
+        // Releases all threads waiting on the queue.
+        ~BoundedQueue();
+
+        // Inserts an item into the queue, applying the backpressure policy when the queue is full.
+        // Returns false if the new item was discarded or the queue was released while waiting.
+        bool Enqueue(T item);
+
+        // Waits for an item to be inserted into the queue and moves it into the
+        // given reference. Returns false if the queue was released while waiting.
+        bool Dequeue(T& item);
+
+        // Removes an item from the queue without waiting, moving it into the given
+        // reference, even once the queue is released. Returns false if the queue is empty.
+        bool TryDequeue(T& item);
+
+        // Empties the queue.
+        void Clear();
+
+        // Returns the number of
+        // items left in the queue.
+        uint32_t Size() const;
+
+        // Gets or sets the maximum number of items the queue can hold.
+        uint32_t GetCapacity() const;
+        void SetCapacity(uint32_t capacity);
+
+        // Gets or sets the action taken when the queue is full.
+        BackpressurePolicy GetPolicy() const;
+        void SetPolicy(BackpressurePolicy policy);
+
+        // Gets the largest number of items held by the queue since the last reset.
+        uint32_t GetMaxDepth() const;
+
+        // Gets the total number of items discarded by the backpressure policy since the last reset.
+        uint64_t GetTotalDropped() const;
+
+        // Releases all threads waiting on the queue.
+        //
+        // Further calls to Enqueue and Dequeue will not wait regardless of
+        // the amount of data in the queue. To make the queue usable again,
+        // call Reset.
+        void Release();
+
+        // Resets the "release valve" and statistics of the queue.
+        void Reset();
+    };
+
+    // Creates a new instance.
+    template<class T>
+    BoundedQueue<T>::BoundedQueue(uint32_t capacity, BackpressurePolicy policy) :
+        m_capacity(capacity > 0 ? capacity : 1),
+        m_policy(policy),
+        m_maxDepth(0),
+        m_totalDropped(0UL),
+        m_release(false)
+    {
+    }
+
+    // Releases all threads waiting on the queue.
+    template<class T>
+    BoundedQueue<T>::~BoundedQueue()
+    {
+        Release();
+    }
+
+    // Inserts an item into the queue, applying the backpressure policy when the queue is full.
+    template<class T>
+    bool BoundedQueue<T>::Enqueue(T item)
+    {
+        UniqueLock lock(m_mutex);
+
+        if (m_queue.size() >= m_capacity)
+        {
+            switch (m_policy)
+            {
+                case BackpressurePolicy::Block:
+                    while (m_queue.size() >= m_capacity && !m_release)
+                        m_spaceWaitHandle.wait(lock);
+
+                    if (m_release)
+                        return false;
+
+                    break;
+                case BackpressurePolicy::DropOldest:
+                    while (m_queue.size() >= m_capacity)
+                    {
+                        m_queue.pop_front();
+                        m_totalDropped++;
+                    }
+                    break;
+                case BackpressurePolicy::DropNewest:
+                    m_totalDropped++;
+                    return false;
+            }
+        }
+
+        m_queue.push_back(std::move(item));
+
+        if (m_queue.size() > m_maxDepth)
+            m_maxDepth = static_cast<uint32_t>(m_queue.size());
+
+        m_dataWaitHandle.notify_one();
+        return true;
+    }
+
+    // Waits for an item to be inserted into the queue and moves it into the given reference.
+    template<class T>
+    bool BoundedQueue<T>::Dequeue(T& item)
+    {
+        UniqueLock lock(m_mutex);
+
+        while (m_queue.empty() && !m_release)
+            m_dataWaitHandle.wait(lock);
+
+        if (m_release)
+            return false;
+
+        item = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_spaceWaitHandle.notify_one();
+
+        return true;
+    }
+
+    // Removes an item from the queue without waiting.
+    template<class T>
+    bool BoundedQueue<T>::TryDequeue(T& item)
+    {
+        ScopeLock lock(m_mutex);
+
+        if (m_queue.empty())
+            return false;
+
+        item = std::move(m_queue.front());
+        m_queue.pop_front();
+        m_spaceWaitHandle.notify_one();
+
+        return true;
+    }
+
+    // Empties the queue.
+    template<class T>
+    void BoundedQueue<T>::Clear()
+    {
+        ScopeLock lock(m_mutex);
+        m_queue.clear();
+        m_spaceWaitHandle.notify_all();
+    }
+
+    // Returns the number of
+    // items left in the queue.
+    template<class T>
+    uint32_t BoundedQueue<T>::Size() const
+    {
+        ScopeLock lock(m_mutex);
+        return static_cast<uint32_t>(m_queue.size());
+    }
+
+    // Gets the maximum number of items the queue can hold.
+    template<class T>
+    uint32_t BoundedQueue<T>::GetCapacity() const
+    {
+        ScopeLock lock(m_mutex);
+        return m_capacity;
+    }
+
+    // Sets the maximum number of items the queue can hold.
+    template<class T>
+    void BoundedQueue<T>::SetCapacity(uint32_t capacity)
+    {
+        ScopeLock lock(m_mutex);
+        m_capacity = capacity > 0 ? capacity : 1;
+        m_spaceWaitHandle.notify_all();
+    }
+
+    // Gets the action taken when the queue is full.
+    template<class T>
+    BackpressurePolicy BoundedQueue<T>::GetPolicy() const
+    {
+        ScopeLock lock(m_mutex);
+        return m_policy;
+    }
+
+    // Sets the action taken when the queue is full.
+    template<class T>
+    void BoundedQueue<T>::SetPolicy(BackpressurePolicy policy)
+    {
+        ScopeLock lock(m_mutex);
+        m_policy = policy;
+        m_spaceWaitHandle.notify_all();
+    }
+
+    // Gets the largest number of items held by the queue since the last reset.
+    template<class T>
+    uint32_t BoundedQueue<T>::GetMaxDepth() const
+    {
+        ScopeLock lock(m_mutex);
+        return m_maxDepth;
+    }
+
+    // Gets the total number of items discarded by the backpressure policy since the last reset.
+    template<class T>
+    uint64_t BoundedQueue<T>::GetTotalDropped() const
+    {
+        ScopeLock lock(m_mutex);
+        return m_totalDropped;
+    }
+
+    // Releases all threads waiting on the queue.
+    template<class T>
+    void BoundedQueue<T>::Release()
+    {
+        ScopeLock lock(m_mutex);
+
+        m_release = true;
+        m_dataWaitHandle.notify_all();
+        m_spaceWaitHandle.notify_all();
+    }
+
+    // Resets the "release valve" and statistics of the queue.
+    // This can be called after Release so that the queue can
+    // be used again.
+    template<class T>
+    void BoundedQueue<T>::Reset()
+    {
+        ScopeLock lock(m_mutex);
+
+        m_release = false;
+        m_maxDepth = 0;
+        m_totalDropped = 0UL;
+    }
+}
+
+#endif
@@ -18,6 +18,9 @@
 //  ----------------------------------------------------------------------------------------------------
 //  03/09/2012 - Stephen C. Wills
 //       Generated original version of source code.
+//  10/15/2026 - GSF Development Team
+//       WriteBytes functions now append with bulk copies.
+//       Added UdpEndPoint type.
 //
 //******************************************************************************************************
 
@@ -177,12 +180,16 @@ namespace GSF
     typedef boost::condition_variable WaitHandle;
     typedef boost::lock_guard<Mutex> ScopeLock;
     typedef boost::unique_lock<Mutex> UniqueLock;
+    typedef boost::shared_mutex SharedMutex;
+    typedef boost::shared_lock<SharedMutex> SharedLock;
+    typedef boost::lock_guard<SharedMutex> ExclusiveLock;
     typedef boost::asio::io_context IOContext;
     typedef boost::asio::ip::address IPAddress;
     typedef boost::asio::ip::tcp::socket TcpSocket;
     typedef boost::asio::ip::udp::socket UdpSocket;
     typedef boost::asio::ip::tcp::acceptor TcpAcceptor;
     typedef boost::asio::ip::tcp::endpoint TcpEndPoint;
+    typedef boost::asio::ip::udp::endpoint UdpEndPoint;
     typedef boost::asio::ip::tcp::resolver DnsResolver;
     typedef boost::iostreams::filtering_streambuf<boost::iostreams::input> StreamBuffer;
     typedef boost::iostreams::gzip_decompressor GZipDecompressor;
@@ -315,16 +322,14 @@ namespace GSF
         static const int32_t length = sizeof(T);
         const uint8_t* bytes = reinterpret_cast<const uint8_t*>(&value);
 
-        for (int32_t i = 0; i < length; i++)
-            buffer.push_back(bytes[i]);
+        buffer.insert(buffer.end(), bytes, bytes + length);
 
         return length;
     }
 
     static uint32_t WriteBytes(std::vector<uint8_t>& buffer, const uint8_t* source, const uint32_t offset, const uint32_t length)
     {
-        for (uint32_t i = 0; i < length; i++)
-            buffer.push_back(source[offset + i]);
+        buffer.insert(buffer.end(), source + offset, source + offset + length);
 
         return length;
     }
@@ -333,8 +338,7 @@ namespace GSF
     {
         const uint32_t length = source.size();
 
-        for (uint32_t i = 0; i < length; i++)
-            buffer.push_back(source[i]);
+        buffer.insert(buffer.end(), source.begin(), source.end());
 
         return length;
     }
@@ -343,8 +347,7 @@ namespace GSF
     {
         const uint8_t* bytes = value.data;
 
-        for (uint32_t i = 0; i < 16; i++)
-            buffer.push_back(bytes[i]);
+        buffer.insert(buffer.end(), bytes, bytes + 16);
 
         return 16;
     }
@@ -20,6 +20,8 @@
 //       Generated original version of source code.
 //  01/26/2019 - J. Ritchie Carroll
 //      Added static converters for buffers that use default instance.
+//  10/15/2026 - GSF Development Team
+//       Buffer converters now copy values so that reads from unaligned positions are safe.
 //
 //******************************************************************************************************
 
@@ -27,6 +29,7 @@
 #define __ENDIAN_CONVERTER_H
 
 #include "CommonTypes.h"
+#include <cstring>
 
 namespace GSF
 {
@@ -85,13 +88,17 @@ namespace GSF
         template<class T>
         static T ToBigEndian(const uint8_t* buffer, const uint32_t startIndex)
         {
-            return Default.ConvertBigEndian(*reinterpret_cast<T*>(const_cast<uint8_t*>(buffer + startIndex)));
+            T value;
+            memcpy(&value, buffer + startIndex, sizeof(T));
+            return Default.ConvertBigEndian(value);
         }
 
         template<class T>
         static T ToLittleEndian(const uint8_t* buffer, const uint32_t startIndex)
         {
-            return Default.ConvertLittleEndian(*reinterpret_cast<T*>(const_cast<uint8_t*>(buffer + startIndex)));
+            T value;
+            memcpy(&value, buffer + startIndex, sizeof(T));
+            return Default.ConvertLittleEndian(value);
         }
 
         template<class T>
@@ -0,0 +1,159 @@
+//******************************************************************************************************
+//  LatencyHistogram.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "LatencyHistogram.h"
+#include <cmath>
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif
+
+using namespace std;
+using namespace GSF;
+
+LatencyHistogramSnapshot::LatencyHistogramSnapshot() :
+    Count(0UL),
+    Mean(0.0),
+    P50(0L),
+    P99(0L),
+    P999(0L),
+    Max(0L)
+{
+}
+
+LatencyHistogram::LatencyHistogram()
+{
+    Reset();
+}
+
+// Values below twice the sub-bucket count each have their own bucket, larger values share a
+// bucket with the other values that have the same most significant bits.
+uint32_t LatencyHistogram::GetBucketIndex(int64_t value)
+{
+    const uint64_t bits = static_cast<uint64_t>(value);
+
+    if (bits < SubBucketCount)
+        return static_cast<uint32_t>(bits);
+
+#ifdef _MSC_VER
+    unsigned long msb;
+    _BitScanReverse64(&msb, bits);
+#else
+    const uint32_t msb = 63 - __builtin_clzll(bits);
+#endif
+
+    const uint32_t shift = msb - SubBucketBits;
+    const uint32_t subBucket = static_cast<uint32_t>(bits >> shift) - SubBucketCount;
+
+    return (shift + 1) * SubBucketCount + subBucket;
+}
+
+// Gets the largest value that is recorded in the given bucket.
+int64_t LatencyHistogram::GetBucketUpperBound(uint32_t index)
+{
+    if (index < SubBucketCount * 2)
+        return index;
+
+    const uint32_t shift = index / SubBucketCount - 1;
+    const uint64_t top = SubBucketCount + index % SubBucketCount;
+
+    return static_cast<int64_t>(((top + 1) << shift) - 1);
+}
+
+// Records the given value the specified number of times.
+void LatencyHistogram::Record(int64_t value, uint64_t count)
+{
+    if (value < 0L)
+        value = 0L;
+
+    m_counts[GetBucketIndex(value)].fetch_add(count, memory_order_relaxed);
+    m_totalCount.fetch_add(count, memory_order_relaxed);
+    m_totalValue.fetch_add(value * static_cast<int64_t>(count), memory_order_relaxed);
+
+    int64_t max = m_max.load(memory_order_relaxed);
+
+    while (value > max && !m_max.compare_exchange_weak(max, value, memory_order_relaxed))
+    {
+    }
+}
+
+// Gets the summary of the values recorded so far.
+LatencyHistogramSnapshot LatencyHistogram::GetSnapshot() const
+{
+    const float64_t Percentiles[] = { 0.5, 0.99, 0.999 };
+    int64_t* results[3];
+
+    LatencyHistogramSnapshot snapshot;
+    vector<uint64_t> counts(BucketCount);
+
+    results[0] = &snapshot.P50;
+    results[1] = &snapshot.P99;
+    results[2] = &snapshot.P999;
+
+    // Take a copy of the counts so that all percentiles
+    // are calculated from the same set of values
+    for (uint32_t i = 0; i < BucketCount; i++)
+    {
+        counts[i] = m_counts[i].load(memory_order_relaxed);
+        snapshot.Count += counts[i];
+    }
+
+    if (snapshot.Count == 0UL)
+        return snapshot;
+
+    snapshot.Max = m_max.load(memory_order_relaxed);
+    snapshot.Mean = static_cast<float64_t>(m_totalValue.load(memory_order_relaxed)) / static_cast<float64_t>(max(m_totalCount.load(memory_order_relaxed), static_cast<uint64_t>(1UL)));
+
+    uint32_t index = 0;
+    uint64_t cumulativeCount = counts[0];
+
+    for (uint32_t i = 0; i < 3; i++)
+    {
+        const uint64_t rank = max(static_cast<uint64_t>(ceil(Percentiles[i] * snapshot.Count)), static_cast<uint64_t>(1UL));
+
+        while (cumulativeCount < rank && index < BucketCount - 1)
+            cumulativeCount += counts[++index];
+
+        // Bucket bound can be past the largest value actually recorded
+        *results[i] = min(GetBucketUpperBound(index), snapshot.Max);
+    }
+
+    return snapshot;
+}
+
+// Gets the total number of values recorded.
+uint64_t LatencyHistogram::GetCount() const
+{
+    return m_totalCount.load(memory_order_relaxed);
+}
+
+// Removes all recorded values.
+void LatencyHistogram::Reset()
+{
+    for (uint32_t i = 0; i < BucketCount; i++)
+        m_counts[i].store(0UL, memory_order_relaxed);
+
+    m_totalCount.store(0UL, memory_order_relaxed);
+    m_totalValue.store(0L, memory_order_relaxed);
+    m_max.store(0L, memory_order_relaxed);
+}
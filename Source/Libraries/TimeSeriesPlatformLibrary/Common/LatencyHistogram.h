@@ -0,0 +1,87 @@
+//******************************************************************************************************
+//  LatencyHistogram.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __LATENCY_HISTOGRAM_H
+#define __LATENCY_HISTOGRAM_H
+
+#include "CommonTypes.h"
+#include <atomic>
+
+namespace GSF
+{
+    // Summary of the values recorded by a latency histogram at a point in time.
+    struct LatencyHistogramSnapshot
+    {
+        uint64_t Count;
+        float64_t Mean;
+        int64_t P50;
+        int64_t P99;
+        int64_t P999;
+        int64_t Max;
+
+        LatencyHistogramSnapshot();
+    };
+
+    // Histogram of non-negative latency values with log-linear buckets.
+    //
+    // Each power of two range is split into a fixed number of equal width buckets, so
+    // the bucket count is constant regardless of the range of values recorded and each
+    // reported percentile is within about six percent of the actual value. Recording
+    // a value only increments counters without locking, so values can be recorded from
+    // any number of threads while another thread takes snapshots. Negative values, e.g.,
+    // caused by clock differences between systems, are recorded as zero.
+    class LatencyHistogram // NOLINT
+    {
+    private:
+        static const uint32_t SubBucketBits = 4;
+        static const uint32_t SubBucketCount = 1U << SubBucketBits;
+        static const uint32_t BucketCount = (64 - SubBucketBits) * SubBucketCount;
+
+        std::atomic<uint64_t> m_counts[BucketCount];
+        std::atomic<uint64_t> m_totalCount;
+        std::atomic<int64_t> m_totalValue;
+        std::atomic<int64_t> m_max;
+
+        static uint32_t GetBucketIndex(int64_t value);
+        static int64_t GetBucketUpperBound(uint32_t index);
+
+    public:
+        // Creates a new empty histogram.
+        LatencyHistogram();
+
+        // Records the given value the specified number of times.
+        void Record(int64_t value, uint64_t count = 1UL);
+
+        // Gets the summary of the values recorded so far.
+        LatencyHistogramSnapshot GetSnapshot() const;
+
+        // Gets the total number of values recorded.
+        uint64_t GetCount() const;
+
+        // Removes all recorded values. Values recorded while
+        // the histogram is being reset may be partially counted.
+        void Reset();
+    };
+}
+
+#endif
@@ -0,0 +1,277 @@
+//******************************************************************************************************
+//  ObjectPool.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __OBJECT_POOL_H
+#define __OBJECT_POOL_H
+
+#include "CommonTypes.h"
+
+namespace GSF
+{
+    // Recycling pool of shared objects.
+    //
+    // Objects are handed out as shared pointers whose deleter returns the object to the
+    // free list of the pool once all references have been released, so consumers never
+    // need to give anything back explicitly. The free list is locked, which hands each
+    // released object over from the releasing thread to the next acquiring thread with
+    // release/acquire ordering. Reference count blocks are recycled through the pool as
+    // well, so no heap allocations occur once the pool has grown to cover the working set.
+    //
+    // Objects can be acquired and released from any thread. The pool keeps at most the
+    // given number of released objects, any others are freed, so a burst of activity does
+    // not hold on to memory for the life of the pool. Objects still referenced when the
+    // pool is destroyed are freed when they are released.
+    template<class T>
+    class ObjectPool // NOLINT
+    {
+    private:
+        // State shared with the references handed out by the pool
+        struct PoolState
+        {
+            Mutex Lock;
+            std::vector<T*> FreeItems;
+            std::vector<void*> FreeBlocks;
+            size_t MaxFreeCount;
+            uint64_t TotalAllocations;
+            uint64_t TotalAcquisitions;
+
+            PoolState(size_t maxFreeCount);
+            ~PoolState();
+        };
+
+        typedef SharedPtr<PoolState> PoolStatePtr;
+
+        // Deleter that returns a released object to the free list
+        struct ItemReleaser
+        {
+            PoolStatePtr State;
+
+            ItemReleaser(const PoolStatePtr& state);
+            void operator()(T* item) const;
+        };
+
+        // Allocator that recycles the reference count blocks of the handed out objects,
+        // every block of a pool holds the same type so any free block fits
+        template<class U>
+        struct BlockAllocator
+        {
+            typedef U value_type;
+
+            PoolStatePtr State;
+
+            BlockAllocator(const PoolStatePtr& state);
+
+            template<class V>
+            BlockAllocator(const BlockAllocator<V>& other);
+
+            U* allocate(size_t count);
+            void deallocate(U* block, size_t count);
+
+            template<class V>
+            bool operator==(const BlockAllocator<V>& other) const { return State == other.State; }
+
+            template<class V>
+            bool operator!=(const BlockAllocator<V>& other) const { return State != other.State; }
+        };
+
+        PoolStatePtr m_state;
+
+    public:
+        // Creates a new instance with the given number of preallocated objects that
+        // keeps at most the given number of released objects for reuse.
+        ObjectPool(size_t initialSize = 0, size_t maxFreeCount = SIZE_MAX);
+
+        // Gets a released object, or a new object when none are free.
+        SharedPtr<T> Acquire();
+
+        // Gets the number of released objects held for reuse.
+        size_t Size() const;
+
+        // Gets the total number of objects allocated by the pool.
+        uint64_t GetTotalAllocations() const;
+
+        // Gets the total number of objects handed out by the pool.
+        uint64_t GetTotalAcquisitions() const;
+    };
+
+    template<class T>
+    ObjectPool<T>::PoolState::PoolState(size_t maxFreeCount) :
+        MaxFreeCount(maxFreeCount),
+        TotalAllocations(0UL),
+        TotalAcquisitions(0UL)
+    {
+    }
+
+    template<class T>
+    ObjectPool<T>::PoolState::~PoolState()
+    {
+        for (T* item : FreeItems)
+            delete item;
+
+        for (void* block : FreeBlocks)
+            ::operator delete(block);
+    }
+
+    template<class T>
+    ObjectPool<T>::ItemReleaser::ItemReleaser(const PoolStatePtr& state) :
+        State(state)
+    {
+    }
+
+    template<class T>
+    void ObjectPool<T>::ItemReleaser::operator()(T* item) const
+    {
+        {
+            ScopeLock lock(State->Lock);
+
+            if (State->FreeItems.size() < State->MaxFreeCount)
+            {
+                State->FreeItems.push_back(item);
+                return;
+            }
+        }
+
+        delete item;
+    }
+
+    template<class T>
+    template<class U>
+    ObjectPool<T>::BlockAllocator<U>::BlockAllocator(const PoolStatePtr& state) :
+        State(state)
+    {
+    }
+
+    template<class T>
+    template<class U>
+    template<class V>
+    ObjectPool<T>::BlockAllocator<U>::BlockAllocator(const BlockAllocator<V>& other) :
+        State(other.State)
+    {
+    }
+
+    template<class T>
+    template<class U>
+    U* ObjectPool<T>::BlockAllocator<U>::allocate(size_t count)
+    {
+        if (count == 1)
+        {
+            ScopeLock lock(State->Lock);
+
+            if (!State->FreeBlocks.empty())
+            {
+                void* block = State->FreeBlocks.back();
+                State->FreeBlocks.pop_back();
+                return static_cast<U*>(block);
+            }
+        }
+
+        return static_cast<U*>(::operator new(count * sizeof(U)));
+    }
+
+    template<class T>
+    template<class U>
+    void ObjectPool<T>::BlockAllocator<U>::deallocate(U* block, size_t count)
+    {
+        if (count == 1)
+        {
+            ScopeLock lock(State->Lock);
+
+            if (State->FreeBlocks.size() < State->MaxFreeCount)
+            {
+                State->FreeBlocks.push_back(block);
+                return;
+            }
+        }
+
+        ::operator delete(block);
+    }
+
+    // Creates a new instance with the given number of preallocated objects that
+    // keeps at most the given number of released objects for reuse.
+    template<class T>
+    ObjectPool<T>::ObjectPool(size_t initialSize, size_t maxFreeCount) :
+        m_state(NewSharedPtr<PoolState>(maxFreeCount))
+    {
+        m_state->FreeItems.reserve(initialSize);
+
+        for (size_t i = 0; i < initialSize; i++)
+            m_state->FreeItems.push_back(new T());
+
+        m_state->TotalAllocations = initialSize;
+    }
+
+    // Gets a released object, or a new object when none are free.
+    template<class T>
+    SharedPtr<T> ObjectPool<T>::Acquire()
+    {
+        T* item = nullptr;
+
+        {
+            ScopeLock lock(m_state->Lock);
+
+            if (!m_state->FreeItems.empty())
+            {
+                item = m_state->FreeItems.back();
+                m_state->FreeItems.pop_back();
+            }
+            else
+            {
+                m_state->TotalAllocations++;
+            }
+
+            m_state->TotalAcquisitions++;
+        }
+
+        if (item == nullptr)
+            item = new T();
+
+        // Should the reference count block fail to allocate, the releaser returns the object
+        return SharedPtr<T>(item, ItemReleaser(m_state), BlockAllocator<T>(m_state));
+    }
+
+    // Gets the number of released objects held for reuse.
+    template<class T>
+    size_t ObjectPool<T>::Size() const
+    {
+        ScopeLock lock(m_state->Lock);
+        return m_state->FreeItems.size();
+    }
+
+    // Gets the total number of objects allocated by the pool.
+    template<class T>
+    uint64_t ObjectPool<T>::GetTotalAllocations() const
+    {
+        ScopeLock lock(m_state->Lock);
+        return m_state->TotalAllocations;
+    }
+
+    // Gets the total number of objects handed out by the pool.
+    template<class T>
+    uint64_t ObjectPool<T>::GetTotalAcquisitions() const
+    {
+        ScopeLock lock(m_state->Lock);
+        return m_state->TotalAcquisitions;
+    }
+}
+
+#endif
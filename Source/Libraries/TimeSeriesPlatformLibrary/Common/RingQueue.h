@@ -0,0 +1,529 @@
+//******************************************************************************************************
+//  RingQueue.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __RING_QUEUE_H
+#define __RING_QUEUE_H
+
+#include "CommonTypes.h"
+#include <atomic>
+#include <deque>
+#include <memory>
+
+namespace GSF
+{
+    // Bounded lock-free ring queue used to hand items to a single consumer thread.
+    //
+    // Each slot in the ring carries a sequence number that tells producers and the
+    // consumer whether the slot is free or holds a published item, so items change
+    // hands without taking a lock (see Dmitry Vyukov's bounded MPMC queue). When
+    // only one thread ever enqueues, set MultiProducer to false to replace the
+    // compare-and-swap on the enqueue position with a plain store.
+    //
+    // Threads that find the queue empty or full spin briefly before parking on a
+    // wait handle. The mutex is only taken to park or to wake a parked thread, so
+    // a busy queue never locks. Capacity is rounded up to a power of two.
+    //
+    // Producers that must never wait, e.g., socket threads handing off callbacks, can
+    // use EnqueueUnbounded. When the ring is full, its items are held in a growable
+    // overflow list behind the ring until the consumer catches up.
+    //
+    // The use of multiple consumers may cause undesired effects.
+    template<class T, bool MultiProducer = true>
+    class RingQueue // NOLINT
+    {
+    private:
+        struct Slot
+        {
+            std::atomic<size_t> Sequence;
+            T Item;
+        };
+
+        static const uint32_t SpinCount = 256;
+        static const uint32_t CacheLineSize = 64;
+
+        std::unique_ptr<Slot[]> m_slots;
+        size_t m_mask;
+
+        // Producer and consumer positions are kept on
+        // separate cache lines to avoid false sharing
+        uint8_t m_padding0[CacheLineSize];
+        std::atomic<size_t> m_enqueuePosition;
+        uint8_t m_padding1[CacheLineSize - sizeof(std::atomic<size_t>)];
+        std::atomic<size_t> m_dequeuePosition;
+        uint8_t m_padding2[CacheLineSize - sizeof(std::atomic<size_t>)];
+
+        std::atomic<bool> m_release;
+        std::atomic<bool> m_consumerParked;
+        std::atomic<uint32_t> m_parkedProducers;
+        std::atomic<uint32_t> m_overflowCount;
+        std::deque<T> m_overflow;
+        Mutex m_mutex;
+        WaitHandle m_dataWaitHandle;
+        WaitHandle m_spaceWaitHandle;
+
+        bool TryPush(T& item);
+        bool TryPop(T& item);
+        bool TryPopOverflow(T& item);
+        bool IsEmpty() const;
+        void NotifyConsumer();
+        void NotifyProducers();
+
+    public:
+        // Creates a new instance that can hold at least the given number of items.
+        RingQueue(uint32_t capacity = 4096);
+
+        // Releases all threads waiting on the queue.
+        ~RingQueue();
+
+        // Inserts an item into the queue, waiting for space if the queue is full. Item is moved
+        // into the queue, pass an rvalue to avoid copying it. Returns false if the queue was
+        // released while waiting for space.
+        bool Enqueue(T item);
+
+        // Inserts an item into the queue if there is space for it. Item is only
+        // moved from when the method succeeds.
+        bool TryEnqueue(T& item);
+
+        // Inserts an item into the queue without waiting. When the ring is full the item is
+        // held in the overflow list, as are all items that follow until the list is emptied,
+        // so the items of each producer stay in order. Returns false if the queue was released.
+        bool EnqueueUnbounded(T item);
+
+        // Removes an item from the queue without waiting, moving it
+        // into the given reference. Returns false if the queue is empty.
+        bool TryDequeue(T& item);
+
+        // Moves all items currently in the queue to the end of the given vector without waiting.
+        // Returns the number of items moved.
+        uint32_t TryDequeueAll(std::vector<T>& items);
+
+        // Waits for data and then moves up to maxCount items to the end of the given vector.
+        // Returns the number of items moved, which is zero when the queue was released.
+        uint32_t DequeueBulk(std::vector<T>& items, uint32_t maxCount = UInt32::MaxValue);
+
+        // Empties the queue.
+        //
+        // Since this removes items on behalf of the consumer,
+        // it should only be called by the consumer thread or
+        // once the consumer thread has been stopped.
+        void Clear();
+
+        // Returns the number of
+        // items left in the queue.
+        uint32_t Size() const;
+
+        // Gets the maximum number of items the ring can hold.
+        uint32_t GetCapacity() const;
+
+        // Gets the number of items held in the overflow list.
+        uint32_t GetOverflowSize() const;
+
+        // Waits for data to be inserted into the queue.
+        // If there is already data in the queue,
+        // this method will not wait.
+        //
+        // Since the queue was designed for only a single consumer,
+        // calling this method from multiple threads may have undesired effects.
+        void WaitForData();
+
+        // Releases all threads waiting on the queue.
+        //
+        // Further calls to WaitForData will not wait regardless of the amount
+        // of data in the queue. To make the queue usable again, call Reset.
+        void Release();
+
+        // Resets the "release valve" for threads waiting on the queue.
+        void Reset();
+    };
+
+    // Creates a new instance that can hold at least the given number of items.
+    template<class T, bool MultiProducer>
+    RingQueue<T, MultiProducer>::RingQueue(uint32_t capacity) :
+        m_mask(0),
+        m_padding0(),
+        m_enqueuePosition(0),
+        m_padding1(),
+        m_dequeuePosition(0),
+        m_padding2(),
+        m_release(false),
+        m_consumerParked(false),
+        m_parkedProducers(0),
+        m_overflowCount(0)
+    {
+        size_t size = 2;
+
+        while (size < capacity)
+            size <<= 1;
+
+        m_slots.reset(new Slot[size]);
+        m_mask = size - 1;
+
+        for (size_t i = 0; i < size; i++)
+            m_slots[i].Sequence.store(i, std::memory_order_relaxed);
+    }
+
+    // Releases all threads waiting on the queue.
+    template<class T, bool MultiProducer>
+    RingQueue<T, MultiProducer>::~RingQueue()
+    {
+        Release();
+    }
+
+    template<class T, bool MultiProducer>
+    bool RingQueue<T, MultiProducer>::TryPush(T& item)
+    {
+        size_t position = m_enqueuePosition.load(std::memory_order_relaxed);
+        Slot* slot;
+
+        while (true)
+        {
+            slot = &m_slots[position & m_mask];
+
+            const size_t sequence = slot->Sequence.load(std::memory_order_acquire);
+            const intptr_t difference = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+            // Slot still holds an item from the previous lap, queue is full
+            if (difference < 0)
+                return false;
+
+            if (difference == 0)
+            {
+                if (!MultiProducer)
+                {
+                    m_enqueuePosition.store(position + 1, std::memory_order_relaxed);
+                    break;
+                }
+
+                if (m_enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                    break;
+            }
+            else
+            {
+                // Another producer claimed the slot first
+                position = m_enqueuePosition.load(std::memory_order_relaxed);
+            }
+        }
+
+        slot->Item = std::move(item);
+        slot->Sequence.store(position + 1, std::memory_order_release);
+
+        return true;
+    }
+
+    template<class T, bool MultiProducer>
+    bool RingQueue<T, MultiProducer>::TryPop(T& item)
+    {
+        const size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+        Slot& slot = m_slots[position & m_mask];
+
+        if (slot.Sequence.load(std::memory_order_acquire) != position + 1)
+            return false;
+
+        item = std::move(slot.Item);
+        slot.Sequence.store(position + m_mask + 1, std::memory_order_release);
+        m_dequeuePosition.store(position + 1, std::memory_order_relaxed);
+
+        return true;
+    }
+
+    // Removes the oldest item from the overflow list, which only
+    // holds items that were enqueued after those in the ring.
+    template<class T, bool MultiProducer>
+    bool RingQueue<T, MultiProducer>::TryPopOverflow(T& item)
+    {
+        if (m_overflowCount.load(std::memory_order_acquire) == 0)
+            return false;
+
+        ScopeLock lock(m_mutex);
+
+        if (m_overflow.empty())
+            return false;
+
+        item = std::move(m_overflow.front());
+        m_overflow.pop_front();
+        m_overflowCount.fetch_sub(1, std::memory_order_release);
+
+        return true;
+    }
+
+    template<class T, bool MultiProducer>
+    bool RingQueue<T, MultiProducer>::IsEmpty() const
+    {
+        const size_t position = m_dequeuePosition.load(std::memory_order_relaxed);
+        return m_slots[position & m_mask].Sequence.load(std::memory_order_acquire) != position + 1 && m_overflowCount.load(std::memory_order_acquire) == 0;
+    }
+
+    // Wakes the consumer if it is parked. The fence pairs with the one in WaitForData
+    // so that either the consumer sees the new item or the producer sees it parked.
+    template<class T, bool MultiProducer>
+    void RingQueue<T, MultiProducer>::NotifyConsumer()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_consumerParked.load(std::memory_order_relaxed))
+        {
+            ScopeLock lock(m_mutex);
+            m_dataWaitHandle.notify_one();
+        }
+    }
+
+    // Wakes any producers parked on a full queue.
+    template<class T, bool MultiProducer>
+    void RingQueue<T, MultiProducer>::NotifyProducers()
+    {
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        if (m_parkedProducers.load(std::memory_order_relaxed) > 0)
+        {
+            ScopeLock lock(m_mutex);
+            m_spaceWaitHandle.notify_all();
+        }
+    }
+
+    // Inserts an item into the queue, waiting for space if the queue is full.
+    template<class T, bool MultiProducer>
+    bool RingQueue<T, MultiProducer>::Enqueue(T item)
+    {
+        uint32_t spins = 0;
+
+        while (!TryPush(item))
+        {
+            if (m_release.load(std::memory_order_acquire))
+                return false;
+
+            if (spins < SpinCount)
+            {
+                spins++;
+                boost::this_thread::yield();
+                continue;
+            }
+
+            UniqueLock lock(m_mutex);
+            m_parkedProducers.fetch_add(1, std::memory_order_relaxed);
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+
+            // Queue may have drained between the failed push and parking
+            bool pushed = TryPush(item);
+
+            while (!pushed && !m_release.load(std::memory_order_acquire))
+            {
+                m_spaceWaitHandle.wait(lock);
+                pushed = TryPush(item);
+            }
+
+            m_parkedProducers.fetch_sub(1, std::memory_order_relaxed);
+
+            if (!pushed)
+                return false;
+
+            break;
+        }
+
+        NotifyConsumer();
+        return true;
+    }
+
+    // Inserts an item into the queue if there is space for it.
+    template<class T, bool MultiProducer>
+    bool RingQueue<T, MultiProducer>::TryEnqueue(T& item)
+    {
+        if (!TryPush(item))
+            return false;
+
+        NotifyConsumer();
+        return true;
+    }
+
+    // Inserts an item into the queue without waiting.
+    template<class T, bool MultiProducer>
+    bool RingQueue<T, MultiProducer>::EnqueueUnbounded(T item)
+    {
+        if (m_release.load(std::memory_order_acquire))
+            return false;
+
+        // Once an item overflows, later items follow it through the
+        // overflow list until the consumer has emptied the list
+        if (m_overflowCount.load(std::memory_order_acquire) == 0 && TryPush(item))
+        {
+            NotifyConsumer();
+            return true;
+        }
+
+        ScopeLock lock(m_mutex);
+
+        m_overflow.push_back(std::move(item));
+        m_overflowCount.fetch_add(1, std::memory_order_release);
+
+        if (m_consumerParked.load(std::memory_order_relaxed))
+            m_dataWaitHandle.notify_one();
+
+        return true;
+    }
+
+    // Removes an item from the queue without waiting.
+    template<class T, bool MultiProducer>
+    bool RingQueue<T, MultiProducer>::TryDequeue(T& item)
+    {
+        if (!TryPop(item) && !TryPopOverflow(item))
+            return false;
+
+        NotifyProducers();
+        return true;
+    }
+
+    // Moves all items currently in the queue to the end of the given vector without waiting.
+    template<class T, bool MultiProducer>
+    uint32_t RingQueue<T, MultiProducer>::TryDequeueAll(std::vector<T>& items)
+    {
+        uint32_t count = 0;
+        T item;
+
+        while (TryPop(item) || TryPopOverflow(item))
+        {
+            items.push_back(std::move(item));
+            count++;
+        }
+
+        if (count > 0)
+            NotifyProducers();
+
+        return count;
+    }
+
+    // Waits for data and then moves up to maxCount items to the end of the given vector.
+    template<class T, bool MultiProducer>
+    uint32_t RingQueue<T, MultiProducer>::DequeueBulk(std::vector<T>& items, uint32_t maxCount)
+    {
+        WaitForData();
+
+        if (m_release.load(std::memory_order_acquire))
+            return 0;
+
+        uint32_t count = 0;
+        T item;
+
+        while (count < maxCount && (TryPop(item) || TryPopOverflow(item)))
+        {
+            items.push_back(std::move(item));
+            count++;
+        }
+
+        if (count > 0)
+            NotifyProducers();
+
+        return count;
+    }
+
+    // Empties the queue.
+    template<class T, bool MultiProducer>
+    void RingQueue<T, MultiProducer>::Clear()
+    {
+        T item;
+
+        while (TryPop(item))
+            item = T();
+
+        {
+            ScopeLock lock(m_mutex);
+            m_overflow.clear();
+            m_overflowCount.store(0, std::memory_order_release);
+        }
+
+        NotifyProducers();
+    }
+
+    // Returns the number of
+    // items left in the queue.
+    template<class T, bool MultiProducer>
+    uint32_t RingQueue<T, MultiProducer>::Size() const
+    {
+        const size_t dequeuePosition = m_dequeuePosition.load(std::memory_order_relaxed);
+        const size_t enqueuePosition = m_enqueuePosition.load(std::memory_order_relaxed);
+
+        // Producers may have claimed slots they have not yet published
+        const uint32_t ringSize = enqueuePosition > dequeuePosition ? static_cast<uint32_t>(enqueuePosition - dequeuePosition) : 0;
+
+        return ringSize + m_overflowCount.load(std::memory_order_relaxed);
+    }
+
+    // Gets the maximum number of items the ring can hold.
+    template<class T, bool MultiProducer>
+    uint32_t RingQueue<T, MultiProducer>::GetCapacity() const
+    {
+        return static_cast<uint32_t>(m_mask + 1);
+    }
+
+    // Gets the number of items held in the overflow list.
+    template<class T, bool MultiProducer>
+    uint32_t RingQueue<T, MultiProducer>::GetOverflowSize() const
+    {
+        return m_overflowCount.load(std::memory_order_relaxed);
+    }
+
+    // Waits for data to be inserted into the queue.
+    // If there is already data in the queue,
+    // this method will not wait.
+    template<class T, bool MultiProducer>
+    void RingQueue<T, MultiProducer>::WaitForData()
+    {
+        for (uint32_t i = 0; i < SpinCount; i++)
+        {
+            if (!IsEmpty() || m_release.load(std::memory_order_acquire))
+                return;
+
+            boost::this_thread::yield();
+        }
+
+        UniqueLock lock(m_mutex);
+        m_consumerParked.store(true, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        while (IsEmpty() && !m_release.load(std::memory_order_acquire))
+            m_dataWaitHandle.wait(lock);
+
+        m_consumerParked.store(false, std::memory_order_relaxed);
+    }
+
+    // Releases all threads waiting on the queue.
+    template<class T, bool MultiProducer>
+    void RingQueue<T, MultiProducer>::Release()
+    {
+        ScopeLock lock(m_mutex);
+
+        m_release.store(true, std::memory_order_release);
+        m_dataWaitHandle.notify_all();
+        m_spaceWaitHandle.notify_all();
+    }
+
+    // Resets the "release valve" for threads waiting on the queue.
+    // This can be called after Release so that the queue can be
+    // used again.
+    template<class T, bool MultiProducer>
+    void RingQueue<T, MultiProducer>::Reset()
+    {
+        ScopeLock lock(m_mutex);
+        m_release.store(false, std::memory_order_release);
+    }
+}
+
+#endif
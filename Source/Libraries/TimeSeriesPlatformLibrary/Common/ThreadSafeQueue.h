@@ -18,6 +18,8 @@
 //  ----------------------------------------------------------------------------------------------------
 //  03/27/2012 - Stephen C. Wills
 //       Generated original version of source code.
+//  10/15/2026 - GSF Development Team
+//       Items are now moved into and out of the queue.
 //
 //******************************************************************************************************
 
@@ -55,11 +57,12 @@ namespace GSF
         // Releases all threads waiting for data.
         ~ThreadSafeQueue();
 
-        // Inserts an item into the queue.
+        // Inserts an item into the queue. Item is moved into
+        // the queue, pass an rvalue to avoid copying it.
         void Enqueue(T item);
 
-        // Removes an item from the
-        // queue and returns that item.
+        // Removes an item from the queue and returns
+        // that item, moving it out of the queue.
         T Dequeue();
 
         // Empties the queue.
@@ -99,7 +102,7 @@ namespace GSF
     void ThreadSafeQueue<T>::Enqueue(T item)
     {
         ScopeLock lock(m_mutex);
-        m_queue.push(item);
+        m_queue.push(std::move(item));
         m_dataWaitHandle.notify_one();
     }
 
@@ -109,7 +112,7 @@ namespace GSF
     T ThreadSafeQueue<T>::Dequeue()
     {
         ScopeLock lock(m_mutex);
-        T item = m_queue.front();
+        T item = std::move(m_queue.front());
         m_queue.pop();
         return item;
     }
@@ -96,9 +96,16 @@ namespace GSF
         ~Timer()
         {
             m_disposing = true;
+            Stop();
+            m_timerContext.stop();
+
+            // Timer thread must leave the context before it is destroyed, the thread
+            // cannot be joined when the timer is destroyed by its own callback
+            if (m_timerThread != nullptr && m_timerThread->get_id() != boost::this_thread::get_id())
+                m_timerThread->join();
+
             delete m_timerThread;
             m_timerThread = nullptr;
-            Stop();
         }
 
         int32_t GetInterval() const
@@ -632,7 +632,7 @@ void DataRow::SetStringValue(const int32_t columnIndex, const Nullable<string>&
         const string& strval = value.GetValueOrDefault();
         const int32_t length = strval.size() + 1;
         char* copy = static_cast<char*>(malloc(length * sizeof(char)));
-        strcpy_s(copy, length, strval.c_str());
+        memcpy(copy, strval.c_str(), length);
         m_values[columnIndex] = copy;
     }
     else
@@ -784,7 +784,7 @@ void DataRow::SetDecimalValue(const int32_t columnIndex, const Nullable<decimal_
         const string& strval = value.GetValueOrDefault().str();
         const int32_t length = strval.size() + 1;
         char* copy = static_cast<char*>(malloc(length * sizeof(char)));
-        strcpy_s(copy, length, strval.c_str());
+        memcpy(copy, strval.c_str(), length);
         m_values[columnIndex] = copy;
     }
     else
@@ -0,0 +1,500 @@
+//******************************************************************************************************
+//  CommonTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/16/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <stdexcept>
+
+#include "../Common/ObjectPool.h"
+#include "../Common/RingQueue.h"
+#include "../Common/BoundedQueue.h"
+#include "../Common/LatencyHistogram.h"
+#include "../Common/BinaryCodec.h"
+
+using namespace std;
+using namespace GSF;
+
+// Dequeues items until the queue is empty, returning them in the order they were dequeued.
+vector<int32_t> DequeueAll(BoundedQueue<int32_t>& queue)
+{
+    vector<int32_t> items;
+    int32_t item;
+
+    while (queue.Size() > 0 && queue.Dequeue(item))
+        items.push_back(item);
+
+    return items;
+}
+
+// Test application for the common containers and utilities used by the transport.
+int main()
+{
+    int32_t test = 0;
+
+    // Object pool hands released objects out again rather than allocating new ones
+    {
+        ObjectPool<vector<uint8_t>> pool(2);
+        SharedPtr<vector<uint8_t>> first = pool.Acquire();
+        SharedPtr<vector<uint8_t>> second = pool.Acquire();
+
+        assert(first != second);
+        assert(pool.Size() == 0 && pool.GetTotalAllocations() == 2UL);
+
+        const SharedPtr<vector<uint8_t>> third = pool.Acquire();
+        assert(third != first && third != second);
+        assert(pool.GetTotalAllocations() == 3UL);
+
+        first->push_back(1);
+        vector<uint8_t>* released = first.get();
+
+        second.reset();
+        first.reset();
+        assert(pool.Size() == 2);
+
+        // The most recently released object comes back first as it was
+        // released, callers reset whatever state they use
+        first = pool.Acquire();
+        assert(first.get() == released && first->size() == 1);
+        first.reset();
+
+        for (int32_t i = 0; i < 100; i++)
+        {
+            const SharedPtr<vector<uint8_t>> item = pool.Acquire();
+            assert(item != third);
+        }
+
+        assert(pool.Size() == 2 && pool.GetTotalAllocations() == 3UL);
+        assert(pool.GetTotalAcquisitions() == 104UL);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Object pool keeps at most the given number of released objects
+    {
+        ObjectPool<vector<uint8_t>> pool(0, 2);
+        vector<SharedPtr<vector<uint8_t>>> items;
+
+        for (int32_t i = 0; i < 5; i++)
+            items.push_back(pool.Acquire());
+
+        items.clear();
+        assert(pool.Size() == 2 && pool.GetTotalAllocations() == 5UL);
+
+        for (int32_t i = 0; i < 5; i++)
+            items.push_back(pool.Acquire());
+
+        assert(pool.Size() == 0 && pool.GetTotalAllocations() == 8UL);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Object pool hands objects between threads that acquire and release them concurrently
+    {
+        const int32_t threadCount = 4;
+        const int32_t acquisitionCount = 20000;
+
+        ObjectPool<vector<int32_t>> pool;
+        vector<SharedPtr<Thread>> threads;
+
+        for (int32_t thread = 0; thread < threadCount; thread++)
+        {
+            threads.push_back(NewSharedPtr<Thread>([&pool, thread, acquisitionCount]
+            {
+                for (int32_t i = 0; i < acquisitionCount; i++)
+                {
+                    const SharedPtr<vector<int32_t>> item = pool.Acquire();
+
+                    item->assign(16, thread * acquisitionCount + i);
+
+                    for (int32_t value : *item)
+                        assert(value == thread * acquisitionCount + i);
+                }
+            }));
+        }
+
+        for (const SharedPtr<Thread>& thread : threads)
+            thread->join();
+
+        assert(pool.GetTotalAcquisitions() == static_cast<uint64_t>(threadCount * acquisitionCount));
+        assert(pool.GetTotalAllocations() <= static_cast<uint64_t>(threadCount));
+        assert(pool.Size() == pool.GetTotalAllocations());
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Objects still referenced when the pool is destroyed are freed once released
+    {
+        SharedPtr<vector<uint8_t>> item;
+
+        {
+            ObjectPool<vector<uint8_t>> pool(4);
+            item = pool.Acquire();
+        }
+
+        item->assign(8, 1);
+        item.reset();
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Ring queue rounds capacity up to a power of two and keeps items in order
+    {
+        RingQueue<int32_t> queue(5);
+        vector<int32_t> items;
+        int32_t item = 0;
+
+        assert(queue.GetCapacity() == 8);
+
+        for (int32_t i = 0; i < 8; i++)
+        {
+            item = i;
+            const bool enqueued = queue.TryEnqueue(item);
+            assert(enqueued);
+        }
+
+        item = 8;
+        const bool enqueuedWhenFull = queue.TryEnqueue(item);
+        assert(!enqueuedWhenFull && item == 8);
+        assert(queue.Size() == 8);
+
+        const bool dequeued = queue.TryDequeue(item);
+        assert(dequeued && item == 0);
+
+        const uint32_t count = queue.TryDequeueAll(items);
+        assert(count == 7 && items == vector<int32_t>({ 1, 2, 3, 4, 5, 6, 7 }));
+
+        const bool dequeuedWhenEmpty = queue.TryDequeue(item);
+        assert(!dequeuedWhenEmpty && queue.Size() == 0);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Ring queue delivers every item of several producers in the order each producer enqueued them
+    {
+        const int32_t producerCount = 4;
+        const int32_t itemCount = 20000;
+
+        // Small capacity has producers park on a full queue
+        RingQueue<int32_t> queue(16);
+        vector<SharedPtr<Thread>> producers;
+        vector<int32_t> nextItems(producerCount, 0);
+        vector<int32_t> items;
+        int32_t received = 0;
+
+        for (int32_t producer = 0; producer < producerCount; producer++)
+        {
+            producers.push_back(NewSharedPtr<Thread>([&queue, producer, itemCount]
+            {
+                for (int32_t i = 0; i < itemCount; i++)
+                    queue.Enqueue(producer * itemCount + i);
+            }));
+        }
+
+        while (received < producerCount * itemCount)
+        {
+            items.clear();
+            received += static_cast<int32_t>(queue.DequeueBulk(items, 100));
+
+            for (int32_t item : items)
+            {
+                const int32_t producer = item / itemCount;
+                assert(item % itemCount == nextItems[producer]);
+                nextItems[producer]++;
+            }
+        }
+
+        for (const SharedPtr<Thread>& producer : producers)
+            producer->join();
+
+        assert(nextItems == vector<int32_t>(producerCount, itemCount));
+
+        // Released queue no longer waits for data or space
+        int32_t item = 0;
+
+        while (queue.TryEnqueue(item))
+            item++;
+
+        queue.Release();
+
+        const bool enqueued = queue.Enqueue(item);
+        assert(!enqueued);
+
+        queue.Clear();
+
+        const uint32_t count = queue.DequeueBulk(items);
+        assert(count == 0);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Ring queue holds items beyond its capacity in the overflow list without waiting, in order
+    {
+        RingQueue<int32_t> queue(4);
+        vector<int32_t> items, expected;
+
+        for (int32_t i = 0; i < 100; i++)
+        {
+            const bool enqueued = queue.EnqueueUnbounded(i);
+            assert(enqueued);
+            expected.push_back(i);
+        }
+
+        assert(queue.Size() == 100 && queue.GetOverflowSize() == 96);
+
+        // Items enqueued while the overflow list holds items follow them
+        int32_t item = 100;
+        const bool enqueued = queue.TryEnqueue(item);
+        assert(!enqueued);
+
+        const uint32_t count = queue.DequeueBulk(items, 10);
+        assert(count == 10);
+
+        queue.EnqueueUnbounded(100);
+        expected.push_back(100);
+
+        queue.TryDequeueAll(items);
+        assert(items == expected && queue.Size() == 0 && queue.GetOverflowSize() == 0);
+
+        // Once the overflow list is empty items go to the ring again
+        queue.EnqueueUnbounded(101);
+        assert(queue.Size() == 1 && queue.GetOverflowSize() == 0);
+
+        // Released queue no longer accepts items
+        queue.Clear();
+        queue.Release();
+
+        const bool enqueuedWhenReleased = queue.EnqueueUnbounded(102);
+        assert(!enqueuedWhenReleased);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Bounded queue discards the oldest or newest items when full, as its policy defines
+    {
+        BoundedQueue<int32_t> dropOldest(3, BackpressurePolicy::DropOldest);
+        BoundedQueue<int32_t> dropNewest(3, BackpressurePolicy::DropNewest);
+        vector<bool> newestEnqueued;
+
+        for (int32_t i = 1; i <= 5; i++)
+        {
+            const bool oldestEnqueued = dropOldest.Enqueue(i);
+            assert(oldestEnqueued);
+
+            newestEnqueued.push_back(dropNewest.Enqueue(i));
+        }
+
+        assert(newestEnqueued == vector<bool>({ true, true, true, false, false }));
+
+        for (BoundedQueue<int32_t>* queue : { &dropOldest, &dropNewest })
+            assert(queue->GetMaxDepth() == 3 && queue->GetTotalDropped() == 2UL);
+
+        const vector<int32_t> oldestItems = DequeueAll(dropOldest);
+        const vector<int32_t> newestItems = DequeueAll(dropNewest);
+
+        assert(oldestItems == vector<int32_t>({ 3, 4, 5 }));
+        assert(newestItems == vector<int32_t>({ 1, 2, 3 }));
+
+        dropOldest.Reset();
+        assert(dropOldest.GetMaxDepth() == 0 && dropOldest.GetTotalDropped() == 0UL);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Bounded queue blocks the producer until the consumer makes room and releases waiting threads
+    {
+        const int32_t itemCount = 1000;
+
+        BoundedQueue<int32_t> queue(2, BackpressurePolicy::Block);
+        vector<int32_t> items;
+        int32_t item;
+
+        Thread producer([&queue, itemCount]
+        {
+            for (int32_t i = 0; i < itemCount; i++)
+                queue.Enqueue(i);
+        });
+
+        while (static_cast<int32_t>(items.size()) < itemCount && queue.Dequeue(item))
+            items.push_back(item);
+
+        producer.join();
+
+        assert(static_cast<int32_t>(items.size()) == itemCount);
+
+        for (int32_t i = 0; i < itemCount; i++)
+            assert(items[i] == i);
+
+        assert(queue.GetMaxDepth() <= 2 && queue.GetTotalDropped() == 0UL);
+
+        // Consumer waiting on an empty queue returns once the queue is released
+        bool dequeued = true;
+        Thread consumer([&queue, &dequeued]
+        {
+            int32_t value;
+            dequeued = queue.Dequeue(value);
+        });
+
+        queue.Release();
+        consumer.join();
+
+        assert(!dequeued);
+
+        // Items left in a released queue can still be taken without waiting
+        queue.Reset();
+        queue.Enqueue(1);
+        queue.Enqueue(2);
+        queue.Release();
+
+        const bool released = !queue.Dequeue(item);
+        assert(released);
+
+        vector<int32_t> remaining;
+
+        while (queue.TryDequeue(item))
+            remaining.push_back(item);
+
+        assert(remaining == vector<int32_t>({ 1, 2 }));
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Latency histogram reports small values exactly and larger percentiles within the bucket width
+    {
+        LatencyHistogram histogram;
+        LatencyHistogramSnapshot snapshot = histogram.GetSnapshot();
+
+        assert(snapshot.Count == 0UL && snapshot.Max == 0L);
+
+        for (int64_t value = 1L; value <= 10L; value++)
+            histogram.Record(value);
+
+        snapshot = histogram.GetSnapshot();
+        assert(snapshot.Count == 10UL && snapshot.Mean == 5.5);
+        assert(snapshot.P50 == 5L && snapshot.P99 == 10L && snapshot.Max == 10L);
+
+        histogram.Reset();
+        assert(histogram.GetCount() == 0UL);
+
+        for (int64_t value = 1L; value <= 1000L; value++)
+            histogram.Record(value);
+
+        snapshot = histogram.GetSnapshot();
+        assert(snapshot.Count == 1000UL && snapshot.Mean == 500.5 && snapshot.Max == 1000L);
+        assert(snapshot.P50 >= 500L && snapshot.P50 <= 531L);
+        assert(snapshot.P99 >= 990L && snapshot.P99 <= 1000L);
+        assert(snapshot.P999 == 1000L);
+
+        // Negative values, e.g., from clock differences, count as zero
+        histogram.Reset();
+        histogram.Record(-5L, 3UL);
+
+        snapshot = histogram.GetSnapshot();
+        assert(snapshot.Count == 3UL && snapshot.Mean == 0.0 && snapshot.P50 == 0L && snapshot.Max == 0L);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Binary writer and reader round trip values in either byte order
+    {
+        const Guid guid = NewGuid();
+        const vector<uint8_t> bytes = { 1, 2, 3 };
+        vector<uint8_t> buffer(64, 0);
+        BinaryWriter writer(buffer, 2);
+
+        writer.WriteByte(0xA5);
+        writer.WriteBigEndian<uint16_t>(0x1234);
+        writer.WriteLittleEndian<uint16_t>(0x1234);
+        writer.WriteBigEndian<int32_t>(-2);
+        writer.WriteLittleEndian<uint64_t>(0x0102030405060708UL);
+        writer.WriteBigEndian<float64_t>(-1.25);
+        writer.WriteGuid(guid);
+        writer.WriteBytes(bytes);
+
+        assert(writer.Position() == 2 + 1 + 2 + 2 + 4 + 8 + 8 + 16 + 3);
+        assert(writer.Remaining() == buffer.size() - writer.Position());
+        assert(buffer[0] == 0 && buffer[2] == 0xA5);
+        assert(buffer[3] == 0x12 && buffer[4] == 0x34 && buffer[5] == 0x34 && buffer[6] == 0x12);
+
+        BinaryReader reader(buffer.data(), 2, writer.Position() - 2);
+        Guid readGuid;
+
+        const uint8_t byteValue = reader.ReadByte();
+        const uint16_t bigEndianValue = reader.ReadBigEndian<uint16_t>();
+        const uint16_t littleEndianValue = reader.ReadLittleEndian<uint16_t>();
+        const int32_t signedValue = reader.ReadBigEndian<int32_t>();
+        const uint64_t longValue = reader.ReadLittleEndian<uint64_t>();
+        const float64_t floatValue = reader.ReadBigEndian<float64_t>();
+
+        reader.ReadBytes(readGuid.data, 16);
+        const uint8_t* readBytes = reader.ReadBytes(3);
+
+        assert(byteValue == 0xA5 && bigEndianValue == 0x1234 && littleEndianValue == 0x1234);
+        assert(signedValue == -2 && longValue == 0x0102030405060708UL && floatValue == -1.25);
+        assert(readGuid == guid);
+        assert(vector<uint8_t>(readBytes, readBytes + 3) == bytes);
+        assert(reader.Remaining() == 0);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Binary writer and reader throw rather than go past the end of their span
+    {
+        vector<uint8_t> buffer(3, 0);
+        BinaryWriter writer(buffer);
+        BinaryReader reader(buffer);
+        bool writeFailed = false, readFailed = false;
+
+        writer.WriteByte(1);
+
+        try
+        {
+            writer.WriteBigEndian<uint32_t>(2);
+        }
+        catch (const out_of_range&)
+        {
+            writeFailed = true;
+        }
+
+        assert(writeFailed && writer.Position() == 1);
+
+        reader.Skip(2);
+
+        try
+        {
+            reader.ReadBigEndian<uint16_t>();
+        }
+        catch (const out_of_range&)
+        {
+            readFailed = true;
+        }
+
+        assert(readFailed && reader.Position() == 2 && reader.Remaining() == 1);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    cout << endl << "Tests complete." << endl;
+
+    return 0;
+}
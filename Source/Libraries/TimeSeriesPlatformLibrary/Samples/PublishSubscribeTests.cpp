@@ -0,0 +1,766 @@
+//******************************************************************************************************
+//  PublishSubscribeTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/16/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <chrono>
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <cstdio>
+
+#include "../Common/Convert.h"
+#include "../Transport/DataPublisher.h"
+#include "../Transport/DataSubscriber.h"
+#include "../Transport/SubscriberInstance.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+using namespace boost::asio::ip;
+
+// Defines metadata for the given number of new signals of one device.
+void DefineMetadata(const DataPublisherPtr& publisher, uint32_t signalCount, vector<Guid>& signalIDs, int32_t versionNumber = 0)
+{
+    const DeviceMetadataPtr device = NewSharedPtr<DeviceMetadata>();
+    vector<MeasurementMetadataPtr> measurements;
+
+    device->Acronym = "TESTDEVICE";
+    device->Name = "Test Device";
+    device->UniqueID = NewGuid();
+    device->AccessID = 1;
+    device->FramesPerSecond = 30;
+    device->Longitude = 0.0;
+    device->Latitude = 0.0;
+
+    signalIDs.clear();
+
+    for (uint32_t i = 0; i < signalCount; i++)
+    {
+        const MeasurementMetadataPtr measurement = NewSharedPtr<MeasurementMetadata>();
+
+        measurement->DeviceAcronym = device->Acronym;
+        measurement->ID = "PPA:" + ToString(i + 1);
+        measurement->SignalID = NewGuid();
+        measurement->PointTag = "TESTDEVICE:ALOG" + ToString(i + 1);
+        measurement->Reference = SignalReference("TESTDEVICE-AV" + ToString(i + 1));
+        measurement->PhasorSourceIndex = 0;
+
+        measurements.push_back(measurement);
+        signalIDs.push_back(measurement->SignalID);
+    }
+
+    publisher->DefineMetadata({ device }, measurements, {}, versionNumber);
+}
+
+// Creates a publisher on the given port with metadata for the given number of signals of one device.
+DataPublisherPtr CreatePublisher(uint16_t port, uint32_t signalCount, vector<Guid>& signalIDs)
+{
+    const DataPublisherPtr publisher = NewSharedPtr<DataPublisher>(port);
+    DefineMetadata(publisher, signalCount, signalIDs);
+
+    return publisher;
+}
+
+// Gets a filter expression that selects the given signals.
+string GetFilterExpression(const vector<Guid>& signalIDs)
+{
+    string filterExpression;
+
+    for (const Guid& signalID : signalIDs)
+        filterExpression += (filterExpression.empty() ? "" : ";") + ToString(signalID);
+
+    return filterExpression;
+}
+
+// Creates a frame of measurements of the given signals, with values that identify the frame and signal.
+vector<Measurement> CreateFrame(const vector<Guid>& signalIDs, uint32_t frame)
+{
+    vector<Measurement> measurements;
+    const int64_t timestamp = ToTicks(UtcNow());
+
+    for (size_t i = 0; i < signalIDs.size(); i++)
+    {
+        Measurement measurement;
+
+        measurement.SignalID = signalIDs[i];
+        measurement.Timestamp = timestamp;
+        measurement.Value = frame * 1000.0 + i;
+
+        measurements.push_back(measurement);
+    }
+
+    return measurements;
+}
+
+// Subscriber that keeps the values it receives and the status messages it is sent.
+class TestSubscriber
+{
+private:
+    mutex m_lock;
+    condition_variable m_changed;
+    vector<float64_t> m_values;
+    vector<string> m_statusMessages;
+    vector<string> m_errorMessages;
+
+    static void HandleNewMeasurements(DataSubscriber* source, const vector<MeasurementPtr>& measurements)
+    {
+        TestSubscriber* subscriber = static_cast<TestSubscriber*>(source->GetUserData());
+        lock_guard<mutex> lock(subscriber->m_lock);
+
+        for (const MeasurementPtr& measurement : measurements)
+            subscriber->m_values.push_back(measurement->Value);
+
+        subscriber->m_changed.notify_all();
+    }
+
+    static void HandleStatusMessage(DataSubscriber* source, const string& message)
+    {
+        TestSubscriber* subscriber = static_cast<TestSubscriber*>(source->GetUserData());
+        lock_guard<mutex> lock(subscriber->m_lock);
+
+        subscriber->m_statusMessages.push_back(message);
+        subscriber->m_changed.notify_all();
+    }
+
+    static void HandleErrorMessage(DataSubscriber* source, const string& message)
+    {
+        TestSubscriber* subscriber = static_cast<TestSubscriber*>(source->GetUserData());
+        lock_guard<mutex> lock(subscriber->m_lock);
+
+        subscriber->m_errorMessages.push_back(message);
+    }
+
+public:
+    DataSubscriber Subscriber;
+
+    TestSubscriber(const SubscriberExecutorPtr& executor = nullptr) :
+        Subscriber(executor)
+    {
+        Subscriber.SetUserData(this);
+        Subscriber.RegisterNewMeasurementsCallback(&HandleNewMeasurements);
+        Subscriber.RegisterStatusMessageCallback(&HandleStatusMessage);
+        Subscriber.RegisterErrorMessageCallback(&HandleErrorMessage);
+    }
+
+    ~TestSubscriber()
+    {
+        Subscriber.Disconnect();
+    }
+
+    // Waits until the given number of status messages containing the given text are received, returning false on timeout.
+    bool WaitForStatusMessage(const string& text, size_t count = 1)
+    {
+        unique_lock<mutex> lock(m_lock);
+
+        return m_changed.wait_for(lock, chrono::seconds(10), [&]
+        {
+            return static_cast<size_t>(count_if(m_statusMessages.begin(), m_statusMessages.end(), [&](const string& message) { return message.find(text) != string::npos; })) >= count;
+        });
+    }
+
+    // Determines if a status message containing the given text was received.
+    bool HasStatusMessage(const string& text)
+    {
+        lock_guard<mutex> lock(m_lock);
+        return any_of(m_statusMessages.begin(), m_statusMessages.end(), [&](const string& message) { return message.find(text) != string::npos; });
+    }
+
+    // Waits until at least the given number of values are received, or for the given time, then
+    // discards the values received so far, returning the number of values that were discarded.
+    size_t SkipValues(size_t count, int32_t milliseconds)
+    {
+        unique_lock<mutex> lock(m_lock);
+        m_changed.wait_for(lock, chrono::milliseconds(milliseconds), [&] { return m_values.size() >= count; });
+
+        const size_t skipped = m_values.size();
+        m_values.clear();
+
+        return skipped;
+    }
+
+    // Gets the error messages received.
+    vector<string> GetErrorMessages()
+    {
+        lock_guard<mutex> lock(m_lock);
+        return m_errorMessages;
+    }
+
+    // Waits until at least the given number of values are received, then gets all values received.
+    vector<float64_t> WaitForValues(size_t count)
+    {
+        unique_lock<mutex> lock(m_lock);
+        m_changed.wait_for(lock, chrono::seconds(10), [&] { return m_values.size() >= count; });
+
+        // Values received after the expected ones would show up in the meantime
+        m_changed.wait_for(lock, chrono::milliseconds(200), [] { return false; });
+
+        return m_values;
+    }
+};
+
+// Subscriber instance that keeps the status and error messages it is sent.
+class TestInstance : public SubscriberInstance
+{
+private:
+    mutex m_lock;
+    condition_variable m_changed;
+    vector<string> m_statusMessages;
+    vector<string> m_errorMessages;
+
+protected:
+    void StatusMessage(const string& message) override
+    {
+        lock_guard<mutex> lock(m_lock);
+
+        m_statusMessages.push_back(message);
+        m_changed.notify_all();
+    }
+
+    void ErrorMessage(const string& message) override
+    {
+        lock_guard<mutex> lock(m_lock);
+        m_errorMessages.push_back(message);
+    }
+
+public:
+    TestInstance(uint16_t port, const string& metadataSnapshotPath)
+    {
+        Initialize("127.0.0.1", port);
+        SetMetadataSnapshotPath(metadataSnapshotPath);
+    }
+
+    ~TestInstance()
+    {
+        Disconnect();
+    }
+
+    // Waits until a status message containing the given text is received, returning false on timeout.
+    bool WaitForStatusMessage(const string& text)
+    {
+        unique_lock<mutex> lock(m_lock);
+
+        return m_changed.wait_for(lock, chrono::seconds(10), [&]
+        {
+            return any_of(m_statusMessages.begin(), m_statusMessages.end(), [&](const string& message) { return message.find(text) != string::npos; });
+        });
+    }
+
+    // Determines if a status message containing the given text was received.
+    bool HasStatusMessage(const string& text)
+    {
+        lock_guard<mutex> lock(m_lock);
+        return any_of(m_statusMessages.begin(), m_statusMessages.end(), [&](const string& message) { return message.find(text) != string::npos; });
+    }
+
+    // Gets the error messages received.
+    vector<string> GetErrorMessages()
+    {
+        lock_guard<mutex> lock(m_lock);
+        return m_errorMessages;
+    }
+};
+
+// Connects the subscribers to the publisher on the given port, each with a data packet format of its own so
+// that the publish threads publish to them in parallel, and waits until every subscription is acknowledged.
+void SubscribeWithDistinctFormats(const vector<TestSubscriber*>& subscribers, uint16_t port, const vector<Guid>& signalIDs)
+{
+    for (size_t i = 0; i < subscribers.size(); i++)
+    {
+        SubscriptionInfo info;
+
+        info.FilterExpression = GetFilterExpression(signalIDs);
+        info.IncludeTime = i != 1;
+        info.UseMillisecondResolution = i == 2;
+
+        subscribers[i]->Subscriber.Connect("127.0.0.1", port);
+        subscribers[i]->Subscriber.Subscribe(info);
+
+        const bool subscribed = subscribers[i]->WaitForStatusMessage("Client subscribed");
+        assert(subscribed);
+    }
+}
+
+// Gets the frame numbers of the given values, asserting that each frame has every signal in order.
+vector<uint32_t> GetFrames(const vector<float64_t>& values, uint32_t signalCount)
+{
+    vector<uint32_t> frames;
+
+    assert(values.size() % signalCount == 0);
+
+    for (size_t i = 0; i < values.size(); i += signalCount)
+    {
+        const uint32_t frame = static_cast<uint32_t>(values[i] / 1000.0);
+
+        for (uint32_t j = 0; j < signalCount; j++)
+            assert(values[i + j] == frame * 1000.0 + j);
+
+        frames.push_back(frame);
+    }
+
+    return frames;
+}
+
+// Test application that publishes measurements to subscribers connected over loopback.
+int main()
+{
+    const uint16_t port = 36170;
+    int32_t test = 0;
+
+    // Subscribers with different data packet formats only receive the data packets of their own multicast group
+    {
+        const uint32_t signalCount = 10;
+        const uint32_t frameCount = 20;
+
+        vector<Guid> signalIDs;
+        const DataPublisherPtr publisher = CreatePublisher(port, signalCount, signalIDs);
+
+        publisher->SetMulticastAddress(make_address("239.192.70.1"));
+        publisher->SetMulticastPort(39610);
+        publisher->SetMulticastInterface(make_address("127.0.0.1"));
+        publisher->SetMulticastLoopback(true);
+
+        TestSubscriber withTime, withoutTime;
+
+        for (TestSubscriber* subscriber : { &withTime, &withoutTime })
+        {
+            SubscriptionInfo info;
+
+            info.FilterExpression = GetFilterExpression(signalIDs);
+            info.MulticastDataChannel = true;
+            info.MulticastInterface = "127.0.0.1";
+            info.IncludeTime = subscriber == &withTime;
+
+            subscriber->Subscriber.Connect("127.0.0.1", port);
+            subscriber->Subscriber.Subscribe(info);
+
+            const bool joined = subscriber->WaitForStatusMessage("Joined multicast group");
+            assert(joined);
+        }
+
+        // First frame has the publisher send the base times on the command channel, measurements
+        // of the frame that arrive ahead of them are dropped without an error, but counted
+        publisher->PublishMeasurements(CreateFrame(signalIDs, frameCount));
+
+        for (TestSubscriber* subscriber : { &withTime, &withoutTime })
+        {
+            const size_t received = subscriber->SkipValues(signalCount, 500);
+            assert(received + subscriber->Subscriber.GetTotalMeasurementsWithoutBaseTime() == signalCount);
+        }
+
+        // Measurements without timestamps do not depend on the base times
+        assert(withoutTime.Subscriber.GetTotalMeasurementsWithoutBaseTime() == 0UL);
+
+        for (uint32_t frame = 0; frame < frameCount; frame++)
+            publisher->PublishMeasurements(CreateFrame(signalIDs, frame));
+
+        // Each subscriber receives each value once, in the format it subscribed with
+        for (TestSubscriber* subscriber : { &withTime, &withoutTime })
+        {
+            vector<float64_t> values = subscriber->WaitForValues(signalCount * frameCount);
+            assert(values.size() == signalCount * frameCount);
+            assert(subscriber->GetErrorMessages().empty());
+
+            sort(values.begin(), values.end());
+
+            for (uint32_t frame = 0; frame < frameCount; frame++)
+            {
+                for (uint32_t i = 0; i < signalCount; i++)
+                    assert(values[frame * signalCount + i] == frame * 1000.0 + i);
+            }
+        }
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Partitioned TSSC data packets decode on the executor pool and without one, with partitions left empty,
+    // after a resubscription restarts every partition's sequence and after the partition count changes
+    {
+        const uint32_t signalCount = 5;
+        const uint32_t frameCount = 30;
+
+        vector<Guid> signalIDs;
+        const DataPublisherPtr publisher = CreatePublisher(port + 1, signalCount, signalIDs);
+        const SubscriberExecutorPtr executor = NewSharedPtr<SubscriberExecutor>(2, 1);
+
+        TestSubscriber pooled(executor), standalone;
+        uint32_t subscriptions = 0;
+
+        for (TestSubscriber* subscriber : { &pooled, &standalone })
+            subscriber->Subscriber.Connect("127.0.0.1", port + 1);
+
+        // More partitions than signals leaves some partitions empty in every data packet
+        for (uint32_t partitionCount : { 8U, 8U, 3U })
+        {
+            vector<float64_t> expected;
+            subscriptions++;
+
+            for (TestSubscriber* subscriber : { &pooled, &standalone })
+            {
+                SubscriptionInfo info;
+
+                info.FilterExpression = GetFilterExpression(signalIDs);
+                info.IncludeTime = true;
+                info.TSSCPartitions = partitionCount;
+
+                subscriber->Subscriber.Subscribe(info);
+
+                const bool subscribed = subscriber->WaitForStatusMessage("Client subscribed", subscriptions);
+                assert(subscribed);
+            }
+
+            // Every other frame only has the first signal, so the other partitions
+            // keep their sequence numbers through the packets they are missing from
+            for (uint32_t frame = 0; frame < frameCount; frame++)
+            {
+                vector<Measurement> measurements = CreateFrame(signalIDs, frame);
+
+                if (frame % 2 == 1)
+                    measurements.resize(1);
+
+                for (const Measurement& measurement : measurements)
+                    expected.push_back(measurement.Value);
+
+                publisher->PublishMeasurements(measurements);
+            }
+
+            sort(expected.begin(), expected.end());
+
+            for (TestSubscriber* subscriber : { &pooled, &standalone })
+            {
+                vector<float64_t> values = subscriber->WaitForValues(expected.size());
+                sort(values.begin(), values.end());
+
+                assert(values == expected);
+                assert(subscriber->GetErrorMessages().empty());
+                assert(!subscriber->HasStatusMessage("algorithm reset before sequence number"));
+
+                subscriber->SkipValues(0, 0);
+            }
+        }
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Publish threads deliver every batch to each connection in the order it was published, from copies
+    // of the measurements taken before PublishMeasurements returns, and report the publish queue depth
+    {
+        const uint32_t signalCount = 10;
+        const uint32_t frameCount = 200;
+        const uint32_t queueCapacity = 4;
+
+        vector<Guid> signalIDs;
+        const DataPublisherPtr publisher = CreatePublisher(port + 2, signalCount, signalIDs);
+
+        publisher->SetPublishQueueCapacity(queueCapacity);
+        publisher->SetPublishBackpressurePolicy(BackpressurePolicy::Block);
+        publisher->SetPublishThreadCount(3);
+        assert(publisher->GetPublishThreadCount() == 3);
+
+        TestSubscriber withTime, withoutTime, withMilliseconds;
+        const vector<TestSubscriber*> subscribers = { &withTime, &withoutTime, &withMilliseconds };
+        vector<float64_t> expected;
+
+        SubscribeWithDistinctFormats(subscribers, port + 2, signalIDs);
+
+        for (uint32_t frame = 0; frame < frameCount; frame++)
+        {
+            const vector<Measurement> measurements = CreateFrame(signalIDs, frame);
+
+            for (const Measurement& measurement : measurements)
+                expected.push_back(measurement.Value);
+
+            if (frame % 2 == 0)
+            {
+                publisher->PublishMeasurements(measurements);
+                continue;
+            }
+
+            // Measurements published by pointer are changed as soon as the call returns
+            vector<MeasurementPtr> measurementPtrs;
+
+            for (const Measurement& measurement : measurements)
+                measurementPtrs.push_back(NewSharedPtr<Measurement>(measurement));
+
+            publisher->PublishMeasurements(measurementPtrs);
+
+            for (const MeasurementPtr& measurement : measurementPtrs)
+                measurement->Value = -1.0;
+        }
+
+        for (TestSubscriber* subscriber : subscribers)
+        {
+            assert(subscriber->WaitForValues(expected.size()) == expected);
+            assert(subscriber->GetErrorMessages().empty());
+        }
+
+        // Blocking never drops a batch or lets the queue grow past its capacity
+        assert(publisher->GetPublishQueueDepth() == 0);
+        assert(publisher->GetPublishQueueMaxDepth() >= 1 && publisher->GetPublishQueueMaxDepth() <= queueCapacity);
+        assert(publisher->GetTotalDroppedPublications() == 0UL);
+
+        // Changing the publish thread count while measurements are published loses no batch, the
+        // batches still queued when the publish threads stop are published before the change returns
+        for (TestSubscriber* subscriber : subscribers)
+            subscriber->SkipValues(0, 0);
+
+        expected.clear();
+
+        Thread reconfigure([&publisher]
+        {
+            for (const uint32_t threadCount : { 1U, 2U, 3U, 1U })
+                publisher->SetPublishThreadCount(threadCount);
+        });
+
+        for (uint32_t frame = 0; frame < frameCount; frame++)
+        {
+            const vector<Measurement> measurements = CreateFrame(signalIDs, frame);
+
+            for (const Measurement& measurement : measurements)
+                expected.push_back(measurement.Value);
+
+            publisher->PublishMeasurements(measurements);
+        }
+
+        reconfigure.join();
+        publisher->SetPublishThreadCount(0);
+        assert(publisher->GetPublishQueueDepth() == 0);
+
+        for (TestSubscriber* subscriber : subscribers)
+        {
+            assert(subscriber->WaitForValues(expected.size()) == expected);
+            assert(subscriber->GetErrorMessages().empty());
+        }
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Publish threads that fall behind drop whole batches according to the backpressure policy, the same
+    // batches for every connection, and the statistics are reset when the publish thread count changes
+    {
+        const uint32_t signalCount = 100;
+        const uint32_t frameCount = 500;
+
+        vector<Guid> signalIDs;
+        const DataPublisherPtr publisher = CreatePublisher(port + 3, signalCount, signalIDs);
+        vector<vector<Measurement>> frames;
+
+        TestSubscriber withTime, withoutTime, withMilliseconds;
+        const vector<TestSubscriber*> subscribers = { &withTime, &withoutTime, &withMilliseconds };
+
+        SubscribeWithDistinctFormats(subscribers, port + 3, signalIDs);
+
+        // Frames are created up front so batches are queued faster than they are published
+        for (uint32_t frame = 0; frame < frameCount; frame++)
+            frames.push_back(CreateFrame(signalIDs, frame));
+
+        publisher->SetPublishQueueCapacity(1);
+
+        for (BackpressurePolicy policy : { BackpressurePolicy::DropNewest, BackpressurePolicy::DropOldest })
+        {
+            publisher->SetPublishBackpressurePolicy(policy);
+            publisher->SetPublishThreadCount(2);
+
+            assert(publisher->GetPublishQueueMaxDepth() == 0);
+            assert(publisher->GetTotalDroppedPublications() == 0UL);
+
+            for (const vector<Measurement>& measurements : frames)
+                publisher->PublishMeasurements(measurements);
+
+            const uint64_t dropped = publisher->GetTotalDroppedPublications();
+            const size_t delivered = static_cast<size_t>(frameCount - dropped);
+            vector<uint32_t> firstFrames;
+
+            assert(dropped > 0UL && publisher->GetPublishQueueMaxDepth() == 1);
+
+            for (TestSubscriber* subscriber : subscribers)
+            {
+                const vector<uint32_t> frameNumbers = GetFrames(subscriber->WaitForValues(delivered * signalCount), signalCount);
+
+                assert(frameNumbers.size() == delivered);
+                assert(is_sorted(frameNumbers.begin(), frameNumbers.end()));
+                assert(adjacent_find(frameNumbers.begin(), frameNumbers.end()) == frameNumbers.end());
+                assert(subscriber->GetErrorMessages().empty());
+
+                // Dropping the newest batch never drops the first, dropping the oldest never drops the last
+                if (policy == BackpressurePolicy::DropNewest)
+                    assert(frameNumbers.front() == 0);
+                else
+                    assert(frameNumbers.back() == frameCount - 1);
+
+                if (firstFrames.empty())
+                    firstFrames = frameNumbers;
+                else
+                    assert(frameNumbers == firstFrames);
+
+                subscriber->SkipValues(0, 0);
+            }
+        }
+
+        publisher->SetPublishThreadCount(0);
+        assert(publisher->GetPublishQueueMaxDepth() == 0 && publisher->GetTotalDroppedPublications() == 0UL);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Throttled subscriptions are sent only the latest value of each signal once per processing interval,
+    // at the rate set by a processing interval update, and never a snapshot while the send queue is full
+    {
+        const uint32_t signalCount = 5;
+        const int32_t publishMilliseconds = 1000;
+
+        vector<Guid> signalIDs;
+        const DataPublisherPtr publisher = CreatePublisher(port + 4, signalCount, signalIDs);
+
+        TestSubscriber throttled;
+        SubscriptionInfo info;
+        uint32_t frame = 0;
+
+        info.FilterExpression = GetFilterExpression(signalIDs);
+        info.Throttled = true;
+        info.ProcessingInterval = 200;
+
+        throttled.Subscriber.Connect("127.0.0.1", port + 4);
+        throttled.Subscriber.Subscribe(info);
+
+        const bool subscribed = throttled.WaitForStatusMessage("Client subscribed");
+        assert(subscribed);
+
+        // Publishes a frame every five milliseconds for the given time, then gets the snapshots received
+        // as the frame of each, all signals of which were published together, asserting that signals only
+        // ever move on to newer values and that the last snapshot has the last values published
+        const auto publishFrames = [&]() -> vector<uint32_t>
+        {
+            const chrono::steady_clock::time_point stop = chrono::steady_clock::now() + chrono::milliseconds(publishMilliseconds);
+
+            while (chrono::steady_clock::now() < stop)
+            {
+                publisher->PublishMeasurements(CreateFrame(signalIDs, frame++));
+                this_thread::sleep_for(chrono::milliseconds(5));
+            }
+
+            // Snapshot with the last frame follows within an interval
+            const vector<float64_t> values = throttled.WaitForValues(0);
+            throttled.SkipValues(0, 0);
+
+            vector<uint32_t> snapshots = GetFrames(values, signalCount);
+            assert(throttled.GetErrorMessages().empty());
+
+            assert(!snapshots.empty() && snapshots.back() == frame - 1);
+            assert(adjacent_find(snapshots.begin(), snapshots.end(), greater_equal<uint32_t>()) == snapshots.end());
+
+            return snapshots;
+        };
+
+        // Published at 200 frames per second, received at five snapshots per second
+        const size_t slowSnapshots = publishFrames().size();
+        assert(slowSnapshots >= 3 && slowSnapshots <= 8);
+
+        // Processing interval update to 50 milliseconds raises the rate to twenty snapshots per second
+        const uint8_t processingInterval[] = { 0, 0, 0, 50 };
+        throttled.Subscriber.SendServerCommand(ServerCommand::UpdateProcessingInterval, processingInterval, 0, 4);
+
+        const bool updated = throttled.WaitForStatusMessage("New processing interval of 50");
+        assert(updated);
+
+        const size_t fastSnapshots = publishFrames().size();
+        assert(fastSnapshots >= 12 && fastSnapshots <= 30);
+
+        // Snapshots are dropped rather than queued once the send queue is at its high-water mark,
+        // whatever the slow consumer policy, and the first snapshot with room has the latest values
+        publisher->SetSlowConsumerPolicy(SlowConsumerPolicy::BlockPublisher);
+        publisher->SetMaxSendQueuePackets(0U);
+
+        for (uint32_t i = 0; i < 20; i++)
+        {
+            publisher->PublishMeasurements(CreateFrame(signalIDs, frame++));
+            this_thread::sleep_for(chrono::milliseconds(10));
+        }
+
+        assert(publisher->GetTotalDataPacketsDropped() > 0UL);
+        assert(throttled.WaitForValues(0).empty());
+
+        publisher->SetMaxSendQueuePackets(1000U);
+        assert(GetFrames(throttled.WaitForValues(signalCount), signalCount) == vector<uint32_t>{ frame - 1 });
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Metadata snapshot saved by one subscriber instance lets the next subscribe right away after validating
+    // only the publisher metadata version, and full metadata is requested once the version has changed
+    {
+        const string metadataSnapshotPath = "PublishSubscribeTests.metadata";
+        vector<Guid> signalIDs;
+        const DataPublisherPtr publisher = CreatePublisher(port + 5, 5, signalIDs);
+
+        remove(metadataSnapshotPath.c_str());
+
+        {
+            TestInstance instance(port + 5, metadataSnapshotPath);
+            instance.Connect();
+
+            const bool loaded = instance.WaitForStatusMessage("from GEP meta data");
+            assert(loaded);
+            assert(instance.GetErrorMessages().empty());
+        }
+
+        {
+            TestInstance instance(port + 5, metadataSnapshotPath);
+            instance.Connect();
+
+            const bool validated = instance.WaitForStatusMessage("matches publisher metadata version");
+            assert(validated);
+
+            // Allow for full metadata to be received, were it requested
+            this_thread::sleep_for(chrono::milliseconds(200));
+
+            assert(instance.HasStatusMessage("from metadata snapshot"));
+            assert(!instance.HasStatusMessage("from GEP meta data"));
+            assert(instance.GetErrorMessages().empty());
+        }
+
+        DefineMetadata(publisher, 5, signalIDs, 1);
+
+        {
+            TestInstance instance(port + 5, metadataSnapshotPath);
+            instance.Connect();
+
+            const bool reloaded = instance.WaitForStatusMessage("from GEP meta data");
+            assert(reloaded);
+            assert(instance.HasStatusMessage("does not match publisher metadata version 1"));
+            assert(instance.GetErrorMessages().empty());
+        }
+
+        remove(metadataSnapshotPath.c_str());
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    cout << endl << "Tests complete." << endl;
+
+    return 0;
+}
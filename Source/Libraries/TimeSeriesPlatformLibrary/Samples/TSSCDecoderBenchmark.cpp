@@ -0,0 +1,164 @@
+//******************************************************************************************************
+//  TSSCDecoderBenchmark.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/16/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <iomanip>
+#include <random>
+#include <vector>
+#include <chrono>
+#include <cstring>
+
+#include "../Transport/TSSCMeasurementEncoder.h"
+#include "../Transport/TSSCMeasurementParser.h"
+#include "../Transport/TSSCDecoder.h"
+
+using namespace std;
+using namespace std::chrono;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+typedef vector<uint8_t> Packet;
+
+// Encodes frames of the given number of points at 30 frames per second into packets the size
+// the publisher sends. The given percentage of values change with each frame, the rest repeat.
+vector<Packet> CreatePackets(uint32_t pointCount, uint32_t frameCount, uint32_t changePercent, uint64_t& measurementCount)
+{
+    const uint32_t PacketSize = 32000;
+
+    mt19937 random(1);
+    TSSCMeasurementEncoder encoder;
+    vector<uint32_t> values(pointCount, 0x42480000);
+    vector<Packet> packets;
+    Packet packet(PacketSize);
+    int64_t timestamp = 636854109250904770L;
+
+    encoder.SetBuffer(packet.data(), 0, PacketSize);
+    measurementCount = 0;
+
+    for (uint32_t frame = 0; frame < frameCount; frame++)
+    {
+        timestamp += 333333;
+
+        for (uint32_t id = 0; id < pointCount; id++)
+        {
+            if (random() % 100 < changePercent)
+                values[id] ^= random() & 0xFFFF;
+
+            float32_t value;
+            memcpy(&value, &values[id], sizeof(float32_t));
+
+            if (!encoder.TryAddMeasurement(static_cast<uint16_t>(id), timestamp, 0, value))
+            {
+                packet.resize(encoder.FinishBlock());
+                packets.push_back(packet);
+                packet.assign(PacketSize, 0);
+                encoder.SetBuffer(packet.data(), 0, PacketSize);
+                encoder.TryAddMeasurement(static_cast<uint16_t>(id), timestamp, 0, value);
+            }
+
+            measurementCount++;
+        }
+    }
+
+    packet.resize(encoder.FinishBlock());
+    packets.push_back(packet);
+
+    return packets;
+}
+
+// Gets the rate, in millions of measurements per second, of the fastest of several runs of the decode function.
+template<class Decode>
+double Measure(uint64_t measurementCount, Decode decode)
+{
+    double best = 0.0;
+
+    for (int32_t run = 0; run < 5; run++)
+    {
+        const steady_clock::time_point start = steady_clock::now();
+        const uint64_t decoded = decode();
+        const double seconds = duration<double>(steady_clock::now() - start).count();
+
+        if (decoded != measurementCount)
+        {
+            cout << "Decoded " << decoded << " of " << measurementCount << " measurements" << endl;
+            return 0.0;
+        }
+
+        best = max(best, measurementCount / seconds / 1.0E6);
+    }
+
+    return best;
+}
+
+// Sample application that compares the decode rate of the table-driven TSSC decoder with the original
+// bit-by-bit TSSC measurement parser. Optional arguments are the number of points and number of frames.
+int main(int argc, char* argv[])
+{
+    const uint32_t pointCount = argc > 1 ? stoul(argv[1]) : 1000;
+    const uint32_t frameCount = argc > 2 ? stoul(argv[2]) : 600;
+
+    cout << "Decoding " << frameCount << " frames of " << pointCount << " points, best of five runs" << endl << endl;
+    cout << setw(16) << "Values changing" << setw(16) << "Parser M/s" << setw(16) << "Decoder M/s" << setw(10) << "Speedup" << endl;
+
+    for (uint32_t changePercent : { 0U, 10U, 50U, 100U })
+    {
+        uint64_t measurementCount;
+        vector<Packet> packets = CreatePackets(pointCount, frameCount, changePercent, measurementCount);
+
+        const double parserRate = Measure(measurementCount, [&]
+        {
+            TSSCMeasurementParser parser;
+            uint64_t decoded = 0;
+            uint16_t id;
+            int64_t timestamp;
+            uint32_t quality;
+            float32_t value;
+
+            for (Packet& packet : packets)
+            {
+                parser.SetBuffer(packet.data(), 0, static_cast<uint32_t>(packet.size()));
+
+                while (parser.TryGetMeasurement(id, timestamp, quality, value))
+                    decoded++;
+            }
+
+            return decoded;
+        });
+
+        const double decoderRate = Measure(measurementCount, [&]
+        {
+            TSSCDecoder decoder;
+            uint64_t decoded = 0;
+
+            for (const Packet& packet : packets)
+                decoder.Decode(packet.data(), 0, static_cast<uint32_t>(packet.size()), [&](uint16_t, int64_t, uint32_t, float32_t) { decoded++; });
+
+            return decoded;
+        });
+
+        cout << setw(15) << changePercent << "%" << fixed << setprecision(1) << setw(16) << parserRate << setw(16) << decoderRate << setw(9) << setprecision(2) << (parserRate > 0.0 ? decoderRate / parserRate : 0.0) << "x" << endl;
+    }
+
+    return 0;
+}
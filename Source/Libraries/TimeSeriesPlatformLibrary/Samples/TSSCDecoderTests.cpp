@@ -0,0 +1,392 @@
+//******************************************************************************************************
+//  TSSCDecoderTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/16/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <random>
+#include <vector>
+#include <cassert>
+#include <cstring>
+#include <algorithm>
+
+#include "../Transport/TSSCMeasurementEncoder.h"
+#include "../Transport/TSSCMeasurementParser.h"
+#include "../Transport/TSSCDecoder.h"
+#include "../Transport/TSSCPartitionDecoder.h"
+
+#ifndef _WIN32
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+struct TestMeasurement
+{
+    uint16_t ID;
+    int64_t Timestamp;
+    uint32_t Quality;
+    float32_t Value;
+
+    bool operator==(const TestMeasurement& other) const
+    {
+        // Values are compared by their bits so that NaN payloads must match as well
+        return ID == other.ID && Timestamp == other.Timestamp && Quality == other.Quality && memcmp(&Value, &other.Value, sizeof(float32_t)) == 0;
+    }
+};
+
+typedef vector<uint8_t> Packet;
+
+// Holds a copy of data that ends where an inaccessible page begins, so that reading even one
+// byte past the end of the data faults. Without memory protection the data is followed by bytes
+// that are not part of the stream.
+class GuardedBuffer
+{
+private:
+    uint8_t* m_memory;
+    size_t m_size;
+    const uint8_t* m_data;
+    Packet m_fallback;
+
+public:
+    GuardedBuffer(const uint8_t* data, uint32_t length) :
+        m_memory(nullptr),
+        m_size(0),
+        m_data(nullptr)
+    {
+#ifndef _WIN32
+        const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+        const size_t dataPages = (length + pageSize - 1) / pageSize;
+
+        m_size = (dataPages + 1) * pageSize;
+        void* memory = mmap(nullptr, m_size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+        if (memory != MAP_FAILED)
+        {
+            m_memory = static_cast<uint8_t*>(memory);
+            mprotect(m_memory + dataPages * pageSize, pageSize, PROT_NONE);
+            m_data = m_memory + dataPages * pageSize - length;
+            memcpy(const_cast<uint8_t*>(m_data), data, length);
+            return;
+        }
+#endif
+        m_fallback.assign(data, data + length);
+        m_fallback.resize(length + 16, 0xFF);
+        m_data = m_fallback.data();
+    }
+
+    ~GuardedBuffer()
+    {
+#ifndef _WIN32
+        if (m_memory != nullptr)
+            munmap(m_memory, m_size);
+#endif
+    }
+
+    GuardedBuffer(const GuardedBuffer&) = delete;
+    GuardedBuffer& operator=(const GuardedBuffer&) = delete;
+
+    const uint8_t* Data() const
+    {
+        return m_data;
+    }
+};
+
+// Creates frames of measurements that exercise every TSSC code: point IDs that change by up to
+// sixteen bits, timestamps that step forward, back and jump, qualities that change now and then
+// and values that repeat, drift or change randomly.
+vector<TestMeasurement> CreateMeasurements(uint32_t seed, uint32_t frameCount, bool repeatValues)
+{
+    mt19937 random(seed);
+    vector<uint16_t> ids = { 0, 1, 2, 3, 7, 15, 16, 200, 255, 256, 1000, 4095, 4096, 40000, 65535 };
+    vector<TestMeasurement> measurements;
+    int64_t timestamp = 636854109250904770L;
+
+    for (uint16_t id = 20; id < 120; id++)
+        ids.push_back(id);
+
+    for (uint32_t frame = 0; frame < frameCount; frame++)
+    {
+        const uint32_t step = random() % 100;
+
+        if (step < 80)
+            timestamp += 333333;
+        else if (step < 90)
+            timestamp -= 333333;
+        else if (step < 98)
+            timestamp += random() % 10000000;
+        else
+            timestamp ^= static_cast<int64_t>(random()) << 20;
+
+        for (size_t i = 0; i < ids.size(); i++)
+        {
+            TestMeasurement measurement;
+            uint32_t bits;
+
+            // Most measurements stay in order, some are skipped or swapped with the next point
+            if (random() % 20 == 0)
+                continue;
+
+            measurement.ID = ids[random() % 50 == 0 ? random() % ids.size() : i];
+            measurement.Timestamp = random() % 25 == 0 ? timestamp + random() % 1000 : timestamp;
+            measurement.Quality = random() % 30 == 0 ? (random() % 3 == 0 ? random() : random() % 256) : 0;
+
+            if (repeatValues)
+                bits = static_cast<uint32_t>(measurement.ID % 7) << 24;
+            else if (random() % 3 == 0)
+                bits = random();
+            else
+                bits = 0x42480000 ^ (random() & ((1U << (random() % 32)) - 1));
+
+            memcpy(&measurement.Value, &bits, sizeof(float32_t));
+            measurements.push_back(measurement);
+        }
+    }
+
+    return measurements;
+}
+
+// Encodes the measurements into packets of at most the given size.
+vector<Packet> Encode(const vector<TestMeasurement>& measurements, uint32_t packetSize)
+{
+    TSSCMeasurementEncoder encoder;
+    vector<Packet> packets;
+    Packet packet(packetSize);
+
+    encoder.SetBuffer(packet.data(), 0, packetSize);
+
+    for (const TestMeasurement& measurement : measurements)
+    {
+        if (!encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, measurement.Value))
+        {
+            packet.resize(encoder.FinishBlock());
+            packets.push_back(packet);
+            packet.assign(packetSize, 0);
+            encoder.SetBuffer(packet.data(), 0, packetSize);
+
+            const bool added = encoder.TryAddMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, measurement.Value);
+            assert(added);
+        }
+    }
+
+    packet.resize(encoder.FinishBlock());
+    packets.push_back(packet);
+
+    return packets;
+}
+
+// Decodes every packet with the original bit-by-bit parser.
+vector<TestMeasurement> DecodeWithParser(vector<Packet>& packets)
+{
+    TSSCMeasurementParser parser;
+    vector<TestMeasurement> measurements;
+    TestMeasurement measurement;
+
+    for (Packet& packet : packets)
+    {
+        parser.SetBuffer(packet.data(), 0, static_cast<uint32_t>(packet.size()));
+
+        while (parser.TryGetMeasurement(measurement.ID, measurement.Timestamp, measurement.Quality, measurement.Value))
+            measurements.push_back(measurement);
+    }
+
+    return measurements;
+}
+
+// Decodes every packet with the table-driven decoder.
+vector<TestMeasurement> DecodeWithDecoder(const vector<Packet>& packets)
+{
+    TSSCDecoder decoder;
+    vector<TestMeasurement> measurements;
+
+    for (const Packet& packet : packets)
+    {
+        const bool succeeded = decoder.Decode(packet.data(), 0, static_cast<uint32_t>(packet.size()), [&](uint16_t id, int64_t timestamp, uint32_t quality, float32_t value)
+        {
+            measurements.push_back({ id, timestamp, quality, value });
+        });
+
+        assert(succeeded);
+    }
+
+    return measurements;
+}
+
+// Test application for the TSSC encoder, parser and decoder.
+int main()
+{
+    int32_t test = 0;
+
+    const vector<TestMeasurement> repeating = CreateMeasurements(1, 2000, true);
+    const vector<TestMeasurement> changing = CreateMeasurements(2, 2000, false);
+
+    for (const vector<TestMeasurement>* measurements : { &repeating, &changing })
+    {
+        vector<Packet> packets = Encode(*measurements, 16000);
+
+        // Test 1, 3: Encoded measurements decode to the same measurements
+        assert(packets.size() > 1);
+        assert(DecodeWithDecoder(packets) == *measurements);
+        cout << "Test " << ++test << " succeeded..." << endl;
+
+        // Test 2, 4: Decoder matches the parser it replaced measurement for measurement
+        assert(DecodeWithParser(packets) == DecodeWithDecoder(packets));
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 5: Measurements decoded one at a time or in blocks match
+    {
+        vector<Packet> packets = Encode(changing, 16000);
+        TSSCDecoder decoder;
+        size_t index = 0;
+
+        for (const Packet& packet : packets)
+        {
+            TestMeasurement measurement;
+
+            decoder.SetBuffer(packet.data(), 0, static_cast<uint32_t>(packet.size()));
+
+            while (decoder.DecodeNext(measurement.ID, measurement.Timestamp, measurement.Quality, measurement.Value) == TSSCDecodeResult::Measurement)
+            {
+                assert(index < changing.size() && measurement == changing[index]);
+                index++;
+            }
+        }
+
+        assert(index == changing.size());
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 6: Truncated packets fail without reading past the end
+    {
+        vector<TestMeasurement> measurements = CreateMeasurements(3, 10, false);
+
+        // Point IDs stay small so that each decoder only creates a few points
+        measurements.erase(remove_if(measurements.begin(), measurements.end(), [](const TestMeasurement& measurement) { return measurement.ID > 4096; }), measurements.end());
+
+        const vector<Packet> packets = Encode(measurements, 64000);
+        const Packet& packet = packets[0];
+        uint32_t failures = 0;
+
+        assert(packets.size() == 1);
+
+        for (uint32_t length = 0; length < packet.size(); length++)
+        {
+            const GuardedBuffer truncated(packet.data(), length);
+            TSSCDecoder decoder;
+            size_t index = 0;
+
+            const bool succeeded = decoder.Decode(truncated.Data(), 0, length, [&](uint16_t id, int64_t timestamp, uint32_t quality, float32_t value)
+            {
+                const TestMeasurement measurement = { id, timestamp, quality, value };
+                assert(index < measurements.size() && measurement == measurements[index]);
+                index++;
+            });
+
+            if (!succeeded)
+            {
+                assert(!decoder.GetErrorMessage().empty());
+                failures++;
+            }
+        }
+
+        assert(failures > 0);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 7: Random data is rejected or decoded without reading past the end
+    {
+        mt19937 random(4);
+
+        for (uint32_t i = 0; i < 2000; i++)
+        {
+            const uint32_t length = random() % 64;
+            Packet data(length);
+            TSSCDecoder decoder;
+
+            for (uint32_t j = 0; j < length; j++)
+                data[j] = static_cast<uint8_t>(random());
+
+            const GuardedBuffer guarded(data.data(), length);
+            decoder.Decode(guarded.Data(), 0, length, [](uint16_t, int64_t, uint32_t, float32_t) { });
+        }
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Test 8: Partition decoder decodes every partition after the partition count grows or shrinks
+    {
+        const vector<TestMeasurement> measurements = CreateMeasurements(5, 20, false);
+        TSSCPartitionDecoder partitionDecoder;
+
+        for (uint32_t round = 0; round < 200; round++)
+        {
+            const uint32_t partitionCount = round % 2 == 0 ? 3 : 8;
+            vector<TestMeasurement> expected;
+            vector<Packet> packets;
+
+            partitionDecoder.SetPartitionCount(partitionCount);
+            assert(partitionDecoder.GetPartitionCount() == partitionCount);
+
+            // Each partition carries the points whose IDs map to it, every partition starts a new stream
+            for (uint32_t partition = 0; partition < partitionCount; partition++)
+            {
+                vector<TestMeasurement> partitionMeasurements;
+
+                for (const TestMeasurement& measurement : measurements)
+                {
+                    if (measurement.ID % partitionCount == partition)
+                        partitionMeasurements.push_back(measurement);
+                }
+
+                packets.push_back(Encode(partitionMeasurements, 64000)[0]);
+                expected.insert(expected.end(), partitionMeasurements.begin(), partitionMeasurements.end());
+            }
+
+            for (uint32_t partition = 0; partition < partitionCount; partition++)
+                partitionDecoder.SetPartitionData(partition, packets[partition].data(), 0, static_cast<uint32_t>(packets[partition].size()));
+
+            partitionDecoder.Decode();
+
+            vector<TestMeasurement> decoded;
+
+            partitionDecoder.ForEachMeasurement([&decoded](uint16_t id, int64_t timestamp, uint32_t quality, float32_t value)
+            {
+                decoded.push_back({ id, timestamp, quality, value });
+            });
+
+            for (uint32_t partition = 0; partition < partitionCount; partition++)
+                assert(partitionDecoder.GetErrorMessage(partition).empty());
+
+            assert(decoded == expected);
+        }
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    cout << endl << "Tests complete." << endl;
+
+    return 0;
+}
@@ -0,0 +1,486 @@
+//******************************************************************************************************
+//  TransportTests.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/16/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include <iostream>
+#include <vector>
+#include <cassert>
+#include <cstdio>
+#include <cstring>
+#include <algorithm>
+
+#include "../Common/Convert.h"
+#include "../Transport/CompactMeasurement.h"
+#include "../Transport/Constants.h"
+#include "../Transport/DataSubscriber.h"
+#include "../Transport/DatagramSender.h"
+#include "../Transport/MetadataSnapshot.h"
+#include "../Transport/PayloadFramer.h"
+#include "../Transport/SignalIndexCache.h"
+#include "../Transport/SubscriberConnection.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// Adds keys for the given range of runtime IDs, with sources alternating between two devices.
+void AddKeys(SignalIndexCache& cache, uint16_t first, uint16_t last)
+{
+    for (uint32_t signalIndex = first; signalIndex <= last; signalIndex++)
+        cache.AddMeasurementKey(static_cast<uint16_t>(signalIndex), NewGuid(), signalIndex % 2 == 0 ? "PPA" : "STAT", signalIndex + 1);
+}
+
+// Serializes the full cache and parses it into a new cache, as the subscriber would receive it.
+SignalIndexCachePtr ParseFullCache(SignalIndexCache& cache, const SubscriberConnectionPtr& connection, Guid& subscriberID)
+{
+    const SignalIndexCachePtr parsed = NewSharedPtr<SignalIndexCache>();
+    vector<uint8_t> buffer;
+
+    cache.Serialize(connection, buffer);
+    parsed->Parse(buffer, subscriberID);
+
+    return parsed;
+}
+
+// Appends a payload with the given body, preceded by its payload header, to the stream.
+void AppendPayload(vector<uint8_t>& stream, const vector<uint8_t>& body)
+{
+    static const uint8_t PayloadMarker[] = { 0xAA, 0xBB, 0xCC, 0xDD };
+    const uint32_t offset = static_cast<uint32_t>(stream.size());
+
+    stream.resize(offset + Common::PayloadHeaderSize + body.size());
+
+    BinaryWriter writer(stream, offset);
+    writer.WriteBytes(PayloadMarker, 4);
+    writer.WriteLittleEndian(static_cast<uint32_t>(body.size()));
+    writer.WriteBytes(body);
+}
+
+// Creates a payload body of the given length with bytes that depend on their position and the seed.
+vector<uint8_t> CreatePayloadBody(uint32_t length, uint8_t seed)
+{
+    vector<uint8_t> body(length);
+
+    for (uint32_t i = 0; i < length; i++)
+        body[i] = static_cast<uint8_t>(i * 7 + seed);
+
+    return body;
+}
+
+// Creates a snapshot of two devices, each with a phasor and its measurements.
+void CreateSnapshot(MetadataSnapshot& snapshot)
+{
+    const DateTime updatedOn = ParseTimestamp("2026-10-16 12:00:00");
+
+    snapshot.NodeID = NewGuid();
+    snapshot.VersionNumber = 7;
+    snapshot.ConnectionKey = "localhost:6165;";
+
+    for (const string acronym : { "SHELBY", "DUNCAN" })
+    {
+        const DeviceMetadataPtr device = NewSharedPtr<DeviceMetadata>();
+        device->Acronym = acronym;
+        device->Name = acronym + " PMU";
+        device->UniqueID = NewGuid();
+        device->AccessID = static_cast<uint16_t>(snapshot.Devices.size() + 1);
+        device->FramesPerSecond = 30;
+        device->Longitude = -89.8;
+        device->Latitude = 35.4;
+        device->UpdatedOn = updatedOn;
+        snapshot.Devices.push_back(device);
+
+        const PhasorMetadataPtr phasor = NewSharedPtr<PhasorMetadata>();
+        phasor->DeviceAcronym = acronym;
+        phasor->Label = "BUS1";
+        phasor->Type = "V";
+        phasor->Phase = "+";
+        phasor->SourceIndex = 1;
+        phasor->UpdatedOn = updatedOn;
+        snapshot.Phasors.push_back(phasor);
+
+        for (const string kind : { "PA1", "PM1", "FQ" })
+        {
+            const MeasurementMetadataPtr measurement = NewSharedPtr<MeasurementMetadata>();
+            measurement->DeviceAcronym = acronym;
+            measurement->ID = "PPA:" + ToString(snapshot.Measurements.size() + 1);
+            measurement->SignalID = NewGuid();
+            measurement->PointTag = acronym + "-" + kind;
+            measurement->Reference = SignalReference(acronym + "-" + kind);
+            measurement->PhasorSourceIndex = kind == "FQ" ? 0 : 1;
+            measurement->UpdatedOn = updatedOn;
+            snapshot.Measurements.push_back(measurement);
+        }
+    }
+}
+
+// Test application for the transport classes shared by the publisher and subscriber.
+int main()
+{
+    IOContext ioContext;
+    const SubscriberConnectionPtr connection = NewSharedPtr<SubscriberConnection, DataPublisherPtr, IOContext&, IOContext&>(nullptr, ioContext, ioContext);
+    int32_t test = 0;
+
+    // Signal index cache deltas are an opt-in extension using an implementation specific bit
+    {
+        assert((OperationalModes::SignalIndexCacheDeltas & OperationalModes::ImplementationSpecificExtensionMask) == OperationalModes::SignalIndexCacheDeltas);
+        assert(!SubscriptionInfo().SignalIndexCacheDeltas);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Signal index cache delta adds, removes and changes keys
+    {
+        SignalIndexCache previous;
+        AddKeys(previous, 0, 99);
+
+        SignalIndexCache current(previous);
+        Guid signalID;
+        string source;
+        uint32_t id;
+
+        // Removed keys, both as a range and on their own
+        uint32_t removed = 0;
+
+        for (uint16_t signalIndex = 10; signalIndex <= 19; signalIndex++)
+            removed += current.RemoveMeasurementKey(signalIndex) ? 1 : 0;
+
+        removed += current.RemoveMeasurementKey(50) ? 1 : 0;
+        removed += current.RemoveMeasurementKey(50) ? 1 : 0;
+        assert(removed == 11);
+
+        // Added keys
+        AddKeys(current, 100, 104);
+
+        // Changed signal ID, source and ID
+        current.GetMeasurementKey(5, signalID, source, id);
+        current.AddMeasurementKey(5, NewGuid(), source, id);
+        current.GetMeasurementKey(6, signalID, source, id);
+        current.AddMeasurementKey(6, signalID, "NEW", id);
+        current.GetMeasurementKey(7, signalID, source, id);
+        current.AddMeasurementKey(7, signalID, source, id + 1000);
+
+        Guid subscriberID;
+        const SignalIndexCachePtr received = ParseFullCache(previous, connection, subscriberID);
+        vector<uint8_t> delta;
+        const bool serialized = current.SerializeDelta(connection, previous, delta);
+
+        assert(received->IsEquivalent(previous));
+        assert(serialized);
+
+        // 11 removed keys in two ranges and eight added or changed keys are smaller than the full cache
+        vector<uint8_t> full;
+        current.Serialize(connection, full);
+        assert(delta.size() < full.size() / 4);
+
+        // Delta carries the subscriber ID the same way as the full cache
+        Guid deltaSubscriberID;
+        received->ApplyDelta(delta.data(), 0, static_cast<uint32_t>(delta.size()), deltaSubscriberID);
+
+        assert(deltaSubscriberID == subscriberID);
+        assert(received->IsEquivalent(current));
+        assert(received->Count() == current.Count());
+        assert(!received->Contains(15) && !received->Contains(50) && received->Contains(104));
+        assert(received->GetSource(6) == "NEW" && received->GetID(7) == 1008);
+        assert(received->GetSignalIndex(current.GetSignalID(5)) == 5);
+        assert(received->GetSignalIndex(previous.GetSignalID(5)) == UInt16::MaxValue);
+
+        // Binary length estimate matches the estimate of the same keys parsed from the full cache
+        Guid parsedID;
+        assert(received->GetBinaryLength() == ParseFullCache(current, connection, parsedID)->GetBinaryLength());
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Signal index cache delta is not used when it would be larger than the full cache
+    {
+        SignalIndexCache previous;
+        SignalIndexCache current;
+        vector<uint8_t> delta;
+
+        AddKeys(previous, 0, 99);
+        AddKeys(current, 200, 209);
+
+        const bool serialized = current.SerializeDelta(connection, previous, delta);
+        assert(!serialized);
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Removing a key takes back the binary length estimate its addition used
+    {
+        SignalIndexCache cache;
+        const uint32_t emptyLength = cache.GetBinaryLength();
+
+        cache.AddMeasurementKey(1, NewGuid(), "PPA", 1, 2);
+        cache.AddMeasurementKey(2, NewGuid(), "STATION", 2, 2);
+        assert(cache.GetBinaryLength() == emptyLength + 2 * 26 + 3 * 2 + 7 * 2);
+
+        cache.RemoveMeasurementKey(1, 2);
+        cache.RemoveMeasurementKey(2, 2);
+        assert(cache.GetBinaryLength() == emptyLength);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Connections share data packets once subscribed with the same format
+    {
+        const SignalIndexCachePtr cache = NewSharedPtr<SignalIndexCache>();
+        const SubscriberConnectionPtr first = NewSharedPtr<SubscriberConnection, DataPublisherPtr, IOContext&, IOContext&>(nullptr, ioContext, ioContext);
+        const SubscriberConnectionPtr second = NewSharedPtr<SubscriberConnection, DataPublisherPtr, IOContext&, IOContext&>(nullptr, ioContext, ioContext);
+
+        AddKeys(*cache, 0, 9);
+
+        for (const SubscriberConnectionPtr& subscriber : { first, second })
+        {
+            subscriber->SetSignalIndexCache(cache);
+            assert(!first->SharesDataPacketFormat(*second));
+            subscriber->SetIsSubscribed(true);
+        }
+
+        assert(first->SharesDataPacketFormat(*second) && second->SharesDataPacketFormat(*first));
+
+        // Format only changes once the subscription is complete
+        second->SetIncludeTime(!first->GetIncludeTime());
+        assert(first->SharesDataPacketFormat(*second));
+
+        second->SetIsSubscribed(true);
+        assert(!first->SharesDataPacketFormat(*second));
+
+        second->SetIncludeTime(first->GetIncludeTime());
+        second->SetIsSubscribed(true);
+        assert(first->SharesDataPacketFormat(*second));
+
+        // TSSC compressed and unsubscribed connections do not share data packets
+        second->SetUsePayloadCompression(true);
+        second->SetOperationalModes(second->GetOperationalModes() | CompressionModes::TSSC);
+        assert(!first->SharesDataPacketFormat(*second));
+
+        second->SetOperationalModes(second->GetOperationalModes() & ~CompressionModes::TSSC);
+        assert(first->SharesDataPacketFormat(*second));
+
+        first->SetIsSubscribed(false);
+        assert(!first->SharesDataPacketFormat(*second) && !second->SharesDataPacketFormat(*first));
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Metadata snapshot loads back equivalent to the saved snapshot, only for the same connection key
+    {
+        const string fileName = "TransportTests.snapshot";
+        MetadataSnapshot saved, loaded, otherConnection;
+
+        CreateSnapshot(saved);
+        saved.Save(fileName);
+
+        const bool loadSucceeded = loaded.Load(fileName, saved.ConnectionKey);
+        const bool otherConnectionLoaded = otherConnection.Load(fileName, "localhost:6166;");
+        remove(fileName.c_str());
+
+        assert(loadSucceeded);
+        assert(loaded.IsEquivalent(saved));
+        assert(loaded.NodeID == saved.NodeID && loaded.VersionNumber == saved.VersionNumber);
+        assert(loaded.Devices.size() == 2 && loaded.Measurements.size() == 6 && loaded.Phasors.size() == 2);
+        assert(loaded.Measurements[4]->PointTag == "DUNCAN-PM1" && loaded.Measurements[4]->SignalID == saved.Measurements[4]->SignalID);
+        assert(!otherConnectionLoaded && otherConnection.Devices.empty());
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Metadata snapshot differs from publisher metadata with another node ID, version or record
+    {
+        MetadataSnapshot snapshot;
+        CreateSnapshot(snapshot);
+
+        MetadataSnapshot other = snapshot;
+        assert(other.IsEquivalent(snapshot));
+
+        other.NodeID = NewGuid();
+        assert(!other.IsEquivalent(snapshot));
+
+        other.NodeID = snapshot.NodeID;
+        other.VersionNumber++;
+        assert(!other.IsEquivalent(snapshot));
+
+        other.VersionNumber = snapshot.VersionNumber;
+        other.Measurements[2] = NewSharedPtr<MeasurementMetadata>(*snapshot.Measurements[2]);
+        other.Measurements[2]->Description = "Frequency";
+        assert(!other.IsEquivalent(snapshot));
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Payload framer extracts payloads split across reads, including one larger than its buffer
+    {
+        const uint32_t chunkSizes[] = { 1, 5, 3000, 70000 };
+        vector<vector<uint8_t>> bodies, payloads;
+        vector<uint8_t> stream;
+        PayloadFramer framer(Common::MaxPacketSize);
+        uint32_t position = 0;
+        uint64_t reads = 0UL;
+
+        for (const uint32_t length : { 6U, 100U, 40000U, 100000U, 7U })
+        {
+            bodies.push_back(CreatePayloadBody(length, static_cast<uint8_t>(bodies.size())));
+            AppendPayload(stream, bodies.back());
+        }
+
+        while (position < stream.size())
+        {
+            const boost::asio::mutable_buffer readBuffer = framer.GetReadBuffer();
+            const uint32_t length = min({ chunkSizes[reads % 4], static_cast<uint32_t>(readBuffer.size()), static_cast<uint32_t>(stream.size()) - position });
+            uint8_t* payload;
+            uint32_t payloadLength;
+
+            memcpy(readBuffer.data(), stream.data() + position, length);
+            framer.CommitRead(length);
+            position += length;
+            reads++;
+
+            // Payloads are only valid until the next read
+            while (framer.TryGetPayload(payload, payloadLength))
+                payloads.emplace_back(payload, payload + payloadLength);
+        }
+
+        assert(payloads == bodies);
+        assert(framer.GetTotalPayloads() == bodies.size() && framer.GetTotalReads() == reads);
+
+        // Many small payloads are all completed by a single read
+        stream.clear();
+        framer.Reset();
+
+        for (uint8_t i = 0; i < 10; i++)
+            AppendPayload(stream, CreatePayloadBody(10, i));
+
+        const boost::asio::mutable_buffer readBuffer = framer.GetReadBuffer();
+        uint8_t* payload;
+        uint32_t payloadLength, payloadCount = 0;
+
+        memcpy(readBuffer.data(), stream.data(), stream.size());
+        framer.CommitRead(static_cast<uint32_t>(stream.size()));
+
+        while (framer.TryGetPayload(payload, payloadLength))
+        {
+            assert(payloadLength == 10 && payload[1] == static_cast<uint8_t>(7 + payloadCount));
+            payloadCount++;
+        }
+
+        assert(payloadCount == 10 && framer.GetLastReadPayloads() == 10 && framer.GetMaxPayloadsPerRead() == 10);
+        assert(framer.GetAveragePayloadsPerRead() == 10.0);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Datagram sender sends a full batch in order and releases the send buffer it referenced
+    {
+        UdpSocket receiver(ioContext, UdpEndPoint(boost::asio::ip::make_address("127.0.0.1"), 0));
+        DatagramSender sender(ioContext);
+        const SharedPtr<vector<uint8_t>> sendBuffer = NewSharedPtr<vector<uint8_t>>(CreatePayloadBody(DatagramSender::MaxBatchSize * 4, 1));
+        string errorMessage;
+        uint32_t fullBatches = 0;
+
+        assert(!sender.IsOpen());
+
+        sender.Open(receiver.local_endpoint());
+        assert(sender.IsOpen() && sender.GetDestination() == receiver.local_endpoint());
+
+        for (uint32_t i = 0; i < DatagramSender::MaxBatchSize; i++)
+        {
+            if (sender.Add(sendBuffer, i * 4, 4))
+                fullBatches++;
+        }
+
+        assert(fullBatches == 1 && sendBuffer.use_count() > 1);
+
+        const bool flushed = sender.Flush(errorMessage);
+        assert(flushed && errorMessage.empty());
+        assert(sender.GetTotalBytesSent() == sendBuffer->size() && sendBuffer.use_count() == 1);
+
+        for (uint32_t i = 0; i < DatagramSender::MaxBatchSize; i++)
+        {
+            uint8_t datagram[16];
+            UdpEndPoint source;
+
+            const size_t length = receiver.receive_from(boost::asio::buffer(datagram), source);
+            assert(length == 4 && memcmp(datagram, sendBuffer->data() + i * 4, 4) == 0);
+        }
+
+        // Flushing an empty batch sends nothing
+        const bool flushedEmpty = sender.Flush(errorMessage);
+        assert(flushedEmpty && sender.GetTotalBytesSent() == sendBuffer->size());
+
+        sender.Close();
+        assert(!sender.IsOpen());
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    // Compact measurements offset from base times that are not yet defined are skipped, not parsed
+    {
+        const SignalIndexCachePtr cache = NewSharedPtr<SignalIndexCache>();
+        AddKeys(*cache, 0, 3);
+
+        const int64_t timestamp = 638000000000000000L;
+        int64_t baseTimeOffsets[2] = { timestamp - 1000L, 0L };
+        vector<uint8_t> buffer;
+
+        // Two measurements offset from the base time, then one with a full timestamp
+        const CompactMeasurement serializer(cache, baseTimeOffsets);
+        serializer.SerializeMeasurement(timestamp, 1.0F, 0U, buffer, 0);
+        serializer.SerializeMeasurement(timestamp, 2.0F, 0U, buffer, 1);
+        serializer.SerializeMeasurement(timestamp - 1000L, 3.0F, 0U, buffer, 2);
+
+        const uint32_t length = static_cast<uint32_t>(buffer.size());
+        uint16_t signalIndexes[3];
+        int64_t timestamps[3];
+        float64_t values[3];
+        uint32_t flags[3];
+        uint32_t offset = 0;
+
+        // Parsing stops at the first offset measurement until the base times are received
+        baseTimeOffsets[0] = 0L;
+        const CompactMeasurement parser(cache, baseTimeOffsets);
+
+        assert(parser.ParseMeasurements(buffer.data(), offset, length, signalIndexes, timestamps, values, flags, 3) == 0 && offset == 0);
+        assert(parser.SkipMeasurementsWithoutBaseTime(buffer.data(), offset, length) == 2);
+        assert(parser.SkipMeasurementsWithoutBaseTime(buffer.data(), offset, length) == 0);
+        assert(parser.ParseMeasurements(buffer.data(), offset, length, signalIndexes, timestamps, values, flags, 3) == 1 && offset == length);
+        assert(signalIndexes[0] == 2 && timestamps[0] == timestamp - 1000L && values[0] == 3.0);
+
+        // Without timestamps the base times are not needed
+        const CompactMeasurement withoutTime(cache, baseTimeOffsets, false);
+        buffer.clear();
+        offset = 0;
+
+        baseTimeOffsets[0] = timestamp - 1000L;
+        withoutTime.SerializeMeasurement(timestamp, 4.0F, 0U, buffer, 3);
+        baseTimeOffsets[0] = 0L;
+
+        assert(withoutTime.SkipMeasurementsWithoutBaseTime(buffer.data(), offset, static_cast<uint32_t>(buffer.size())) == 0);
+        assert(withoutTime.ParseMeasurements(buffer.data(), offset, static_cast<uint32_t>(buffer.size()), signalIndexes, timestamps, values, flags, 3) == 1);
+        assert(signalIndexes[0] == 3 && values[0] == 4.0);
+
+        cout << "Test " << ++test << " succeeded..." << endl;
+    }
+
+    cout << endl << "Tests complete." << endl;
+
+    return 0;
+}
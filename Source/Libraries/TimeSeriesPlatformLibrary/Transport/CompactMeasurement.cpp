@@ -18,11 +18,16 @@
 //  ----------------------------------------------------------------------------------------------------
 //  03/09/2012 - Stephen C. Wills
 //       Generated original version of source code.
+//  10/15/2026 - GSF Development Team
+//       Added serialize overload that takes the runtime components of a measurement.
+//       Added batch parser that reads a whole packet of measurements into contiguous arrays.
+//       Serialization now writes in place through a BinaryWriter.
+//       Tick resolution base time offsets now use the full four byte range of the serialized offset.
 //
 //******************************************************************************************************
 
 #include "CompactMeasurement.h"
-#include "../Common/EndianConverter.h"
+#include "../Common/BinaryCodec.h"
 
 using namespace std;
 using namespace GSF::TimeSeries;
@@ -100,6 +105,21 @@ inline uint32_t MapToCompactFlags(uint32_t fullFlags)
     return compactFlags;
 }
 
+// Full 32-bit measurement flags for each of the 256 compact flag values.
+class FullFlagsTable
+{
+public:
+    uint32_t Flags[256];
+
+    FullFlagsTable()
+    {
+        for (uint32_t compactFlags = 0; compactFlags < 256; compactFlags++)
+            Flags[compactFlags] = MapToFullFlags(static_cast<uint8_t>(compactFlags));
+    }
+};
+
+static const FullFlagsTable FullFlags;
+
 CompactMeasurement::CompactMeasurement(SignalIndexCachePtr signalIndexCache, int64_t* baseTimeOffsets, bool includeTime, bool useMillisecondResolution, int32_t timeIndex) :
     m_signalIndexCache(std::move(signalIndexCache)),
     m_baseTimeOffsets(baseTimeOffsets),
@@ -136,6 +156,41 @@ uint32_t CompactMeasurement::GetBinaryLength(const bool usingBaseTimeOffset) con
 // that there is not enough data to parse the measurement. Offset and length will be
 // updated by this method to indicate how many bytes were used when parsing.
 bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, uint32_t length, MeasurementPtr& measurement) const
+{
+    const MeasurementPtr parsedMeasurement = NewSharedPtr<Measurement>();
+
+    if (!TryParseMeasurement(data, offset, length, *parsedMeasurement))
+        return false;
+
+    measurement = parsedMeasurement;
+    return true;
+}
+
+// Attempts to parse a measurement from the buffer into an existing measurement. Return
+// value of false indicates that there is not enough data to parse the measurement.
+bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, uint32_t length, Measurement& measurement) const
+{
+    uint16_t signalIndex;
+    int64_t timestamp;
+    float32_t value;
+    uint32_t flags;
+
+    if (!TryParseMeasurement(data, offset, length, signalIndex, timestamp, value, flags))
+        return false;
+
+    // Key is read directly into the target measurement so its source string capacity is reused
+    m_signalIndexCache->GetMeasurementKey(signalIndex, measurement.SignalID, measurement.Source, measurement.ID);
+
+    measurement.Flags = flags;
+    measurement.Value = value;
+    measurement.Timestamp = timestamp;
+
+    return true;
+}
+
+// Attempts to parse the runtime components of a measurement from the buffer. Return
+// value of false indicates that there is not enough data to parse the measurement.
+bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, uint32_t length, uint16_t& signalIndex, int64_t& timestamp, float32_t& value, uint32_t& flags) const
 {
     // Ensure that we at least have enough
     // data to read the compact state flags
@@ -148,8 +203,8 @@ bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, ui
     const int32_t timeIndex = compactFlags & CompactTimeIndexFlag ? 1 : 0;
     const bool usingBaseTimeOffset = (compactFlags & CompactBaseTimeOffsetFlag) != 0;    
 
-    // If we are using base time offsets, ensure that it is defined
-    if (usingBaseTimeOffset && (m_baseTimeOffsets == nullptr || m_baseTimeOffsets[timeIndex] == 0))
+    // If we are using base time offsets for the timestamp, ensure that it is defined
+    if (usingBaseTimeOffset && m_includeTime && (m_baseTimeOffsets == nullptr || m_baseTimeOffsets[timeIndex] == 0))
         return false;
 
     // Ensure that we have enough data to read the rest of the measurement
@@ -157,65 +212,174 @@ bool CompactMeasurement::TryParseMeasurement(uint8_t* data, uint32_t& offset, ui
         return false;
 
     // Read the signal index from the buffer
-    const uint16_t signalIndex = EndianConverter::ToBigEndian<uint16_t>(data, offset + 1);
+    signalIndex = ByteOrder::LoadBigEndian<uint16_t>(data + offset + 1);
 
     // If the signal index is not found in the cache, we cannot parse the measurement
     if (!m_signalIndexCache->Contains(signalIndex))
         return false;
 
-    Guid signalID;
-    string measurementSource;
-    uint32_t measurementID;
-    int64_t timestamp = 0;
-
     // Now that we've validated our failure conditions we can safely start advancing the offset
-    m_signalIndexCache->GetMeasurementKey(signalIndex, signalID, measurementSource, measurementID);
     offset += 3;
 
     // Read the measurement value from the buffer
-    const float32_t measurementValue = EndianConverter::ToBigEndian<float32_t>(data, offset);
+    value = ByteOrder::LoadBigEndian<float32_t>(data + offset);
     offset += 4;
 
+    timestamp = 0;
+
     if (m_includeTime)
     {
         if (!usingBaseTimeOffset)
         {
             // Read full 8-byte timestamp from the buffer
-            timestamp = EndianConverter::ToBigEndian<int64_t>(data, offset);
+            timestamp = ByteOrder::LoadBigEndian<int64_t>(data + offset);
             offset += 8;
         }
         else if (!m_useMillisecondResolution)
         {
             // Read 4-byte offset from the buffer and apply the appropriate base time offset
-            timestamp = EndianConverter::ToBigEndian<uint32_t>(data, offset);
+            timestamp = ByteOrder::LoadBigEndian<uint32_t>(data + offset);
             timestamp += m_baseTimeOffsets[timeIndex]; //-V522
             offset += 4;
         }
         else
         {
             // Read 2-byte offset from the buffer, convert from milliseconds to ticks, and apply the appropriate base time offset
-            timestamp = EndianConverter::ToBigEndian<uint16_t>(data, offset);
+            timestamp = ByteOrder::LoadBigEndian<uint16_t>(data + offset);
             timestamp *= 10000;
             timestamp += m_baseTimeOffsets[timeIndex];
             offset += 2;
         }
     }
 
-    measurement = NewSharedPtr<Measurement>();
-    measurement->Flags = MapToFullFlags(compactFlags);
-    measurement->SignalID = signalID;
-    measurement->Source = measurementSource;
-    measurement->ID = measurementID;
-    measurement->Value = measurementValue;
-    measurement->Timestamp = timestamp;
+    flags = MapToFullFlags(compactFlags);
 
     return true;
 }
 
+// Parses consecutive measurements from the buffer into the arrays. Each measurement is validated
+// exactly as TryParseMeasurement does, so parsing stops at a truncated or malformed measurement.
+uint32_t CompactMeasurement::ParseMeasurements(const uint8_t* data, uint32_t& offset, const uint32_t length, uint16_t* signalIndexes, int64_t* timestamps, float64_t* values, uint32_t* flags, const uint32_t capacity) const
+{
+    const SignalIndexCache& signalIndexCache = *m_signalIndexCache;
+    const uint32_t fullLength = GetBinaryLength(false);
+    const uint32_t offsetLength = GetBinaryLength(true);
+
+    // Undefined base time offsets are zero, which marks them invalid
+    const int64_t baseTimeOffsets[2] =
+    {
+        m_baseTimeOffsets == nullptr ? 0L : m_baseTimeOffsets[0],
+        m_baseTimeOffsets == nullptr ? 0L : m_baseTimeOffsets[1]
+    };
+
+    uint32_t position = offset;
+    uint32_t count = 0;
+
+    while (count < capacity && position < length)
+    {
+        const uint8_t* measurement = data + position;
+        const uint8_t compactFlags = measurement[0];
+        const int32_t timeIndex = compactFlags >> 7;
+        const bool usingBaseTimeOffset = (compactFlags & CompactBaseTimeOffsetFlag) != 0;
+        const uint32_t measurementLength = usingBaseTimeOffset ? offsetLength : fullLength;
+
+        if (usingBaseTimeOffset && m_includeTime && baseTimeOffsets[timeIndex] == 0)
+            break;
+
+        // Whole measurement is bounds checked once, fields below are read unchecked
+        if (length - position < measurementLength)
+            break;
+
+        const uint16_t signalIndex = ByteOrder::LoadBigEndian<uint16_t>(measurement + 1);
+
+        if (!signalIndexCache.Contains(signalIndex))
+            break;
+
+        const float32_t value = ByteOrder::LoadBigEndian<float32_t>(measurement + 3);
+
+        int64_t timestamp = 0L;
+
+        if (m_includeTime)
+        {
+            if (!usingBaseTimeOffset)
+                timestamp = ByteOrder::LoadBigEndian<int64_t>(measurement + 7);
+            else if (!m_useMillisecondResolution)
+                timestamp = ByteOrder::LoadBigEndian<uint32_t>(measurement + 7) + baseTimeOffsets[timeIndex];
+            else
+                timestamp = static_cast<int64_t>(ByteOrder::LoadBigEndian<uint16_t>(measurement + 7)) * 10000L + baseTimeOffsets[timeIndex];
+        }
+
+        signalIndexes[count] = signalIndex;
+        timestamps[count] = timestamp;
+        values[count] = value;
+        flags[count] = FullFlags.Flags[compactFlags];
+
+        position += measurementLength;
+        count++;
+    }
+
+    offset = position;
+
+    return count;
+}
+
+// Skips consecutive measurements whose timestamps are offsets from a base time that is not yet defined.
+uint32_t CompactMeasurement::SkipMeasurementsWithoutBaseTime(const uint8_t* data, uint32_t& offset, const uint32_t length) const
+{
+    const uint32_t offsetLength = GetBinaryLength(true);
+    uint32_t count = 0;
+
+    if (!m_includeTime)
+        return count;
+
+    while (offset < length)
+    {
+        const uint8_t compactFlags = data[offset];
+        const int32_t timeIndex = compactFlags >> 7;
+
+        if ((compactFlags & CompactBaseTimeOffsetFlag) == 0 || (m_baseTimeOffsets != nullptr && m_baseTimeOffsets[timeIndex] != 0))
+            break;
+
+        if (length - offset < offsetLength)
+            break;
+
+        offset += offsetLength;
+        count++;
+    }
+
+    return count;
+}
+
 uint32_t CompactMeasurement::SerializeMeasurement(const Measurement& measurement, vector<uint8_t>& buffer, const uint16_t runtimeID) const
+{
+    // Encode adjusted value (accounts for adder and multiplier)
+    return SerializeMeasurement(measurement.Timestamp, static_cast<float32_t>(measurement.AdjustedValue()), measurement.Flags, buffer, runtimeID);
+}
+
+uint32_t CompactMeasurement::SerializeMeasurement(const int64_t timestamp, const float32_t value, const uint32_t flags, vector<uint8_t>& buffer, const uint16_t runtimeID) const
+{
+    const uint32_t offset = static_cast<uint32_t>(buffer.size());
+
+    buffer.resize(offset + MaximumBinaryLength);
+
+    BinaryWriter writer(buffer, offset);
+    const uint32_t length = SerializeMeasurement(timestamp, value, flags, writer, runtimeID);
+
+    buffer.resize(offset + length);
+
+    return length;
+}
+
+uint32_t CompactMeasurement::SerializeMeasurement(const Measurement& measurement, BinaryWriter& writer, const uint16_t runtimeID) const
+{
+    // Encode adjusted value (accounts for adder and multiplier)
+    return SerializeMeasurement(measurement.Timestamp, static_cast<float32_t>(measurement.AdjustedValue()), measurement.Flags, writer, runtimeID);
+}
+
+uint32_t CompactMeasurement::SerializeMeasurement(const int64_t timestamp, const float32_t value, const uint32_t flags, BinaryWriter& writer, const uint16_t runtimeID) const
 {
     // Define the compact state flags
-    uint8_t compactFlags = MapToCompactFlags(measurement.Flags);
+    uint8_t compactFlags = MapToCompactFlags(flags);
 
     int64_t difference = 0L;
     bool usingBaseTimeOffset = false;
@@ -224,10 +388,10 @@ uint32_t CompactMeasurement::SerializeMeasurement(const Measurement& measurement
     {
         // See if timestamp will fit within space allowed for active base offset. We cache result so that post call
         // to binary length, result will speed other subsequent parsing operations by not having to reevaluate.
-        difference = measurement.Timestamp - m_baseTimeOffsets[m_timeIndex];
+        difference = timestamp - m_baseTimeOffsets[m_timeIndex];
         
         usingBaseTimeOffset = difference > 0 ? 
-            (m_useMillisecondResolution ? difference / Ticks::PerMillisecond < UInt16::MaxValue : difference < UInt16::MaxValue) : false;
+            (m_useMillisecondResolution ? difference / Ticks::PerMillisecond < UInt16::MaxValue : difference < UInt32::MaxValue) : false;
     }
 
     const uint32_t length = GetBinaryLength(usingBaseTimeOffset);
@@ -239,13 +403,13 @@ uint32_t CompactMeasurement::SerializeMeasurement(const Measurement& measurement
         compactFlags |= CompactTimeIndexFlag;
 
     // Added encoded compact state flags to beginning of buffer
-    buffer.push_back(compactFlags);
+    writer.WriteByte(compactFlags);
 
     // Encode runtime ID
-    EndianConverter::WriteBigEndianBytes(buffer, runtimeID);
+    writer.WriteBigEndian(runtimeID);
 
-    // Encode adjusted value (accounts for adder and multiplier)
-    EndianConverter::WriteBigEndianBytes(buffer, static_cast<float32_t>(measurement.AdjustedValue()));
+    // Encode value
+    writer.WriteBigEndian(value);
 
     if (!m_includeTime)
         return length;
@@ -255,18 +419,18 @@ uint32_t CompactMeasurement::SerializeMeasurement(const Measurement& measurement
         if (m_useMillisecondResolution)
         {
             // Encode 2-byte millisecond offset timestamp
-            EndianConverter::WriteBigEndianBytes(buffer, static_cast<uint16_t>(difference / Ticks::PerMillisecond));
+            writer.WriteBigEndian(static_cast<uint16_t>(difference / Ticks::PerMillisecond));
         }
         else
         {
             // Encode 4-byte ticks offset timestamp
-            EndianConverter::WriteBigEndianBytes(buffer, static_cast<uint32_t>(difference));
+            writer.WriteBigEndian(static_cast<uint32_t>(difference));
         }
     }
     else
     {
         // Encode 8-byte full fidelity timestamp
-        EndianConverter::WriteBigEndianBytes(buffer, measurement.Timestamp);
+        writer.WriteBigEndian(timestamp);
     }
 
     return length;
@@ -20,6 +20,11 @@
 //       Generated original version of source code.
 //  02/06/2019 - J. Ritchie Carroll
 //       Added format serialization method.
+//  10/15/2026 - GSF Development Team
+//       Added parse overloads that populate an existing measurement or its runtime components.
+//       Added serialize overload that takes the runtime components of a measurement.
+//       Added batch parser that reads a whole packet of measurements into contiguous arrays.
+//       Added serialize overloads that write in place through a BinaryWriter.
 //
 //******************************************************************************************************
 
@@ -28,6 +33,7 @@
 
 #include "TransportTypes.h"
 #include "SignalIndexCache.h"
+#include "../Common/BinaryCodec.h"
 
 namespace GSF {
 namespace TimeSeries {
@@ -47,6 +53,12 @@ namespace Transport
         uint32_t GetBinaryLength(bool usingBaseTimeOffset) const;
 
     public:
+        // Byte length of the smallest compact measurement, i.e., one without a timestamp.
+        static const uint32_t MinimumBinaryLength = 7;
+
+        // Byte length of the largest compact measurement, i.e., one with a full timestamp.
+        static const uint32_t MaximumBinaryLength = 15;
+
         // Creates a new instance of the compact measurement parser.
         CompactMeasurement(SignalIndexCachePtr signalIndexCache, int64_t* baseTimeOffsets = nullptr, bool includeTime = true, bool useMillisecondResolution = false, int32_t timeIndex = 0);
 
@@ -55,8 +67,36 @@ namespace Transport
         // updated by this method to indicate how many bytes were used when parsing.
         bool TryParseMeasurement(uint8_t* data, uint32_t& offset, uint32_t length, MeasurementPtr& measurement) const;
 
+        // Attempts to parse a measurement from the buffer into an existing measurement, e.g., one
+        // drawn from a pool. Measurement is not modified when the return value is false.
+        bool TryParseMeasurement(uint8_t* data, uint32_t& offset, uint32_t length, Measurement& measurement) const;
+
+        // Attempts to parse the runtime components of a measurement from the buffer without
+        // resolving its measurement key. Signal index is validated against the cache.
+        bool TryParseMeasurement(uint8_t* data, uint32_t& offset, uint32_t length, uint16_t& signalIndex, int64_t& timestamp, float32_t& value, uint32_t& flags) const;
+
+        // Parses consecutive measurements from the buffer into the arrays, stopping at the end of the data,
+        // once capacity measurements have been parsed or at the first measurement that cannot be parsed.
+        // Returns the number of measurements parsed, offset is updated to the position after the last one.
+        uint32_t ParseMeasurements(const uint8_t* data, uint32_t& offset, uint32_t length, uint16_t* signalIndexes, int64_t* timestamps, float64_t* values, uint32_t* flags, uint32_t capacity) const;
+
+        // Skips consecutive measurements whose timestamps are offsets from a base time that is not yet
+        // defined, e.g., those of data packets received before the first base times. Returns the number
+        // of measurements skipped, offset is updated to the position after the last one.
+        uint32_t SkipMeasurementsWithoutBaseTime(const uint8_t* data, uint32_t& offset, uint32_t length) const;
+
         // Serializes a measurement into a buffer
         uint32_t SerializeMeasurement(const Measurement& measurement, std::vector<uint8_t>& buffer, uint16_t runtimeID) const;
+
+        // Serializes the runtime components of a measurement into a buffer
+        uint32_t SerializeMeasurement(int64_t timestamp, float32_t value, uint32_t flags, std::vector<uint8_t>& buffer, uint16_t runtimeID) const;
+
+        // Serializes a measurement in place through the writer, which
+        // must have at least MaximumBinaryLength bytes remaining
+        uint32_t SerializeMeasurement(const Measurement& measurement, BinaryWriter& writer, uint16_t runtimeID) const;
+
+        // Serializes the runtime components of a measurement in place through the writer
+        uint32_t SerializeMeasurement(int64_t timestamp, float32_t value, uint32_t flags, BinaryWriter& writer, uint16_t runtimeID) const;
     };
 }}}
 
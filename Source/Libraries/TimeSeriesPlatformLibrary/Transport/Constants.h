@@ -18,6 +18,9 @@
 //  ----------------------------------------------------------------------------------------------------
 //  03/29/2012 - Stephen C. Wills
 //       Generated original version of source code.
+//  10/15/2026 - GSF Development Team
+//       Added signal index cache delta operational mode and response.
+//       Added slow consumer policies for subscriber connection send queues.
 //
 //******************************************************************************************************
 
@@ -146,6 +149,10 @@ namespace Transport
         static const uint8_t UserResponse13 = 0xED;
         static const uint8_t UserResponse14 = 0xEE;
         static const uint8_t UserResponse15 = 0xEF;
+        // Update signal index cache delta response. Implementation specific response, sent in place of UpdateSignalIndexCache only to subscribers that set the SignalIndexCacheDeltas operational mode, that carries only the runtime IDs removed from and the keys added to the subscriber's current signal index cache. Since it is not part of the protocol, it takes the last user-defined response code.
+        static const uint8_t UpdateSignalIndexCacheDelta = UserResponse15;
+        // Update multicast group response. Implementation specific response, sent just before the response to a subscribe command only to subscribers that requested a multicast data channel, that carries the port (2 bytes, big endian) followed by the IPv4 (4 bytes) or IPv6 (16 bytes) address of the multicast group to which the subscriber's data packets are published. Since it is not part of the protocol, it takes the next-to-last user-defined response code.
+        static const uint8_t UpdateMulticastGroup = UserResponse14;
         // No operation keep-alive ping. The command channel can remain quiet for some time, this command allows a period test of client connectivity.
         static const uint8_t NoOP = 0xFF;
     };
@@ -164,6 +171,10 @@ namespace Transport
         static const uint32_t CompressionModeMask = 0x000000E0;
         // Mask to get character encoding used when exchanging messages between publisher and subscriber.
         static const uint32_t EncodingMask = 0x00000300;
+        // Mask to get the bits reserved for extensions specific to an implementation of the protocol.
+        static const uint32_t ImplementationSpecificExtensionMask = 0x00FF0000;
+        // Determines whether the subscriber accepts signal index cache deltas when its subscription changes. Bit set = deltas accepted, bit clear = full signal index cache is always sent. Implementation specific extension.
+        static const uint32_t SignalIndexCacheDeltas = 0x00010000;
         // Determines type of serialization to use when exchanging signal index cache and metadata. Bit set = common serialization format, bit clear is deprecated.
         static const uint32_t UseCommonSerializationFormat = 0x01000000;
         // Determines whether external measurements are exchanged during metadata synchronization. Bit set = external measurements are exchanged, bit clear = no external measurements are exchanged.
@@ -220,6 +231,18 @@ namespace Transport
         Gateway
     };
 
+    // Actions taken by the DataPublisher when a data packet is published to a subscriber
+    // connection whose send queue has reached its high-water mark.
+    enum class SlowConsumerPolicy
+    {
+        // Drop the data packet, TSSC streams of the connection are reset.
+        DropDataPackets,
+        // Disconnect the subscriber.
+        Disconnect,
+        // Queue the data packet, then block the publishing thread until the send queue drains.
+        BlockPublisher
+    };
+
     // The encoding commands supported by TSSC
     struct TSSCCodeWords
     {
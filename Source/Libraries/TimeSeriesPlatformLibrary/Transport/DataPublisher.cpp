@@ -18,6 +18,14 @@
 //  ----------------------------------------------------------------------------------------------------
 //  10/25/2018 - J. Ritchie Carroll
 //       Generated original version of source code.
+//  10/15/2026 - GSF Development Team
+//       Callback queue now uses lock-free RingQueue and dispatches queued callbacks in bulk.
+//       Added publication handles so measurements can be published without signal ID lookups.
+//       Data packets are serialized once for each group of connections that share their format.
+//       Added send queue high-water marks and slow consumer policy for subscriber connections.
+//       Added multicast publication of data packets shared by identical subscriptions.
+//       Added optional publish threads and a copy-on-write snapshot of the subscriber connections.
+//       Added shared timer that publishes the latest value snapshots of throttled subscriptions.
 //
 //******************************************************************************************************
 
@@ -36,6 +44,48 @@ using namespace GSF::FilterExpressions;
 using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
+// Interval, in milliseconds, at which throttled subscriptions are checked for a
+// due snapshot, which bounds how closely snapshots follow their interval
+static const int32_t ThrottledPublicationTimerInterval = 10;
+
+// Connection that serializes data packets and the connections that are sent the same packets.
+struct FanOutGroup
+{
+    SubscriberConnectionPtr Connection;
+    vector<SubscriberConnectionPtr> FanOutConnections;
+
+    FanOutGroup(SubscriberConnectionPtr connection) :
+        Connection(std::move(connection))
+    {
+    }
+};
+
+// Gets the address the given number of addresses above the given address.
+static IPAddress OffsetAddress(const IPAddress& address, uint32_t offset)
+{
+    if (address.is_v4())
+        return address_v4(address.to_v4().to_uint() + offset);
+
+    address_v6::bytes_type bytes = address.to_v6().to_bytes();
+
+    for (int32_t i = static_cast<int32_t>(bytes.size()) - 1; i >= 0 && offset > 0; i--)
+    {
+        const uint32_t sum = bytes[i] + (offset & 0xFFU);
+        bytes[i] = static_cast<uint8_t>(sum);
+        offset = (offset >> 8) + (sum >> 8);
+    }
+
+    return address_v6(bytes);
+}
+
+MulticastChannel::MulticastChannel(IOContext& ioContext) :
+    IncludeTime(true),
+    UseMillisecondResolution(false),
+    GroupOffset(0U),
+    Sender(ioContext)
+{
+}
+
 struct SubscriberConnectionInfo
 {
     const GSF::Guid SubscriberID;
@@ -50,14 +100,26 @@ struct SubscriberConnectionInfo
 
 DataPublisher::DataPublisher(const TcpEndPoint& endpoint) :
     m_nodeID(NewGuid()),
+    m_subscriberConnectionSnapshot(NewSharedPtr<const vector<SubscriberConnectionPtr>>()),
     m_securityMode(SecurityMode::None),
     m_allowMetadataRefresh(true),
     m_allowNaNValueFilter(true),
     m_forceNaNValueFilter(false),
     m_cipherKeyRotationPeriod(60000),
+    m_maxSendQueueSize(32U * 1024U * 1024U),
+    m_maxSendQueuePackets(1000U),
+    m_slowConsumerPolicy(SlowConsumerPolicy::DropDataPackets),
     m_userData(nullptr),
     m_disposing(false),
-    m_clientAcceptor(m_commandChannelService, endpoint)
+    m_publishThreadCount(0U),
+    m_publishWork(boost::asio::make_work_guard(m_publishService)),
+    m_clientAcceptor(m_commandChannelService, endpoint),
+    m_multicastPort(9600),
+    m_multicastTimeToLive(1),
+    m_multicastLoopback(false),
+    m_throttledPublicationWork(boost::asio::make_work_guard(m_throttledPublicationService)),
+    m_throttledPublicationTimer(m_throttledPublicationService),
+    m_throttledPublicationStarted(false)
 {
     m_callbackThread = Thread(bind(&DataPublisher::RunCallbackThread, this));
     m_commandChannelAcceptThread = Thread(bind(&DataPublisher::RunCommandChannelAcceptThread, this));
@@ -71,6 +133,17 @@ DataPublisher::DataPublisher(uint16_t port, bool ipV6) :
 DataPublisher::~DataPublisher()
 {
     m_disposing = true;
+    m_commandChannelService.stop();
+
+    if (m_commandChannelAcceptThread.joinable())
+        m_commandChannelAcceptThread.join();
+
+    m_throttledPublicationService.stop();
+
+    if (m_throttledPublicationThread.joinable())
+        m_throttledPublicationThread.join();
+
+    StopPublishThreads();
 }
 
 DataPublisher::CallbackDispatcher::CallbackDispatcher() :
@@ -82,15 +155,19 @@ DataPublisher::CallbackDispatcher::CallbackDispatcher() :
 
 void DataPublisher::RunCallbackThread()
 {
+    vector<CallbackDispatcher> dispatchers;
+
     while (true)
     {
-        m_callbackQueue.WaitForData();
-
-        if (m_disposing)
+        // Take everything queued since the last pass in one go,
+        // no items are returned once the queue has been released
+        if (m_callbackQueue.DequeueBulk(dispatchers) == 0 || m_disposing)
             break;
 
-        const CallbackDispatcher dispatcher = m_callbackQueue.Dequeue();
-        dispatcher.Function(dispatcher.Source, *dispatcher.Data);
+        for (const CallbackDispatcher& dispatcher : dispatchers)
+            dispatcher.Function(dispatcher.Source, *dispatcher.Data);
+
+        dispatchers.clear();
     }
 }
 
@@ -100,24 +177,96 @@ void DataPublisher::RunCommandChannelAcceptThread()
     m_commandChannelService.run();
 }
 
+void DataPublisher::RunPublishThread()
+{
+    function<void()> publication;
+
+    while (m_publishQueue.Dequeue(publication))
+        RunPublication(publication);
+}
+
+void DataPublisher::RunPublication(const function<void()>& publication)
+{
+    try
+    {
+        publication();
+    }
+    catch (const exception& ex)
+    {
+        DispatchErrorMessage("Failed to publish measurements: " + string(ex.what()));
+    }
+}
+
+void DataPublisher::StartPublishThreads()
+{
+    m_publishService.restart();
+
+    // Publish thread publishes connection groups too, so one less worker is needed
+    for (uint32_t i = 1; i < m_publishThreadCount; i++)
+        m_publishWorkers.push_back(NewSharedPtr<Thread>([this] { m_publishService.run(); }));
+
+    m_publishThread = Thread(bind(&DataPublisher::RunPublishThread, this));
+}
+
+// Stops the publish thread once it has finished the batch it is publishing. Batches still
+// queued are then published by the calling thread, unless the publisher is being disposed.
+void DataPublisher::StopPublishThreads()
+{
+    m_publishQueue.Release();
+
+    if (m_publishThread.joinable())
+        m_publishThread.join();
+
+    if (!m_disposing)
+    {
+        function<void()> publication;
+
+        while (m_publishQueue.TryDequeue(publication))
+            RunPublication(publication);
+    }
+
+    m_publishService.stop();
+
+    for (const SharedPtr<Thread>& thread : m_publishWorkers)
+        thread->join();
+
+    m_publishWorkers.clear();
+    m_publishQueue.Clear();
+}
+
 void DataPublisher::StartAccept()
 {
-    const SubscriberConnectionPtr connection = NewSharedPtr<SubscriberConnection, DataPublisherPtr, IOContext&, IOContext&>(shared_from_this(), m_commandChannelService, m_dataChannelService);
-    m_clientAcceptor.async_accept(connection->CommandChannelSocket(), boost::bind(&DataPublisher::AcceptConnection, this, connection, boost::asio::placeholders::error));
+    // Once a shared pointer owns the publisher, the pending accept keeps it alive like the connections do
+    const DataPublisherPtr self = weak_from_this().lock();
+    m_clientAcceptor.async_accept([this, self](const ErrorCode& error, TcpSocket socket) { AcceptConnection(error, socket); });
 }
 
-void DataPublisher::AcceptConnection(const SubscriberConnectionPtr& connection, const ErrorCode& error)
+void DataPublisher::AcceptConnection(const ErrorCode& error, TcpSocket& socket)
 {
-    if (!error)
+    // Connections hold a reference to the publisher, so they are only created once a client
+    // is accepted, by which time the shared pointer returned to the caller owns the publisher
+    const DataPublisherPtr parent = weak_from_this().lock();
+
+    if (!error && parent != nullptr)
     {
+        const SubscriberConnectionPtr connection = NewSharedPtr<SubscriberConnection, DataPublisherPtr, IOContext&, IOContext&>(parent, m_commandChannelService, m_dataChannelService);
+        connection->CommandChannelSocket() = std::move(socket);
+
         // TODO: For secured connections, validate certificate and IP information here to assign subscriberID
         m_subscriberConnectionsLock.lock();
         m_subscriberConnections.insert(connection);
+        UpdateSubscriberConnectionSnapshot();
         m_subscriberConnectionsLock.unlock();
 
         connection->Start();
         DispatchClientConnected(connection->GetSubscriberID(), connection->GetConnectionID());
     }
+    else if (socket.is_open())
+    {
+        // Client accepted while no shared pointer owns the publisher
+        ErrorCode closeError;
+        socket.close(closeError);
+    }
 
     StartAccept();
 }
@@ -127,11 +276,123 @@ void DataPublisher::RemoveConnection(const SubscriberConnectionPtr& connection)
     m_subscriberConnectionsLock.lock();
 
     if (m_subscriberConnections.erase(connection))
+    {
+        UpdateSubscriberConnectionSnapshot();
         DispatchClientDisconnected(connection->GetSubscriberID(), connection->GetConnectionID());
+    }
 
     m_subscriberConnectionsLock.unlock();
 }
 
+void DataPublisher::StartThrottledPublication()
+{
+    ScopeLock lock(m_throttledPublicationLock);
+
+    if (m_throttledPublicationStarted || m_disposing)
+        return;
+
+    // Timer thread only waits on the timer, it is started with the first throttled subscription
+    if (!m_throttledPublicationThread.joinable())
+        m_throttledPublicationThread = Thread([this] { m_throttledPublicationService.run(); });
+
+    ScheduleThrottledPublication();
+    m_throttledPublicationStarted = true;
+}
+
+void DataPublisher::ScheduleThrottledPublication()
+{
+    m_throttledPublicationTimer.expires_from_now(boost::posix_time::milliseconds(ThrottledPublicationTimerInterval));
+    m_throttledPublicationTimer.async_wait(boost::bind(&DataPublisher::ThrottledPublicationTimerElapsed, this, boost::asio::placeholders::error));
+}
+
+// Publishing holds its own reference to the snapshot it loaded, so
+// a removed connection is released once in-flight batches are done.
+void DataPublisher::UpdateSubscriberConnectionSnapshot()
+{
+    const SubscriberConnectionSnapshot snapshot = NewSharedPtr<const vector<SubscriberConnectionPtr>>(m_subscriberConnections.begin(), m_subscriberConnections.end());
+    boost::atomic_store(&m_subscriberConnectionSnapshot, snapshot);
+}
+
+// Connections with identical subscriptions are given the same signal index cache, which is
+// what lets their data packets be serialized once for all of them when publishing.
+SignalIndexCachePtr DataPublisher::ShareSignalIndexCache(const SignalIndexCachePtr& signalIndexCache)
+{
+    if (signalIndexCache == nullptr)
+        return signalIndexCache;
+
+    ScopeLock lock(m_subscriberConnectionsLock);
+    const SignalIndexCache* checkedCache = nullptr;
+
+    for (const auto& connection : m_subscriberConnections)
+    {
+        const SignalIndexCachePtr& cache = connection->GetSignalIndexCache();
+
+        // Skip comparing against the same shared cache again in a row
+        if (cache == nullptr || cache.get() == checkedCache)
+            continue;
+
+        if (cache->IsEquivalent(*signalIndexCache))
+            return cache;
+
+        checkedCache = cache.get();
+    }
+
+    return signalIndexCache;
+}
+
+MulticastChannelPtr DataPublisher::AcquireMulticastChannel(const SubscriberConnection& connection)
+{
+    if (!m_multicastAddress.is_multicast() || connection.GetSignalIndexCache() == nullptr)
+        return nullptr;
+
+    ScopeLock lock(m_multicastChannelsLock);
+
+    // Channels no connection refers to anymore are closed, freeing their groups
+    m_multicastChannels.erase(remove_if(m_multicastChannels.begin(), m_multicastChannels.end(), [](const MulticastChannelPtr& channel)
+    {
+        return channel.use_count() == 1;
+    }), m_multicastChannels.end());
+
+    for (const MulticastChannelPtr& channel : m_multicastChannels)
+    {
+        if (channel->SignalIndexCache == connection.GetSignalIndexCache() &&
+            channel->IncludeTime == connection.GetIncludeTime() &&
+            channel->UseMillisecondResolution == connection.GetUseMillisecondResolution())
+            return channel;
+    }
+
+    MulticastChannelPtr channel = NewSharedPtr<MulticastChannel, IOContext&>(m_dataChannelService);
+
+    channel->SignalIndexCache = connection.GetSignalIndexCache();
+    channel->IncludeTime = connection.GetIncludeTime();
+    channel->UseMillisecondResolution = connection.GetUseMillisecondResolution();
+
+    // Take the lowest group not used by another channel
+    while (any_of(m_multicastChannels.begin(), m_multicastChannels.end(), [&channel](const MulticastChannelPtr& other) { return other->GroupOffset == channel->GroupOffset; }))
+        channel->GroupOffset++;
+
+    try
+    {
+        channel->Sender.Open(UdpEndPoint(OffsetAddress(m_multicastAddress, channel->GroupOffset), static_cast<uint16_t>(m_multicastPort + channel->GroupOffset)));
+
+        UdpSocket& socket = channel->Sender.Socket();
+        socket.set_option(multicast::hops(m_multicastTimeToLive));
+        socket.set_option(multicast::enable_loopback(m_multicastLoopback));
+
+        if (m_multicastInterface.is_v4() && !m_multicastInterface.is_unspecified())
+            socket.set_option(multicast::outbound_interface(m_multicastInterface.to_v4()));
+    }
+    catch (const std::exception& ex)
+    {
+        DispatchErrorMessage("Failed to open multicast channel, data packets will be sent to each subscriber: " + string(ex.what()));
+        return nullptr;
+    }
+
+    m_multicastChannels.push_back(channel);
+
+    return channel;
+}
+
 void DataPublisher::Dispatch(const DispatcherFunction& function)
 {
     Dispatch(function, nullptr, 0, 0);
@@ -154,7 +415,8 @@ void DataPublisher::Dispatch(const DispatcherFunction& function, const uint8_t*
     dispatcher.Data = dataVector;
     dispatcher.Function = function;
 
-    m_callbackQueue.Enqueue(dispatcher);
+    // Socket threads never wait on the callback thread, callbacks that do not fit in the queue overflow
+    m_callbackQueue.EnqueueUnbounded(std::move(dispatcher));
 }
 
 void DataPublisher::DispatchStatusMessage(const string& message)
@@ -235,6 +497,43 @@ void DataPublisher::ClientDisconnectedDispatcher(DataPublisher* source, const st
     delete data;
 }
 
+// Each throttled connection decides whether its snapshot is due, so subscriptions with
+// different intervals share the timer and publishing measurements never waits on it.
+// Connections drop snapshots rather than wait on a full send queue, so the timer never blocks.
+void DataPublisher::ThrottledPublicationTimerElapsed(const ErrorCode& error)
+{
+    if (error || m_disposing)
+        return;
+
+    const int64_t now = ToTicks(UtcNow());
+
+    for (const auto& connection : *boost::atomic_load(&m_subscriberConnectionSnapshot))
+    {
+        if (!connection->GetIsThrottled())
+            continue;
+
+        try
+        {
+            connection->PublishLatestMeasurements(now);
+        }
+        catch (const exception& ex)
+        {
+            DispatchErrorMessage("Failed to publish latest measurements to client \"" + connection->GetConnectionID() + "\": " + string(ex.what()));
+        }
+    }
+
+    ScopeLock lock(m_throttledPublicationLock);
+
+    // Timer stops when no throttled subscriptions remain, checked again under the lock since
+    // a subscription that became throttled meanwhile found the timer running and did not start it
+    const SubscriberConnectionSnapshot connections = boost::atomic_load(&m_subscriberConnectionSnapshot);
+
+    if (any_of(connections->begin(), connections->end(), [](const SubscriberConnectionPtr& connection) { return connection->GetIsThrottled(); }))
+        ScheduleThrottledPublication();
+    else
+        m_throttledPublicationStarted = false;
+}
+
 int32_t DataPublisher::GetColumnIndex(const GSF::Data::DataTablePtr& table, const std::string& columnName)
 {
         const DataColumnPtr& column = table->Column(columnName);
@@ -681,16 +980,127 @@ vector<MeasurementMetadataPtr> DataPublisher::FilterMetadata(const string& filte
     return measurementMetadata;
 }
 
+// Publishes the measurements on the calling thread, or queues a copy of them for the publish thread.
+template<class T>
+void DataPublisher::PublishToConnections(const vector<T>& measurements)
+{
+    SharedLock lock(m_publishThreadsLock);
+
+    if (m_publishThreadCount == 0)
+    {
+        PublishBatch(measurements);
+        return;
+    }
+
+    m_publishQueue.Enqueue([this, measurements] { PublishBatch(measurements); });
+}
+
+// Groups the connections that share a data packet format so that each data packet
+// is serialized once per group and the same send buffer is sent to every member.
+template<class T>
+void DataPublisher::PublishBatch(const vector<T>& measurements)
+{
+    const SubscriberConnectionSnapshot connections = boost::atomic_load(&m_subscriberConnectionSnapshot);
+    vector<FanOutGroup> groups;
+
+    for (const auto& connection : *connections)
+    {
+        const auto group = find_if(groups.begin(), groups.end(), [&connection](const FanOutGroup& candidate)
+        {
+            return candidate.Connection->SharesDataPacketFormat(*connection);
+        });
+
+        if (group == groups.end())
+            groups.emplace_back(connection);
+        else
+            group->FanOutConnections.push_back(connection);
+    }
+
+    if (m_publishWorkers.empty() || groups.size() < 2)
+    {
+        for (const FanOutGroup& group : groups)
+            group.Connection->PublishMeasurements(measurements, group.FanOutConnections);
+
+        return;
+    }
+
+    // Errors are reported rather than thrown so every group completes before the groups go out of scope
+    const auto publishGroup = [this, &measurements](const FanOutGroup& group)
+    {
+        try
+        {
+            group.Connection->PublishMeasurements(measurements, group.FanOutConnections);
+        }
+        catch (const exception& ex)
+        {
+            DispatchErrorMessage("Failed to publish measurements to client \"" + group.Connection->GetConnectionID() + "\": " + string(ex.what()));
+        }
+    };
+
+    // Each connection belongs to a single group and the next batch waits
+    // for this one, so measurements reach every connection in order
+    for (size_t i = 1; i < groups.size(); i++)
+    {
+        const FanOutGroup* group = &groups[i];
+        boost::asio::post(m_publishService, m_pendingPublications.Track([&publishGroup, group] { publishGroup(*group); }));
+    }
+
+    publishGroup(groups[0]);
+
+    // Help with any groups the workers have not picked up yet
+    while (m_publishService.poll_one() > 0)
+    {
+    }
+
+    m_pendingPublications.WaitForCompletion();
+}
+
 void DataPublisher::PublishMeasurements(const vector<Measurement>& measurements)
 {
-    for (const auto& connection : m_subscriberConnections)
-        connection->PublishMeasurements(measurements);
+    PublishToConnections(measurements);
 }
 
 void DataPublisher::PublishMeasurements(const vector<MeasurementPtr>& measurements)
 {
-    for (const auto& connection : m_subscriberConnections)
-        connection->PublishMeasurements(measurements);
+    SharedLock lock(m_publishThreadsLock);
+
+    if (m_publishThreadCount == 0)
+    {
+        PublishBatch(measurements);
+        return;
+    }
+
+    // Caller keeps ownership of the measurements and may change them once this
+    // returns, so the publish thread is given copies of the measurement values
+    const SharedPtr<vector<Measurement>> copies = NewSharedPtr<vector<Measurement>>();
+    copies->reserve(measurements.size());
+
+    for (const MeasurementPtr& measurement : measurements)
+        copies->push_back(*measurement);
+
+    m_publishQueue.Enqueue([this, copies] { PublishBatch(*copies); });
+}
+
+uint32_t DataPublisher::RegisterPublication(const Guid& signalID)
+{
+    ScopeLock lock(m_publicationHandlesLock);
+    const auto result = m_publicationHandles.emplace(signalID, static_cast<uint32_t>(m_publicationSignalIDs.size()));
+
+    if (result.second)
+        m_publicationSignalIDs.push_back(signalID);
+
+    return result.first->second;
+}
+
+uint32_t DataPublisher::GetPublicationCount()
+{
+    ScopeLock lock(m_publicationHandlesLock);
+    return static_cast<uint32_t>(m_publicationSignalIDs.size());
+}
+
+void DataPublisher::PublishMeasurements(const vector<PublicationRecord>& records)
+{
+    PublishToConnections(records);
 }
 
 const GSF::Guid& DataPublisher::GetNodeID() const
@@ -753,6 +1163,126 @@ void DataPublisher::SetCipherKeyRotationPeriod(uint32_t period)
     m_cipherKeyRotationPeriod = period;
 }
 
+uint32_t DataPublisher::GetMaxSendQueueSize() const
+{
+    return m_maxSendQueueSize;
+}
+
+void DataPublisher::SetMaxSendQueueSize(uint32_t size)
+{
+    m_maxSendQueueSize = size;
+}
+
+uint32_t DataPublisher::GetMaxSendQueuePackets() const
+{
+    return m_maxSendQueuePackets;
+}
+
+void DataPublisher::SetMaxSendQueuePackets(uint32_t packets)
+{
+    m_maxSendQueuePackets = packets;
+}
+
+SlowConsumerPolicy DataPublisher::GetSlowConsumerPolicy() const
+{
+    return m_slowConsumerPolicy;
+}
+
+void DataPublisher::SetSlowConsumerPolicy(SlowConsumerPolicy policy)
+{
+    m_slowConsumerPolicy = policy;
+}
+
+const IPAddress& DataPublisher::GetMulticastAddress() const
+{
+    return m_multicastAddress;
+}
+
+void DataPublisher::SetMulticastAddress(const IPAddress& address)
+{
+    m_multicastAddress = address;
+}
+
+uint16_t DataPublisher::GetMulticastPort() const
+{
+    return m_multicastPort;
+}
+
+void DataPublisher::SetMulticastPort(uint16_t port)
+{
+    m_multicastPort = port;
+}
+
+int32_t DataPublisher::GetMulticastTimeToLive() const
+{
+    return m_multicastTimeToLive;
+}
+
+void DataPublisher::SetMulticastTimeToLive(int32_t timeToLive)
+{
+    m_multicastTimeToLive = timeToLive;
+}
+
+bool DataPublisher::GetMulticastLoopback() const
+{
+    return m_multicastLoopback;
+}
+
+void DataPublisher::SetMulticastLoopback(bool value)
+{
+    m_multicastLoopback = value;
+}
+
+const IPAddress& DataPublisher::GetMulticastInterface() const
+{
+    return m_multicastInterface;
+}
+
+void DataPublisher::SetMulticastInterface(const IPAddress& address)
+{
+    m_multicastInterface = address;
+}
+
+uint32_t DataPublisher::GetPublishThreadCount() const
+{
+    SharedLock lock(m_publishThreadsLock);
+    return m_publishThreadCount;
+}
+
+// Waits for calls publishing measurements to return, so none of them can queue
+// a batch for the publish thread or use its workers while they are replaced
+void DataPublisher::SetPublishThreadCount(uint32_t count)
+{
+    ExclusiveLock lock(m_publishThreadsLock);
+
+    StopPublishThreads();
+    m_publishQueue.Reset();
+    m_publishThreadCount = count;
+
+    if (m_publishThreadCount > 0)
+        StartPublishThreads();
+}
+
+uint32_t DataPublisher::GetPublishQueueCapacity() const
+{
+    return m_publishQueue.GetCapacity();
+}
+
+void DataPublisher::SetPublishQueueCapacity(uint32_t capacity)
+{
+    m_publishQueue.SetCapacity(capacity);
+}
+
+BackpressurePolicy DataPublisher::GetPublishBackpressurePolicy() const
+{
+    return m_publishQueue.GetPolicy();
+}
+
+void DataPublisher::SetPublishBackpressurePolicy(BackpressurePolicy policy)
+{
+    m_publishQueue.SetPolicy(policy);
+}
+
 void* DataPublisher::GetUserData() const
 {
     return m_userData;
@@ -788,6 +1318,14 @@ uint64_t DataPublisher::GetTotalDataChannelBytesSent()
 
     m_subscriberConnectionsLock.unlock();
 
+    // Multicast data packets are counted once for all the connections they were published for
+    m_multicastChannelsLock.lock();
+
+    for (const auto& channel : m_multicastChannels)
+        totalDataChannelBytesSent += channel->Sender.GetTotalBytesSent();
+
+    m_multicastChannelsLock.unlock();
+
     return totalDataChannelBytesSent;
 }
 
@@ -805,6 +1343,38 @@ uint64_t DataPublisher::GetTotalMeasurementsSent()
     return totalMeasurementsSent;
 }
 
+uint64_t DataPublisher::GetTotalDataPacketsDropped()
+{
+    uint64_t totalDataPacketsDropped = 0L;
+
+    m_subscriberConnectionsLock.lock();
+
+    for (const auto& connection : m_subscriberConnections)
+        totalDataPacketsDropped += connection->GetTotalDataPacketsDropped();
+
+    m_subscriberConnectionsLock.unlock();
+
+    return totalDataPacketsDropped;
+}
+
+// Gets the number of measurement batches waiting for the publish thread.
+uint32_t DataPublisher::GetPublishQueueDepth() const
+{
+    return m_publishQueue.Size();
+}
+
+// Gets the largest number of measurement batches that have waited for the publish thread.
+uint32_t DataPublisher::GetPublishQueueMaxDepth() const
+{
+    return m_publishQueue.GetMaxDepth();
+}
+
+// Gets the number of measurement batches discarded because the publish queue was full.
+uint64_t DataPublisher::GetTotalDroppedPublications() const
+{
+    return m_publishQueue.GetTotalDropped();
+}
+
 void DataPublisher::RegisterStatusMessageCallback(const MessageCallback& statusMessageCallback)
 {
     m_statusMessageCallback = statusMessageCallback;
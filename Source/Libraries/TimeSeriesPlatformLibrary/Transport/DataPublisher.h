@@ -18,6 +18,14 @@
 //  ----------------------------------------------------------------------------------------------------
 //  10/25/2018 - J. Ritchie Carroll
 //       Generated original version of source code.
+//  10/15/2026 - GSF Development Team
+//       Callback queue now uses lock-free RingQueue and dispatches queued callbacks in bulk.
+//       Added publication handles so measurements can be published without signal ID lookups.
+//       Data packets are serialized once for each group of connections that share their format.
+//       Added send queue high-water marks and slow consumer policy for subscriber connections.
+//       Added multicast publication of data packets shared by identical subscriptions.
+//       Added optional publish threads and a copy-on-write snapshot of the subscriber connections.
+//       Added shared timer that publishes the latest value snapshots of throttled subscriptions.
 //
 //******************************************************************************************************
 
@@ -26,10 +34,12 @@
 
 #include "SubscriberConnection.h"
 #include "../Common/CommonTypes.h"
-#include "../Common/ThreadSafeQueue.h"
+#include "../Common/RingQueue.h"
+#include "../Common/BoundedQueue.h"
 #include "../Data/DataSet.h"
 #include "TransportTypes.h"
 #include "Constants.h"
+#include "SubscriberExecutor.h"
 
 namespace GSF {
 namespace FilterExpressions
@@ -42,6 +52,24 @@ namespace GSF {
 namespace TimeSeries {
 namespace Transport
 {
+    // Multicast group to which data packets are published for every subscriber connection with
+    // the same data packet format, so that each data packet is serialized and sent only once.
+    struct MulticastChannel
+    {
+        // Data packet format of the connections publishing to the group
+        SignalIndexCachePtr SignalIndexCache;
+        bool IncludeTime;
+        bool UseMillisecondResolution;
+
+        // Offset of the group address and port from the multicast address and port of the publisher
+        uint32_t GroupOffset;
+
+        DatagramSender Sender;
+        GSF::Mutex SenderLock;
+
+        MulticastChannel(GSF::IOContext& ioContext);
+    };
+
     class DataPublisher : public EnableSharedThisPtr<DataPublisher> // NOLINT
     {
     private:
@@ -49,6 +77,8 @@ namespace Transport
         typedef std::function<void(DataPublisher*, const std::vector<uint8_t>&)> DispatcherFunction;
         typedef std::function<void(DataPublisher*, const std::string&)> MessageCallback;
         typedef std::function<void(DataPublisher*, const GSF::Guid&, const std::string&)> SubscriberConnectionCallback;
+        typedef boost::asio::executor_work_guard<GSF::IOContext::executor_type> WorkGuard;
+        typedef SharedPtr<const std::vector<SubscriberConnectionPtr>> SubscriberConnectionSnapshot;
 
         // Structure used to dispatch
         // callbacks on the callback thread.
@@ -66,17 +96,36 @@ namespace Transport
         GSF::Data::DataSetPtr m_filteringMetadata;
         std::unordered_set<SubscriberConnectionPtr> m_subscriberConnections;
         GSF::Mutex m_subscriberConnectionsLock;
+
+        // Copy of the connection set replaced whenever the set changes, publishing
+        // reads it with an atomic load so it never waits on the connections lock
+        SubscriberConnectionSnapshot m_subscriberConnectionSnapshot;
         SecurityMode m_securityMode;
         bool m_allowMetadataRefresh;
         bool m_allowNaNValueFilter;
         bool m_forceNaNValueFilter;
         uint32_t m_cipherKeyRotationPeriod;
+        uint32_t m_maxSendQueueSize;
+        uint32_t m_maxSendQueuePackets;
+        SlowConsumerPolicy m_slowConsumerPolicy;
         void* m_userData;
         bool m_disposing;
 
         // Callback thread members
         Thread m_callbackThread;
-        ThreadSafeQueue<CallbackDispatcher> m_callbackQueue;
+        RingQueue<CallbackDispatcher> m_callbackQueue;
+
+        // Publish pipeline, the publish thread takes queued batches in order and spreads
+        // the connection groups of each batch over itself and the publish workers. Callers
+        // publish under a shared lock, changing the thread count takes it exclusively.
+        uint32_t m_publishThreadCount;
+        mutable GSF::SharedMutex m_publishThreadsLock;
+        Thread m_publishThread;
+        BoundedQueue<std::function<void()>> m_publishQueue;
+        GSF::IOContext m_publishService;
+        WorkGuard m_publishWork;
+        std::vector<SharedPtr<Thread>> m_publishWorkers;
+        AsyncOperationTracker m_pendingPublications;
 
         // Command channel
         Thread m_commandChannelAcceptThread;
@@ -86,15 +135,67 @@ namespace Transport
         // Data channel
         GSF::IOContext m_dataChannelService;
 
+        // Multicast is disabled until a multicast address is set, channels
+        // only referenced by this list are closed when the next one opens
+        GSF::IPAddress m_multicastAddress;
+        uint16_t m_multicastPort;
+        int32_t m_multicastTimeToLive;
+        bool m_multicastLoopback;
+        GSF::IPAddress m_multicastInterface;
+        std::vector<MulticastChannelPtr> m_multicastChannels;
+        GSF::Mutex m_multicastChannelsLock;
+
+        // Signal ID of each publication handle, handles are assigned densely from zero
+        std::vector<GSF::Guid> m_publicationSignalIDs;
+        std::unordered_map<GSF::Guid, uint32_t> m_publicationHandles;
+        GSF::Mutex m_publicationHandlesLock;
+
+        // Shared timer that publishes the snapshots of throttled subscriptions, started with
+        // the first throttled subscription and stopped once no throttled subscriptions remain
+        GSF::IOContext m_throttledPublicationService;
+        WorkGuard m_throttledPublicationWork;
+        Thread m_throttledPublicationThread;
+        boost::asio::deadline_timer m_throttledPublicationTimer;
+        bool m_throttledPublicationStarted;
+        GSF::Mutex m_throttledPublicationLock;
+
         // Threads
         void RunCallbackThread();
         void RunCommandChannelAcceptThread();
+        void RunPublishThread();
+        void RunPublication(const std::function<void()>& publication);
+        void StartPublishThreads();
+        void StopPublishThreads();
 
         // Command channel handlers
         void StartAccept();
-        void AcceptConnection(const SubscriberConnectionPtr& connection, const ErrorCode& error);
+        void AcceptConnection(const ErrorCode& error, GSF::TcpSocket& socket);
         void RemoveConnection(const SubscriberConnectionPtr& connection);
 
+        // Replaces the connection snapshot with a copy of the connection set, the connections lock must be held
+        void UpdateSubscriberConnectionSnapshot();
+
+        // Gets the signal index cache of another connection that is equivalent to the given one, or the
+        // given cache when there is none, so that connections with identical subscriptions share a cache
+        SignalIndexCachePtr ShareSignalIndexCache(const SignalIndexCachePtr& signalIndexCache);
+
+        // Gets the multicast channel for the data packet format of the connection, opening one on the next
+        // free group when there is none. Returns null when multicast is disabled or the channel cannot open.
+        MulticastChannelPtr AcquireMulticastChannel(const SubscriberConnection& connection);
+
+        // Starts the shared timer of throttled subscriptions, if it is not already running
+        void StartThrottledPublication();
+
+        // Waits out the next timer interval, the throttled publication lock must be held
+        void ScheduleThrottledPublication();
+        void ThrottledPublicationTimerElapsed(const GSF::ErrorCode& error);
+
+        template<class T>
+        void PublishToConnections(const std::vector<T>& measurements);
+
+        template<class T>
+        void PublishBatch(const std::vector<T>& measurements);
+
         // Callbacks
         MessageCallback m_statusMessageCallback;
         MessageCallback m_errorMessageCallback;
@@ -136,6 +237,17 @@ namespace Transport
         void PublishMeasurements(const std::vector<Measurement>& measurements);
         void PublishMeasurements(const std::vector<MeasurementPtr>& measurements);
 
+        // Registers a signal for publication, returning the handle used to publish its measurements as
+        // PublicationRecord values. Each connection resolves a handle to the runtime ID of the signal
+        // once, so no signal ID lookups are needed when publishing records. Registering the same signal
+        // again returns the existing handle.
+        uint32_t RegisterPublication(const GSF::Guid& signalID);
+
+        // Gets the number of signals registered for publication.
+        uint32_t GetPublicationCount();
+
+        void PublishMeasurements(const std::vector<PublicationRecord>& records);
+
         // Node ID defines a unique identification for the DataPublisher
         // instance that gets included in published metadata so that clients
         // can easily distinguish the source of the measurements
@@ -157,6 +269,61 @@ namespace Transport
         uint32_t GetCipherKeyRotationPeriod() const;
         void SetCipherKeyRotationPeriod(uint32_t period);
 
+        // Gets or sets the high-water marks, in bytes and in packets, of the data waiting to
+        // be sent to each subscriber connection, beyond which data packets are handled
+        // according to the slow consumer policy; responses to commands are always sent
+        uint32_t GetMaxSendQueueSize() const;
+        void SetMaxSendQueueSize(uint32_t size);
+
+        uint32_t GetMaxSendQueuePackets() const;
+        void SetMaxSendQueuePackets(uint32_t packets);
+
+        SlowConsumerPolicy GetSlowConsumerPolicy() const;
+        void SetSlowConsumerPolicy(SlowConsumerPolicy policy);
+
+        // Gets or sets the multicast group address and port to which data packets are published for
+        // subscribers that request multicast. Each distinct data packet format is published to its own
+        // group, assigned upwards from this address and port, so that a subscriber socket bound to the
+        // port of its group does not receive the datagrams of other groups on hosts that deliver every
+        // joined group to every socket on the port. Multicast is disabled without a multicast address.
+        const GSF::IPAddress& GetMulticastAddress() const;
+        void SetMulticastAddress(const GSF::IPAddress& address);
+
+        uint16_t GetMulticastPort() const;
+        void SetMulticastPort(uint16_t port);
+
+        // Gets or sets the number of router hops multicast datagrams may take
+        int32_t GetMulticastTimeToLive() const;
+        void SetMulticastTimeToLive(int32_t timeToLive);
+
+        // Gets or sets flag that determines if multicast datagrams are looped back to
+        // subscribers on the publishing host, defaults to false
+        bool GetMulticastLoopback() const;
+        void SetMulticastLoopback(bool value);
+
+        // Gets or sets the local IPv4 interface address from which multicast
+        // datagrams are sent, unspecified uses the system default interface
+        const GSF::IPAddress& GetMulticastInterface() const;
+        void SetMulticastInterface(const GSF::IPAddress& address);
+
+        // Gets or sets the number of threads that publish measurements. With zero, the default,
+        // measurements are published on the calling thread. Otherwise PublishMeasurements queues a
+        // copy of the measurement values, never the caller's measurement pointers, and returns, so
+        // the caller may reuse its measurements right away. Queued batches are published in order,
+        // each with the connection groups that share a data packet format published in parallel.
+        // Changing the count waits for calls to PublishMeasurements and publishes the batches still
+        // waiting before the publish threads are replaced.
+        uint32_t GetPublishThreadCount() const;
+        void SetPublishThreadCount(uint32_t count);
+
+        // Gets or sets the maximum number of measurement batches waiting to be published.
+        uint32_t GetPublishQueueCapacity() const;
+        void SetPublishQueueCapacity(uint32_t capacity);
+
+        // Gets or sets the action taken when the publish threads fall behind and the publish queue is full.
+        BackpressurePolicy GetPublishBackpressurePolicy() const;
+        void SetPublishBackpressurePolicy(BackpressurePolicy policy);
+
         // Gets or sets user defined data reference
         void* GetUserData() const;
         void SetUserData(void* userData);
@@ -165,6 +332,13 @@ namespace Transport
         uint64_t GetTotalCommandChannelBytesSent();
         uint64_t GetTotalDataChannelBytesSent();
         uint64_t GetTotalMeasurementsSent();
+        uint64_t GetTotalDataPacketsDropped();
+
+        // Functions for publish pipeline statistics. Max depth and drop count are reset when the
+        // number of publish threads changes.
+        uint32_t GetPublishQueueDepth() const;
+        uint32_t GetPublishQueueMaxDepth() const;
+        uint64_t GetTotalDroppedPublications() const;
 
         // Callback registration
         //
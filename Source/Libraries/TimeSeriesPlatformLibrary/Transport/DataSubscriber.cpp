@@ -20,6 +20,23 @@
 //       Generated original version of source code.
 //  03/22/2018 - J. Ritchie Carroll
 //		 Updated DataSubscriber callback function signatures to always include instance reference.
+//  10/15/2026 - GSF Development Team
+//       Added recycling measurement pool so that steady-state parsing does not allocate.
+//       Added columnar measurement batch callback.
+//       Dispatched callback data now uses pooled buffers and is moved through the callback queue.
+//       Added optional pipelined data packet processing using bounded decode and callback queues.
+//       Callback queue now uses lock-free RingQueue and dispatches queued callbacks in bulk.
+//       Added batched UDP data channel receive with kernel timestamps and datagram counters on Linux.
+//       Added option to run on a SubscriberExecutor shared by many subscribers.
+//       Command channel now reads in large chunks and extracts all complete payloads per read.
+//       Added latency histograms for network, decode and callback intervals; statistics counters are now atomic.
+//       TSSC payloads are now decoded with the table-driven TSSCDecoder.
+//       Measurement keys are resolved by reference from the signal index cache.
+//       Compact measurements are parsed in one pass directly into the measurement batch arrays.
+//       Server commands are written in place into the write buffer with a BinaryWriter.
+//       Signal index caches are parsed in place when uncompressed and subscription changes can arrive as deltas.
+//       Added partitioned TSSC subscriptions whose partitions are decoded in parallel.
+//       Added multicast data channel joined on the group named by the publisher.
 //
 //******************************************************************************************************
 
@@ -30,8 +47,17 @@
 #include "../Common/Convert.h"
 #include "../Common/EndianConverter.h"
 #include <sstream>
+#include <chrono>
+#include <algorithm>
 #include <boost/bind.hpp>
 
+#ifdef __linux__
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <cerrno>
+#include <cstring>
+#endif
+
 using namespace std;
 using namespace boost;
 using namespace boost::asio;
@@ -40,6 +66,17 @@ using namespace GSF;
 using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
+// Versions of the TSSC payload with a single stream and with independent partitions
+static const uint8_t TSSCVersion = 85;
+static const uint8_t PartitionedTSSCVersion = 86;
+
+// Gets the current time, in ticks, with better than microsecond resolution for latency statistics.
+static int64_t GetUtcTicks()
+{
+    const int64_t nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    return Ticks::UnixBaseOffset + nanoseconds / 100;
+}
+
 // --- SubscriptionInfo ---
 
 SubscriptionInfo::SubscriptionInfo() :
@@ -47,11 +84,17 @@ SubscriptionInfo::SubscriptionInfo() :
     Throttled(false),
     UdpDataChannel(false),
     DataChannelLocalPort(9500),
+    DataChannelReceiveBufferSize(0),
+    DataChannelReceiveBatchSize(64),
+    DataChannelReceiveTimestamps(false),
+    MulticastDataChannel(false),
     IncludeTime(true),
     LagTime(10.0),
     LeadTime(5.0),
     UseLocalClockAsRealTime(false),
     UseMillisecondResolution(false),
+    TSSCPartitions(1),
+    SignalIndexCacheDeltas(false),
     ProcessingInterval(-1)
 {
 }
@@ -224,6 +267,11 @@ bool SubscriberConnector::GetAutoReconnect() const
 // --- DataSubscriber ---
 
 DataSubscriber::DataSubscriber() :
+    DataSubscriber(nullptr)
+{
+}
+
+DataSubscriber::DataSubscriber(const SubscriberExecutorPtr& executor) :
     m_subscriberID(Empty::Guid),
     m_compressPayloadData(true),
     m_compressMetadata(true),
@@ -233,6 +281,11 @@ DataSubscriber::DataSubscriber() :
     m_totalCommandChannelBytesReceived(0UL),
     m_totalDataChannelBytesReceived(0UL),
     m_totalMeasurementsReceived(0UL),
+    m_totalDataChannelDatagramsReceived(0UL),
+    m_totalDataChannelDatagramsTruncated(0UL),
+    m_totalDataChannelDatagramsDropped(0UL),
+    m_totalMeasurementsWithoutBaseTime(0UL),
+    m_latencyStatisticsEnabled(false),
     m_connected(false),
     m_subscribed(false),
     m_signalIndexCache(nullptr),
@@ -240,11 +293,21 @@ DataSubscriber::DataSubscriber() :
     m_baseTimeOffsets { 0, 0 },
     m_tsscResetRequested(false),
     m_tsscSequenceNumber(0),
-    m_commandChannelSocket(m_commandChannelService),
-    m_readBuffer(Common::MaxPacketSize),
+    m_tsscPartitionDecoder(executor),
+    m_dataPacketReceiveTimestamp(0L),
+    m_pipelinedDataProcessing(false),
+    m_pipelineActive(false),
+    m_executor(executor),
+    m_commandChannelSocket(executor != nullptr ? executor->GetIOContext() : m_commandChannelService),
     m_writeBuffer(Common::MaxPacketSize),
-    m_dataChannelSocket(m_dataChannelService)
+    m_dataChannelSocket(executor != nullptr ? executor->GetIOContext() : m_dataChannelService)
 {
+    if (m_executor != nullptr)
+    {
+        m_strand = NewSharedPtr<IOContext::strand, IOContext&>(m_executor->GetIOContext());
+        m_callbackStrand = NewSharedPtr<IOContext::strand, IOContext&>(m_executor->GetCallbackContext());
+        m_dataChannelBuffer.resize(Common::MaxPacketSize);
+    }
 }
 
 // Destructor calls disconnect to clean up after itself.
@@ -263,68 +326,119 @@ DataSubscriber::CallbackDispatcher::CallbackDispatcher() :
 // All callbacks are run from the callback thread from here.
 void DataSubscriber::RunCallbackThread()
 {
+    vector<CallbackDispatcher> dispatchers;
+
     while (true)
     {
-        m_callbackQueue.WaitForData();
-
-        if (m_disconnecting)
+        // Take everything queued since the last pass in one go,
+        // no items are returned once the queue has been released
+        if (m_callbackQueue.DequeueBulk(dispatchers) == 0 || m_disconnecting)
             break;
 
-        const CallbackDispatcher dispatcher = m_callbackQueue.Dequeue();
-        dispatcher.Function(dispatcher.Source, *dispatcher.Data);
+        for (const CallbackDispatcher& dispatcher : dispatchers)
+            dispatcher.Function(dispatcher.Source, *dispatcher.Data);
+
+        // Releasing the data returns dispatch buffers to the pool
+        dispatchers.clear();
     }
 }
 
-// All responses received from the server are handled by this thread with the
-// exception of data packets which may or may not be handled by this thread.
-void DataSubscriber::RunCommandChannelResponseThread()
+// Data packets queued by the receiving thread are decoded on this thread when pipelined data processing is enabled.
+void DataSubscriber::RunDecodeThread()
 {
-    async_read(m_commandChannelSocket, buffer(m_readBuffer, Common::PayloadHeaderSize), bind(&DataSubscriber::ReadPayloadHeader, this, _1, _2));
-    m_commandChannelService.run();
-}
+    QueuedDataPacket packet;
 
-// Callback for async read of the payload header.
-void DataSubscriber::ReadPayloadHeader(const ErrorCode& error, uint32_t bytesTransferred)
-{
-    const uint32_t PacketSizeOffset = 4;
+    while (m_decodeQueue.Dequeue(packet))
+    {
+        if (m_disconnecting)
+            break;
 
-    if (m_disconnecting)
-        return;
+        DecodedDataPacket decodedPacket;
 
-    if (error == error::connection_aborted || error == error::connection_reset || error == error::eof)
-    {
-        // Connection closed by peer; terminate connection
-        Thread(bind(&DataSubscriber::ConnectionTerminatedDispatcher, this));
-        return;
+        decodedPacket.Batch = m_measurementBatchPool.Acquire();
+        decodedPacket.Batch->Clear();
+        decodedPacket.Batch->SetSignalIndexCache(packet.SignalIndexCache);
+        decodedPacket.Batch->SetReceiveTimestamp(packet.ReceiveTimestamp);
+        decodedPacket.DecodeTimestamp = 0L;
+
+        // Vectors dropped from the data callback queue come back to
+        // the pool without being cleared, so always clear on acquire
+        decodedPacket.Measurements = m_measurementVectorPool.Acquire();
+        decodedPacket.Measurements->clear();
+
+        try
+        {
+            vector<uint8_t>& data = *packet.Data;
+            ParseDataPacket(data.data(), 0, static_cast<uint32_t>(data.size()), packet.BaseTimeOffsets, *decodedPacket.Batch);
+
+            if (m_newMeasurementsCallback != nullptr)
+                ToMeasurements(*decodedPacket.Batch, *decodedPacket.Measurements);
+
+            if (m_latencyStatisticsEnabled)
+            {
+                decodedPacket.DecodeTimestamp = GetUtcTicks();
+                RecordDecodeLatency(*decodedPacket.Batch, decodedPacket.DecodeTimestamp);
+            }
+        }
+        catch (SubscriberException& ex)
+        {
+            DispatchErrorMessage("Error decoding data packet: " + string(ex.what()));
+            continue;
+        }
+        catch (...)
+        {
+            DispatchErrorMessage("Error decoding data packet: " + boost::current_exception_diagnostic_information(true));
+            continue;
+        }
+
+        // Return packet buffer to the pool before waiting on the callback queue
+        packet.Data.reset();
+
+        m_dataCallbackQueue.Enqueue(std::move(decodedPacket));
     }
+}
 
-    if (error)
+// New measurements callbacks are called from this thread when pipelined data processing is enabled.
+void DataSubscriber::RunDataCallbackThread()
+{
+    DecodedDataPacket packet;
+
+    while (m_dataCallbackQueue.Dequeue(packet))
     {
-        stringstream errorMessageStream;
+        if (m_disconnecting)
+            break;
 
-        errorMessageStream << "Error reading data from command channel: ";
-        errorMessageStream << SystemError(error).what();
+        InvokeNewMeasurementsCallbacks(*packet.Batch, *packet.Measurements);
+        RecordCallbackLatency(packet.DecodeTimestamp);
 
-        DispatchErrorMessage(errorMessageStream.str());
-        return;
+        // Releasing our references returns the batch and vector to their pools
+        packet.Batch.reset();
+        packet.Measurements.reset();
     }
+}
 
-    // Gather statistics
-    m_totalCommandChannelBytesReceived += Common::PayloadHeaderSize;
-
-    const uint32_t packetSize = EndianConverter::ToLittleEndian<uint32_t>(m_readBuffer.data(), PacketSizeOffset);
+// All responses received from the server are handled by this thread with the
+// exception of data packets which may or may not be handled by this thread.
+void DataSubscriber::RunCommandChannelResponseThread()
+{
+    ReadCommandChannel();
+    m_commandChannelService.run();
+}
 
-    if (packetSize > static_cast<uint32_t>(m_readBuffer.size()))
-        m_readBuffer.resize(packetSize);
+// Starts reading the next block of data from the command channel.
+void DataSubscriber::ReadCommandChannel()
+{
+    const mutable_buffer readBuffer = m_commandChannelFramer.GetReadBuffer();
 
-    // Read packet (payload body)
-    // This read method is guaranteed not to return until the
-    // requested size has been read or an error has occurred.
-    async_read(m_commandChannelSocket, buffer(m_readBuffer, packetSize), bind(&DataSubscriber::ReadPacket, this, _1, _2));
+    if (m_executor == nullptr)
+        m_commandChannelSocket.async_read_some(readBuffer, bind(&DataSubscriber::ReadPayloads, this, _1, _2));
+    else
+        m_commandChannelSocket.async_read_some(readBuffer, bind_executor(*m_strand, m_commandChannelOperations.Track(bind(&DataSubscriber::ReadPayloads, this, _1, _2))));
 }
 
-// Callback for async read of packets.
-void DataSubscriber::ReadPacket(const ErrorCode& error, uint32_t bytesTransferred)
+// Callback for async read of the command channel. A single read
+// may complete any number of payloads, including none at all.
+void DataSubscriber::ReadPayloads(const ErrorCode& error, uint32_t bytesTransferred)
 {
     if (m_disconnecting)
         return;
@@ -349,12 +463,22 @@ void DataSubscriber::ReadPacket(const ErrorCode& error, uint32_t bytesTransferre
 
     // Gather statistics
     m_totalCommandChannelBytesReceived += bytesTransferred;
+    m_commandChannelFramer.CommitRead(bytesTransferred);
+
+    uint8_t* payload;
+    uint32_t length;
+
+    // Process responses
+    while (m_commandChannelFramer.TryGetPayload(payload, length))
+    {
+        ProcessServerResponse(payload, 0, length);
 
-    // Process response
-    ProcessServerResponse(&m_readBuffer[0], 0, bytesTransferred);
+        if (m_disconnecting)
+            return;
+    }
 
-    // Read next payload header
-    async_read(m_commandChannelSocket, buffer(m_readBuffer, Common::PayloadHeaderSize), bind(&DataSubscriber::ReadPayloadHeader, this, _1, _2));
+    // Read more data, any partial payload is kept by the framer
+    ReadCommandChannel();
 }
 
 // If the user defines a separate UDP channel for their
@@ -385,11 +509,160 @@ void DataSubscriber::RunDataChannelResponseThread()
 
         // Gather statistics
         m_totalDataChannelBytesReceived += length;
+        m_totalDataChannelDatagramsReceived++;
 
         ProcessServerResponse(&buffer[0], 0, length);
     }
 }
 
+// Waits for datagrams to arrive on the data channel when running on a shared executor.
+void DataSubscriber::WaitForDataChannel()
+{
+    m_dataChannelSocket.async_wait(UdpSocket::wait_read, bind_executor(*m_strand, m_dataChannelOperations.Track(bind(&DataSubscriber::ReadDataChannel, this, _1))));
+}
+
+// Drains the datagrams waiting on the data channel when running on a shared executor.
+void DataSubscriber::ReadDataChannel(const ErrorCode& error)
+{
+    if (m_disconnecting)
+        return;
+
+    ErrorCode receiveError = error;
+    udp::endpoint endpoint;
+
+    // Limit the datagrams handled per wake-up so that
+    // subscribers sharing the executor each get a turn
+    const uint32_t batchSize = max(m_subscriptionInfo.DataChannelReceiveBatchSize, 1U);
+
+    for (uint32_t i = 0; i < batchSize && !receiveError; i++)
+    {
+        const uint32_t length = m_dataChannelSocket.receive_from(asio::buffer(m_dataChannelBuffer), endpoint, 0, receiveError);
+
+        if (receiveError)
+            break;
+
+        // Gather statistics
+        m_totalDataChannelBytesReceived += length;
+        m_totalDataChannelDatagramsReceived++;
+
+        ProcessServerResponse(&m_dataChannelBuffer[0], 0, length);
+
+        if (m_disconnecting)
+            return;
+    }
+
+    if (receiveError && receiveError != error::would_block)
+    {
+        stringstream errorMessageStream;
+
+        errorMessageStream << "Error reading data from data channel: ";
+        errorMessageStream << SystemError(receiveError).what();
+
+        DispatchErrorMessage(errorMessageStream.str());
+        return;
+    }
+
+    WaitForDataChannel();
+}
+
+#ifdef __linux__
+// Linux version of the data channel thread which drains as many queued datagrams as
+// possible with each system call into a set of preallocated receive buffers.
+void DataSubscriber::RunBatchedDataChannelResponseThread()
+{
+    const uint32_t BufferSize = Common::MaxPacketSize;
+    const uint32_t ControlSize = CMSG_SPACE(sizeof(timespec)) + CMSG_SPACE(sizeof(uint32_t));
+    const uint32_t batchSize = max(m_subscriptionInfo.DataChannelReceiveBatchSize, 1U);
+    const int socket = m_dataChannelSocket.native_handle();
+
+    vector<uint8_t> buffers(batchSize * BufferSize);
+    vector<uint8_t> control(batchSize * ControlSize);
+    vector<iovec> vectors(batchSize);
+    vector<mmsghdr> messages(batchSize);
+    stringstream errorMessageStream;
+
+    for (uint32_t i = 0; i < batchSize; i++)
+    {
+        vectors[i].iov_base = &buffers[i * BufferSize];
+        vectors[i].iov_len = BufferSize;
+    }
+
+    while (true)
+    {
+        // Message headers are updated by each call so they must be reinitialized
+        for (uint32_t i = 0; i < batchSize; i++)
+        {
+            msghdr& header = messages[i].msg_hdr;
+            memset(&header, 0, sizeof(msghdr));
+            header.msg_iov = &vectors[i];
+            header.msg_iovlen = 1;
+            header.msg_control = &control[i * ControlSize];
+            header.msg_controllen = ControlSize;
+            messages[i].msg_len = 0;
+        }
+
+        // Blocks until at least one datagram is available, then returns
+        // every datagram already queued up to the size of the batch
+        const int count = recvmmsg(socket, messages.data(), batchSize, MSG_WAITFORONE, nullptr);
+
+        if (m_disconnecting)
+            break;
+
+        if (count < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            errorMessageStream << "Error reading data from data channel: ";
+            errorMessageStream << strerror(errno);
+            DispatchErrorMessage(errorMessageStream.str());
+            break;
+        }
+
+        for (int i = 0; i < count; i++)
+        {
+            msghdr& header = messages[i].msg_hdr;
+            const uint32_t length = messages[i].msg_len;
+            int64_t receiveTimestamp = 0L;
+
+            // Gather statistics
+            m_totalDataChannelBytesReceived += length;
+            m_totalDataChannelDatagramsReceived++;
+
+            for (cmsghdr* message = CMSG_FIRSTHDR(&header); message != nullptr; message = CMSG_NXTHDR(&header, message))
+            {
+                if (message->cmsg_level != SOL_SOCKET)
+                    continue;
+
+                if (message->cmsg_type == SCM_TIMESTAMPNS)
+                {
+                    timespec time;
+                    memcpy(&time, CMSG_DATA(message), sizeof(timespec));
+                    receiveTimestamp = Ticks::UnixBaseOffset + time.tv_sec * Ticks::PerSecond + time.tv_nsec / 100;
+                }
+                else if (message->cmsg_type == SO_RXQ_OVFL)
+                {
+                    // Kernel reports the total number of datagrams dropped by the socket
+                    uint32_t dropped;
+                    memcpy(&dropped, CMSG_DATA(message), sizeof(uint32_t));
+                    m_totalDataChannelDatagramsDropped = dropped;
+                }
+            }
+
+            // Partial packets cannot be parsed
+            if (header.msg_flags & MSG_TRUNC)
+            {
+                m_totalDataChannelDatagramsTruncated++;
+                continue;
+            }
+
+            m_dataPacketReceiveTimestamp = receiveTimestamp;
+            ProcessServerResponse(&buffers[i * BufferSize], 0, length);
+        }
+    }
+}
+#endif
+
 // Processes a response sent by the server. Response codes are defined in the header file "Constants.h".
 void DataSubscriber::ProcessServerResponse(uint8_t* buffer, uint32_t offset, uint32_t length)
 {
@@ -438,6 +711,29 @@ void DataSubscriber::ProcessServerResponse(uint8_t* buffer, uint32_t offset, uin
         case ServerResponse::NoOP:
             break;
 
+        case ServerResponse::UpdateSignalIndexCacheDelta:
+            // Delta response takes a user-defined response code, so it is only a
+            // delta when this subscriber requested deltas from the publisher
+            if (m_subscriptionInfo.SignalIndexCacheDeltas)
+            {
+                HandleUpdateSignalIndexCacheDelta(packetBodyStart, 0, packetBodyLength);
+                break;
+            }
+
+            // Otherwise it is handled as any other unexpected response.
+            // Do not break on this response.
+
+        case ServerResponse::UpdateMulticastGroup:
+            // Multicast group response also takes a user-defined response code, so
+            // it is only handled when this subscriber requested a multicast channel
+            if (responseCode == ServerResponse::UpdateMulticastGroup && m_subscriptionInfo.MulticastDataChannel)
+            {
+                HandleUpdateMulticastGroup(packetBodyStart, 0, packetBodyLength);
+                break;
+            }
+
+            // Do not break on this response.
+
         default:
             stringstream errorMessageStream;
             errorMessageStream << "Encountered unexpected server response code: ";
@@ -473,6 +769,7 @@ void DataSubscriber::HandleSucceeded(uint8_t commandCode, uint8_t* data, uint32_
 
         case ServerCommand::Authenticate:
         case ServerCommand::RotateCipherKeys:
+        case ServerCommand::UpdateProcessingInterval:
             // Each of these responses come with a message that will
             // be delivered to the user via the status message callback.
             if (data != nullptr)
@@ -545,42 +842,76 @@ void DataSubscriber::HandleUpdateSignalIndexCache(uint8_t* data, uint32_t offset
     if (data == nullptr)
         return;
 
-    vector<uint8_t> uncompressedBuffer;
+    SignalIndexCachePtr signalIndexCache = NewSharedPtr<SignalIndexCache>();
 
     if (m_compressSignalIndexCache)
     {
-        const MemoryStream memoryStream(data, offset, length);
+        vector<uint8_t> uncompressedBuffer;
+        DecompressSignalIndexCache(data, offset, length, uncompressedBuffer);
+        signalIndexCache->Parse(uncompressedBuffer, m_subscriberID);
+    }
+    else
+    {
+        signalIndexCache->Parse(data, offset, length, m_subscriberID);
+    }
 
-        // Perform zlib decompression on buffer
-        StreamBuffer streamBuffer;
+    m_signalIndexCache.swap(signalIndexCache);
+}
 
-        streamBuffer.push(GZipDecompressor());
-        streamBuffer.push(memoryStream);
+// Applies changes sent by the server to the current signal index cache.
+void DataSubscriber::HandleUpdateSignalIndexCacheDelta(uint8_t* data, uint32_t offset, uint32_t length)
+{
+    if (data == nullptr)
+        return;
 
-        CopyStream(&streamBuffer, uncompressedBuffer);
+    if (m_signalIndexCache == nullptr)
+    {
+        DispatchErrorMessage("Received signal index cache delta with no signal index cache to apply it to");
+        return;
+    }
+
+    // Measurements still in flight may reference the current cache,
+    // so the delta is applied to a copy that then replaces it
+    SignalIndexCachePtr signalIndexCache = NewSharedPtr<SignalIndexCache>(*m_signalIndexCache);
+
+    if (m_compressSignalIndexCache)
+    {
+        vector<uint8_t> uncompressedBuffer;
+        DecompressSignalIndexCache(data, offset, length, uncompressedBuffer);
+        signalIndexCache->ApplyDelta(uncompressedBuffer.data(), 0, static_cast<uint32_t>(uncompressedBuffer.size()), m_subscriberID);
     }
     else
     {
-        WriteBytes(uncompressedBuffer, data, offset, length);
+        signalIndexCache->ApplyDelta(data, offset, length, m_subscriberID);
     }
 
-    SignalIndexCachePtr signalIndexCache = NewSharedPtr<SignalIndexCache>();
-    signalIndexCache->Parse(uncompressedBuffer, m_subscriberID);
     m_signalIndexCache.swap(signalIndexCache);
 }
 
+void DataSubscriber::DecompressSignalIndexCache(const uint8_t* data, uint32_t offset, uint32_t length, vector<uint8_t>& buffer) const
+{
+    const MemoryStream memoryStream(data, offset, length);
+
+    // Perform zlib decompression on buffer
+    StreamBuffer streamBuffer;
+
+    streamBuffer.push(GZipDecompressor());
+    streamBuffer.push(memoryStream);
+
+    CopyStream(&streamBuffer, buffer);
+}
+
 // Updates base time offsets.
 void DataSubscriber::HandleUpdateBaseTimes(uint8_t* data, uint32_t offset, uint32_t length)
 {
     if (data == nullptr)
         return;
 
-    int32_t* timeIndexPtr = reinterpret_cast<int32_t*>(data + offset);
-    int64_t* timeOffsetsPtr = reinterpret_cast<int64_t*>(timeIndexPtr + 1); //-V1032
+    BinaryReader reader(data, offset, length);
 
-    m_timeIndex = EndianConverter::Default.ConvertBigEndian(*timeIndexPtr);
-    m_baseTimeOffsets[0] = EndianConverter::Default.ConvertBigEndian(timeOffsetsPtr[0]);
-    m_baseTimeOffsets[1] = EndianConverter::Default.ConvertBigEndian(timeOffsetsPtr[1]);
+    m_timeIndex = reader.ReadBigEndian<int32_t>();
+    m_baseTimeOffsets[0] = reader.ReadBigEndian<int64_t>();
+    m_baseTimeOffsets[1] = reader.ReadBigEndian<int64_t>();
 }
 
 // Handles configuration changed message sent by the server at the end of a temporal session.
@@ -589,53 +920,222 @@ void DataSubscriber::HandleConfigurationChanged(uint8_t* data, uint32_t offset,
     Dispatch(&ConfigurationChangedDispatcher);
 }
 
-// Handles data packets from the server. Decodes the measurements and provides them to the user via the new measurements callback.
+// Handles data packets from the server. Decodes the measurements and provides them to the user via the new measurements callbacks.
 void DataSubscriber::HandleDataPacket(uint8_t* data, uint32_t offset, uint32_t length)
+{
+    if (m_newMeasurementsCallback == nullptr && m_newMeasurementBatchCallback == nullptr)
+        return;
+
+    if (m_pipelineActive)
+    {
+        QueueDataPacket(data, offset, length);
+        return;
+    }
+
+    // Packets are always parsed into the reusable columnar batch, its
+    // capacity settles on the largest packet received
+    MeasurementBatch& batch = m_measurementBatch;
+    batch.Clear();
+    batch.SetSignalIndexCache(m_signalIndexCache);
+    batch.SetReceiveTimestamp(GetDataPacketArrivalTimestamp());
+
+    ParseDataPacket(data, offset, length, m_baseTimeOffsets, batch);
+
+    // Measurement vector is reused between packets as well
+    if (m_newMeasurementsCallback != nullptr)
+        ToMeasurements(batch, m_measurements);
+
+    int64_t decodeTimestamp = 0L;
+
+    if (m_latencyStatisticsEnabled)
+    {
+        decodeTimestamp = GetUtcTicks();
+        RecordDecodeLatency(batch, decodeTimestamp);
+    }
+
+    InvokeNewMeasurementsCallbacks(batch, m_measurements);
+    RecordCallbackLatency(decodeTimestamp);
+}
+
+// Copies a data packet into a pooled buffer and queues it for the decode thread along with the current parsing state.
+void DataSubscriber::QueueDataPacket(uint8_t* data, uint32_t offset, uint32_t length)
+{
+    QueuedDataPacket packet;
+
+    packet.Data = m_packetBufferPool.Acquire();
+
+    packet.Data->assign(data + offset, data + offset + length);
+
+    // Signal index cache and base times can be replaced by the publisher at any
+    // time, so capture the values that apply to this packet as it is received
+    packet.SignalIndexCache = m_signalIndexCache;
+    packet.BaseTimeOffsets[0] = m_baseTimeOffsets[0];
+    packet.BaseTimeOffsets[1] = m_baseTimeOffsets[1];
+    packet.ReceiveTimestamp = GetDataPacketArrivalTimestamp();
+
+    // Decode queue always blocks when full since
+    // TSSC decompression cannot skip any packets
+    m_decodeQueue.Enqueue(std::move(packet));
+}
+
+// Parses the data packet header and measurements into the given batch.
+void DataSubscriber::ParseDataPacket(uint8_t* data, uint32_t offset, uint32_t length, int64_t* baseTimeOffsets, MeasurementBatch& batch)
+{
+    SubscriptionInfo& info = m_subscriptionInfo;
+    uint8_t dataPacketFlags;
+    int64_t frameLevelTimestamp = -1;
+
+    bool includeTime = info.IncludeTime;
+
+    // Read data packet flags
+    dataPacketFlags = data[offset];
+    offset++;
+
+    // Read frame-level timestamp, if available
+    if (dataPacketFlags & DataPacketFlags::Synchronized)
+    {
+        frameLevelTimestamp = EndianConverter::ToBigEndian<int64_t>(data, offset);
+        offset += 8;
+        includeTime = false;
+    }
+
+    // Read measurement count and gather statistics
+    const uint32_t count = EndianConverter::ToBigEndian<uint32_t>(data, offset);
+    m_totalMeasurementsReceived += count;
+    offset += 4;
+
+    if (dataPacketFlags & DataPacketFlags::Compressed)
+        ParseTSSCMeasurements(data, offset, length, batch);
+    else
+        ParseCompactMeasurements(data, offset, length, includeTime, info.UseMillisecondResolution, frameLevelTimestamp, baseTimeOffsets, batch);
+}
+
+// Provides a parsed data packet to the user via the new measurements callbacks.
+void DataSubscriber::InvokeNewMeasurementsCallbacks(const MeasurementBatch& batch, vector<MeasurementPtr>& measurements)
 {
     const NewMeasurementsCallback newMeasurementsCallback = m_newMeasurementsCallback;
+    const NewMeasurementBatchCallback newMeasurementBatchCallback = m_newMeasurementBatchCallback;
+
+    if (newMeasurementBatchCallback != nullptr)
+        newMeasurementBatchCallback(this, batch);
 
     if (newMeasurementsCallback != nullptr)
-    {
-        SubscriptionInfo& info = m_subscriptionInfo;
-        uint8_t dataPacketFlags;
-        int64_t frameLevelTimestamp = -1;
+        newMeasurementsCallback(this, measurements);
+
+    // Releasing our references returns any measurements
+    // not retained by the callback back to the pool
+    measurements.clear();
+}
+
+// Gets a measurement from the pool, resetting any fields that are not always assigned by the parsers.
+MeasurementPtr DataSubscriber::AcquireMeasurement()
+{
+    MeasurementPtr measurement = m_measurementPool.Acquire();
+
+    measurement->Tag.clear();
+    measurement->Adder = 0;
+    measurement->Multiplier = 1;
+
+    return measurement;
+}
 
-        bool includeTime = info.IncludeTime;
+// Gets the time at which the current data packet arrived. When latency statistics are enabled and
+// the packet has no receive timestamp, the current time is used instead.
+int64_t DataSubscriber::GetDataPacketArrivalTimestamp() const
+{
+    if (m_dataPacketReceiveTimestamp != 0L || !m_latencyStatisticsEnabled)
+        return m_dataPacketReceiveTimestamp;
+
+    return GetUtcTicks();
+}
 
-        // Read data packet flags
-        dataPacketFlags = data[offset];
-        offset++;
+// Records the network latency of each measurement in a decoded data packet along with the decode latency of the packet.
+void DataSubscriber::RecordDecodeLatency(const MeasurementBatch& batch, int64_t decodeTimestamp)
+{
+    const int64_t arrivalTimestamp = batch.GetReceiveTimestamp();
+    const vector<int64_t>& timestamps = batch.GetTimestamps();
+    const uint32_t count = batch.Count();
+    uint32_t i = 0;
 
-        // Read frame-level timestamp, if available
-        if (dataPacketFlags & DataPacketFlags::Synchronized)
+    // Measurements in a packet usually share a timestamp, so each
+    // run of equal timestamps is recorded as a single histogram update
+    while (i < count)
+    {
+        const int64_t timestamp = timestamps[i];
+        const uint32_t start = i;
+
+        while (++i < count && timestamps[i] == timestamp)
         {
-            frameLevelTimestamp = EndianConverter::ToBigEndian<int64_t>(data, offset);
-            offset += 8;
-            includeTime = false;
         }
 
-        // Read measurement count and gather statistics
-        const uint32_t count = EndianConverter::ToBigEndian<uint32_t>(data, offset);
-        m_totalMeasurementsReceived += count;
-        offset += 4;
+        // Measurements without a timestamp have no network latency
+        if (timestamp > 0L)
+            m_networkLatency.Record(arrivalTimestamp - timestamp, i - start);
+    }
 
-        vector<MeasurementPtr> measurements;
+    m_decodeLatency.Record(decodeTimestamp - arrivalTimestamp);
+}
 
-        if (dataPacketFlags & DataPacketFlags::Compressed)
-            ParseTSSCMeasurements(data, offset, length, measurements);
-        else
-            ParseCompactMeasurements(data, offset, length, includeTime, info.UseMillisecondResolution, frameLevelTimestamp, measurements);
+// Records the time spent from the end of decoding until the new measurements callbacks returned.
+void DataSubscriber::RecordCallbackLatency(int64_t decodeTimestamp)
+{
+    // Decode time is not captured while latency statistics are disabled
+    if (decodeTimestamp == 0L)
+        return;
 
-        newMeasurementsCallback(this, measurements);
+    m_callbackLatency.Record(GetUtcTicks() - decodeTimestamp);
+}
+
+// Expands a columnar batch into pooled measurements with resolved measurement keys.
+void DataSubscriber::ToMeasurements(const MeasurementBatch& batch, vector<MeasurementPtr>& measurements)
+{
+    const SignalIndexCachePtr& signalIndexCache = batch.GetSignalIndexCache();
+    const uint32_t count = batch.Count();
+
+    if (signalIndexCache == nullptr)
+        return;
+
+    const vector<uint16_t>& signalIndexes = batch.GetSignalIndexes();
+    const vector<int64_t>& timestamps = batch.GetTimestamps();
+    const vector<float64_t>& values = batch.GetValues();
+    const vector<uint32_t>& flags = batch.GetFlags();
+
+    const Guid* signalID;
+    const string* source;
+    uint32_t id;
+
+    measurements.reserve(count);
+
+    for (uint32_t i = 0; i < count; i++)
+    {
+        if (!signalIndexCache->TryGetMeasurementKey(signalIndexes[i], signalID, source, id))
+            continue;
+
+        MeasurementPtr measurement = AcquireMeasurement();
+
+        // Source is assigned into the pooled measurement so its string capacity is reused
+        measurement->SignalID = *signalID;
+        measurement->Source = *source;
+        measurement->ID = id;
+        measurement->Timestamp = timestamps[i];
+        measurement->Value = values[i];
+        measurement->Flags = flags[i];
+
+        measurements.push_back(measurement);
     }
 }
 
-void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint32_t length, vector<MeasurementPtr>& measurements)
+void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint32_t length, MeasurementBatch& batch)
 {
-    MeasurementPtr measurement;
     string errorMessage;
 
-    if (data[offset] != 85)
+    if (data[offset] == PartitionedTSSCVersion)
+    {
+        ParsePartitionedTSSCMeasurements(data, offset + 1, length, batch);
+        return;
+    }
+
+    if (data[offset] != TSSCVersion)
     {
         stringstream errorMessageStream;
 
@@ -659,7 +1159,7 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
             DispatchStatusMessage(statusMessageStream.str());
         }
 
-        m_tsscMeasurementParser.Reset();
+        m_tsscDecoder.Reset();
         m_tsscSequenceNumber = 0;
         m_tsscResetRequested = false;
     }
@@ -682,36 +1182,16 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
 
     try
     {
-        m_tsscMeasurementParser.SetBuffer(data, offset, length);
-
-        Guid signalID;
-        string measurementSource;
-        uint32_t measurementID;
-        uint16_t id;
-        int64_t time;
-        uint32_t quality;
-        float32_t value;
+        const SignalIndexCachePtr& signalIndexCache = batch.GetSignalIndexCache();
 
-        while (m_tsscMeasurementParser.TryGetMeasurement(id, time, quality, value))
+        const bool decoded = m_tsscDecoder.Decode(data, offset, length, [&](uint16_t id, int64_t time, uint32_t quality, float32_t value)
         {
-            if (m_signalIndexCache->GetMeasurementKey(id, signalID, measurementSource, measurementID))
-            {
-                measurement = NewSharedPtr<Measurement>();
-
-                measurement->SignalID = signalID;
-                measurement->Source = measurementSource;
-                measurement->ID = measurementID;
-                measurement->Timestamp = time;
-                measurement->Flags = quality;
-                measurement->Value = value;
+            if (signalIndexCache != nullptr && signalIndexCache->Contains(id))
+                batch.Add(id, time, value, quality);
+        });
 
-                measurements.push_back(measurement);
-            }
-        }
-    }
-    catch (SubscriberException& ex)
-    {
-        errorMessage = ex.what();
+        if (!decoded)
+            errorMessage = m_tsscDecoder.GetErrorMessage();
     }
     catch (...)
     {
@@ -733,33 +1213,153 @@ void DataSubscriber::ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint3
         m_tsscSequenceNumber = 1;
 }
 
-void DataSubscriber::ParseCompactMeasurements(uint8_t* data, uint32_t offset, uint32_t length, bool includeTime, bool useMillisecondResolution, int64_t frameLevelTimestamp, vector<MeasurementPtr>& measurements)
+// Decodes the independent TSSC streams of a partitioned data packet in parallel and merges them into the batch.
+void DataSubscriber::ParsePartitionedTSSCMeasurements(uint8_t* data, uint32_t offset, uint32_t length, MeasurementBatch& batch)
+{
+    const uint32_t partitionCount = data[offset];
+    offset++;
+
+    if (partitionCount == 0)
+        throw SubscriberException("TSSC data packet does not define any partitions");
+
+    // Partition count only changes with a (re)subscription, which starts every partition over
+    if (m_tsscPartitionSequenceNumbers.size() != partitionCount)
+    {
+        m_tsscPartitionDecoder.SetPartitionCount(partitionCount);
+        m_tsscPartitionSequenceNumbers.assign(partitionCount, 0);
+        m_tsscPartitionResetRequested.assign(partitionCount, false);
+    }
+
+    if (m_tsscResetRequested)
+    {
+        m_tsscPartitionResetRequested.assign(partitionCount, true);
+        m_tsscResetRequested = false;
+    }
+
+    for (uint32_t i = 0; i < partitionCount; i++)
+    {
+        if (length - offset < 6)
+            throw SubscriberException("Not enough buffer was provided to parse TSSC partition header");
+
+        const uint16_t sequenceNumber = EndianConverter::ToBigEndian<uint16_t>(data, offset);
+        offset += 2;
+
+        const uint32_t blockLength = EndianConverter::ToBigEndian<uint32_t>(data, offset);
+        offset += 4;
+
+        if (length - offset < blockLength)
+            throw SubscriberException("Not enough buffer was provided to parse TSSC partition block");
+
+        uint16_t& expectedSequenceNumber = m_tsscPartitionSequenceNumbers[i];
+
+        // Partitions without measurements in this packet keep their sequence number
+        m_tsscPartitionDecoder.SetPartitionData(i, nullptr, 0, 0);
+
+        if (blockLength == 0)
+            continue;
+
+        if (sequenceNumber == 0 && expectedSequenceNumber > 0)
+        {
+            if (!m_tsscPartitionResetRequested[i])
+            {
+                stringstream statusMessageStream;
+                statusMessageStream << "TSSC partition " << i << " algorithm reset before sequence number: ";
+                statusMessageStream << expectedSequenceNumber;
+                DispatchStatusMessage(statusMessageStream.str());
+            }
+
+            m_tsscPartitionDecoder.ResetPartition(i);
+            expectedSequenceNumber = 0;
+            m_tsscPartitionResetRequested[i] = false;
+        }
+
+        if (expectedSequenceNumber == sequenceNumber)
+        {
+            m_tsscPartitionDecoder.SetPartitionData(i, data, offset, offset + blockLength);
+
+            // Do not increment to 0 on roll-over
+            if (++expectedSequenceNumber == 0)
+                expectedSequenceNumber = 1;
+        }
+        else if (!m_tsscPartitionResetRequested[i])
+        {
+            // Partition is ignored until its reset has occurred
+            stringstream errorMessageStream;
+            errorMessageStream << "TSSC partition " << i << " is out of sequence. Expecting: ";
+            errorMessageStream << expectedSequenceNumber;
+            errorMessageStream << ", Received: ";
+            errorMessageStream << sequenceNumber;
+            DispatchErrorMessage(errorMessageStream.str());
+        }
+
+        offset += blockLength;
+    }
+
+    m_tsscPartitionDecoder.Decode();
+
+    const SignalIndexCachePtr& signalIndexCache = batch.GetSignalIndexCache();
+
+    m_tsscPartitionDecoder.ForEachMeasurement([&](uint16_t id, int64_t time, uint32_t quality, float32_t value)
+    {
+        if (signalIndexCache != nullptr && signalIndexCache->Contains(id))
+            batch.Add(id, time, value, quality);
+    });
+
+    for (uint32_t i = 0; i < partitionCount; i++)
+    {
+        const string& errorMessage = m_tsscPartitionDecoder.GetErrorMessage(i);
+
+        if (errorMessage.length() > 0)
+        {
+            stringstream errorMessageStream;
+            errorMessageStream << "Decompression failure in TSSC partition " << i << ": ";
+            errorMessageStream << errorMessage;
+            DispatchErrorMessage(errorMessageStream.str());
+        }
+    }
+}
+
+void DataSubscriber::ParseCompactMeasurements(uint8_t* data, uint32_t offset, uint32_t length, bool includeTime, bool useMillisecondResolution, int64_t frameLevelTimestamp, int64_t* baseTimeOffsets, MeasurementBatch& batch)
 {
     const MessageCallback errorMessageCallback = m_errorMessageCallback;
+    const SignalIndexCachePtr& signalIndexCache = batch.GetSignalIndexCache();
 
-    if (m_signalIndexCache == nullptr)
+    if (signalIndexCache == nullptr)
         return;
 
     // Create measurement parser
-    CompactMeasurement parser(m_signalIndexCache, m_baseTimeOffsets, includeTime, useMillisecondResolution);
+    CompactMeasurement parser(signalIndexCache, baseTimeOffsets, includeTime, useMillisecondResolution);
 
-    while (length != offset)
+    if (length <= offset)
+        return;
+
+    // Packet is parsed in one pass directly into the batch arrays, sized for the
+    // largest number of measurements that could fit in the remaining data
+    const uint32_t capacity = (length - offset) / CompactMeasurement::MinimumBinaryLength;
+    const uint32_t start = batch.Extend(capacity);
+    uint32_t count = 0;
+
+    // Data packets on the data channel can arrive ahead of the first base times on the command
+    // channel, measurements offset from base times that are not yet defined are counted and dropped
+    while (true)
     {
-        MeasurementPtr measurement;
+        count += parser.ParseMeasurements(data, offset, length, batch.GetSignalIndexData() + start + count, batch.GetTimestampData() + start + count, batch.GetValueData() + start + count, batch.GetFlagData() + start + count, capacity - count);
 
-        if (!parser.TryParseMeasurement(data, offset, length, measurement))
-        {
-            if (errorMessageCallback != nullptr)
-                errorMessageCallback(this, "Error parsing measurement");
+        const uint32_t skipped = parser.SkipMeasurementsWithoutBaseTime(data, offset, length);
 
+        if (skipped == 0)
             break;
-        }
-
-        if (frameLevelTimestamp > -1)
-            measurement->Timestamp = frameLevelTimestamp;
 
-        measurements.push_back(measurement);
+        m_totalMeasurementsWithoutBaseTime += skipped;
     }
+
+    batch.Truncate(start + count);
+
+    if (frameLevelTimestamp > -1)
+        fill_n(batch.GetTimestampData() + start, count, frameLevelTimestamp);
+
+    if (offset != length && errorMessageCallback != nullptr)
+        errorMessageCallback(this, "Error parsing measurement");
 }
 
 // Dispatches the given function to the callback thread.
@@ -771,22 +1371,44 @@ void DataSubscriber::Dispatch(const DispatcherFunction& function)
 // Dispatches the given function to the callback thread and provides the given data to that function when it is called.
 void DataSubscriber::Dispatch(const DispatcherFunction& function, const uint8_t* data, uint32_t offset, uint32_t length)
 {
+    // Largest buffer capacity retained by the pool, e.g., after a metadata
+    // refresh, before it is released rather than reused for small messages
+    static const size_t MaxRetainedBufferCapacity = 1024 * 1024;
+
     CallbackDispatcher dispatcher;
-    SharedPtr<vector<uint8_t>> dataVector = NewSharedPtr<vector<uint8_t>>();
 
-    dataVector->resize(length);
+    // Dispatch is called from multiple threads, buffers return to the
+    // pool once the callback thread has finished with the dispatcher
+    dispatcher.Data = m_dispatchBufferPool.Acquire();
 
+    vector<uint8_t>& dataVector = *dispatcher.Data;
+
+    if (dataVector.capacity() > MaxRetainedBufferCapacity && length < MaxRetainedBufferCapacity)
+        vector<uint8_t>().swap(dataVector);
+
+    // Copy payload with a single bulk operation, reusing existing buffer capacity
     if (data != nullptr)
-    {
-        for (uint32_t i = 0; i < length; ++i)
-            dataVector->at(i) = data[offset + i];
-    }
+        dataVector.assign(data + offset, data + offset + length);
+    else
+        dataVector.assign(length, 0);
 
     dispatcher.Source = this;
-    dispatcher.Data = dataVector;
     dispatcher.Function = function;
 
-    m_callbackQueue.Enqueue(dispatcher);
+    // Socket threads never wait on the callback thread, callbacks that do not fit in the queue overflow
+    if (m_executor != nullptr)
+        post(*m_callbackStrand, m_callbackOperations.Track(bind(&DataSubscriber::InvokeDispatcher, this, dispatcher)));
+    else
+        m_callbackQueue.EnqueueUnbounded(std::move(dispatcher));
+}
+
+// Runs a dispatched callback on the shared callback executor.
+void DataSubscriber::InvokeDispatcher(const CallbackDispatcher& dispatcher)
+{
+    if (m_disconnecting)
+        return;
+
+    dispatcher.Function(dispatcher.Source, *dispatcher.Data);
 }
 
 // Invokes the status message callback on the callback thread and provides the given message to it.
@@ -924,6 +1546,12 @@ void DataSubscriber::RegisterNewMeasurementsCallback(const NewMeasurementsCallba
     m_newMeasurementsCallback = newMeasurementsCallback;
 }
 
+// Registers the new measurement batch callback.
+void DataSubscriber::RegisterNewMeasurementBatchCallback(const NewMeasurementBatchCallback& newMeasurementBatchCallback)
+{
+    m_newMeasurementBatchCallback = newMeasurementBatchCallback;
+}
+
 // Registers the processing complete callback.
 void DataSubscriber::RegisterProcessingCompleteCallback(const MessageCallback& processingCompleteCallback)
 {
@@ -948,6 +1576,12 @@ void DataSubscriber::RegisterAutoReconnectCallback(const ConnectionTerminatedCal
     m_autoReconnectCallback = autoReconnectCallback;
 }
 
+// Gets the executor shared with other subscribers, if any.
+const SubscriberExecutorPtr& DataSubscriber::GetExecutor() const
+{
+    return m_executor;
+}
+
 const Guid& DataSubscriber::GetSubscriberID() const
 {
     return m_subscriberID;
@@ -996,6 +1630,56 @@ void DataSubscriber::SetSignalIndexCacheCompressed(bool compressed)
         SendOperationalModes();
 }
 
+// Gets the value which determines whether data packets are processed in stages on separate threads.
+bool DataSubscriber::IsPipelinedDataProcessing() const
+{
+    return m_pipelinedDataProcessing;
+}
+
+// Sets the value which determines whether data packets are processed in stages on separate threads.
+// Setting takes effect the next time the subscriber connects.
+void DataSubscriber::SetPipelinedDataProcessing(bool pipelined)
+{
+    m_pipelinedDataProcessing = pipelined;
+}
+
+// Gets the maximum number of data packets held by each pipeline queue.
+uint32_t DataSubscriber::GetPipelineQueueCapacity() const
+{
+    return m_decodeQueue.GetCapacity();
+}
+
+// Sets the maximum number of data packets held by each pipeline queue.
+void DataSubscriber::SetPipelineQueueCapacity(uint32_t capacity)
+{
+    m_decodeQueue.SetCapacity(capacity);
+    m_dataCallbackQueue.SetCapacity(capacity);
+}
+
+// Gets the action taken when the data callback queue is full.
+BackpressurePolicy DataSubscriber::GetPipelineBackpressurePolicy() const
+{
+    return m_dataCallbackQueue.GetPolicy();
+}
+
+// Sets the action taken when the data callback queue is full.
+void DataSubscriber::SetPipelineBackpressurePolicy(BackpressurePolicy policy)
+{
+    m_dataCallbackQueue.SetPolicy(policy);
+}
+
+// Gets flag that determines if latency statistics are recorded.
+bool DataSubscriber::IsLatencyStatisticsEnabled() const
+{
+    return m_latencyStatisticsEnabled;
+}
+
+// Sets flag that determines if latency statistics are recorded.
+void DataSubscriber::SetLatencyStatisticsEnabled(bool enabled)
+{
+    m_latencyStatisticsEnabled = enabled;
+}
+
 // Gets user defined data reference
 void* DataSubscriber::GetUserData() const
 {
@@ -1036,10 +1720,17 @@ void DataSubscriber::Connect(const string& hostname, const uint16_t port)
     m_totalCommandChannelBytesReceived = 0UL;
     m_totalDataChannelBytesReceived = 0UL;
     m_totalMeasurementsReceived = 0UL;
+    m_totalDataChannelDatagramsReceived = 0UL;
+    m_totalDataChannelDatagramsTruncated = 0UL;
+    m_totalDataChannelDatagramsDropped = 0UL;
+    m_totalMeasurementsWithoutBaseTime = 0UL;
+    ResetLatencyStatistics();
 
     if (m_connected)
         throw SubscriberException("Subscriber is already connected; disconnect first");
 
+    m_commandChannelFramer.Reset();
+
     hostEndpoint = connect(m_commandChannelSocket, endpointIterator, error);
 
     if (error)
@@ -1050,9 +1741,26 @@ void DataSubscriber::Connect(const string& hostname, const uint16_t port)
 
     m_hostAddress = hostEndpoint->endpoint().address();
 
-    m_commandChannelService.restart();
-    m_callbackThread = Thread(bind(&DataSubscriber::RunCallbackThread, this));
-    m_commandChannelResponseThread = Thread(bind(&DataSubscriber::RunCommandChannelResponseThread, this));
+    if (m_executor == nullptr)
+    {
+        m_commandChannelService.restart();
+        m_callbackThread = Thread(bind(&DataSubscriber::RunCallbackThread, this));
+        m_commandChannelResponseThread = Thread(bind(&DataSubscriber::RunCommandChannelResponseThread, this));
+    }
+    else
+    {
+        // Command channel handlers run on the executor's I/O threads
+        ReadCommandChannel();
+    }
+
+    // Pipelined data processing setting is latched for the life of the connection
+    m_pipelineActive = m_pipelinedDataProcessing;
+
+    if (m_pipelineActive)
+    {
+        m_decodeThread = Thread(bind(&DataSubscriber::RunDecodeThread, this));
+        m_dataCallbackThread = Thread(bind(&DataSubscriber::RunDataCallbackThread, this));
+    }
 
     SendOperationalModes();
     m_connected = true;
@@ -1071,6 +1779,8 @@ void DataSubscriber::Disconnect(bool autoReconnect)
     // Release queues and close sockets so
     // that threads can shut down gracefully
     m_callbackQueue.Release();
+    m_decodeQueue.Release();
+    m_dataCallbackQueue.Release();
     m_commandChannelSocket.close(error);
     m_dataChannelSocket.shutdown(UdpSocket::shutdown_receive, error);
     m_dataChannelSocket.close(error);
@@ -1080,11 +1790,24 @@ void DataSubscriber::Disconnect(bool autoReconnect)
     m_callbackThread.join();
     m_commandChannelResponseThread.join();
     m_dataChannelResponseThread.join();
+    m_decodeThread.join();
+    m_dataCallbackThread.join();
+
+    // Handlers queued on a shared executor are the equivalent
+    // of the threads above, wait for them to finish as well
+    m_commandChannelOperations.WaitForCompletion();
+    m_dataChannelOperations.WaitForCompletion();
+    m_callbackOperations.WaitForCompletion();
 
     // Empty queues and reset them so they can be used
     // again later if the user decides to reconnect
     m_callbackQueue.Clear();
     m_callbackQueue.Reset();
+    m_decodeQueue.Clear();
+    m_decodeQueue.Reset();
+    m_dataCallbackQueue.Clear();
+    m_dataCallbackQueue.Reset();
+    m_pipelineActive = false;
 
     // Notify consumers of disconnect
     if (m_connectionTerminatedCallback != nullptr)
@@ -1124,16 +1847,6 @@ void DataSubscriber::Subscribe(const SubscriptionInfo& info)
 void DataSubscriber::Subscribe()
 {
     stringstream connectionStream;
-    string connectionString;
-
-    vector<uint8_t> buffer;
-    uint8_t* connectionStringPtr;
-    uint32_t connectionStringSize;
-    uint32_t bigEndianConnectionStringSize;
-    uint8_t* bigEndianConnectionStringSizePtr;
-
-    uint32_t bufferSize;
-    uint32_t i;
 
     // Make sure to unsubscribe before attempting another
     // subscription so we don't leave connections open
@@ -1149,22 +1862,28 @@ void DataSubscriber::Subscribe()
     connectionStream << "useLocalClockAsRealTime=" << m_subscriptionInfo.UseLocalClockAsRealTime << ";";
     connectionStream << "processingInterval=" << m_subscriptionInfo.ProcessingInterval << ";";
     connectionStream << "useMillisecondResolution=" << m_subscriptionInfo.UseMillisecondResolution << ";";
+
+    if (m_subscriptionInfo.TSSCPartitions > 1)
+        connectionStream << "tsscPartitions=" << m_subscriptionInfo.TSSCPartitions << ";";
+
     connectionStream << "assemblyInfo={source=TimeSeriesPlatformLibrary; version=" GSFTS_VERSION "; buildDate=" GSFTS_BUILD_DATE "};";
 
     if (!m_subscriptionInfo.FilterExpression.empty())
         connectionStream << "inputMeasurementKeys={" << m_subscriptionInfo.FilterExpression << "};";
 
-    if (m_subscriptionInfo.UdpDataChannel)
+    if (m_subscriptionInfo.MulticastDataChannel)
+    {
+        // Data channel is opened once the publisher names the multicast group
+        connectionStream << "dataChannel={multicast=true};";
+    }
+    else if (m_subscriptionInfo.UdpDataChannel)
     {
         udp ipVersion = udp::v4();
 
         if (m_hostAddress.is_v6())
             ipVersion = udp::v6();
 
-        // Attempt to bind to local UDP port
-        m_dataChannelSocket.open(ipVersion);
-        m_dataChannelSocket.bind(udp::endpoint(ipVersion, m_subscriptionInfo.DataChannelLocalPort));
-        m_dataChannelResponseThread = Thread(bind(&DataSubscriber::RunDataChannelResponseThread, this));
+        OpenDataChannel(udp::endpoint(ipVersion, m_subscriptionInfo.DataChannelLocalPort), IPAddress());
 
         if (!m_dataChannelSocket.is_open())
             throw SubscriberException("Failed to bind to local port");
@@ -1184,29 +1903,117 @@ void DataSubscriber::Subscribe()
     if (!m_subscriptionInfo.ExtraConnectionStringParameters.empty())
         connectionStream << m_subscriptionInfo.ExtraConnectionStringParameters << ";";
 
-    connectionString = connectionStream.str();
-    connectionStringPtr = reinterpret_cast<uint8_t*>(&connectionString[0]);
-    connectionStringSize = static_cast<uint32_t>(connectionString.size() * sizeof(char));
-    bigEndianConnectionStringSize = EndianConverter::Default.ConvertBigEndian(connectionStringSize);
-    bigEndianConnectionStringSizePtr = reinterpret_cast<uint8_t*>(&bigEndianConnectionStringSize);
+    const string connectionString = connectionStream.str();
+    const uint32_t connectionStringSize = static_cast<uint32_t>(connectionString.size() * sizeof(char));
+    BinaryWriter writer = StartServerCommand(ServerCommand::Subscribe, 5 + connectionStringSize);
 
-    bufferSize = 5 + connectionStringSize;
-    buffer.resize(bufferSize, 0);
+    writer.WriteByte(DataPacketFlags::Compact | (m_subscriptionInfo.RemotelySynchronized ? DataPacketFlags::Synchronized : DataPacketFlags::NoFlags));
+    writer.WriteBigEndian(connectionStringSize);
+    writer.WriteBytes(connectionString.data(), connectionStringSize);
 
-    buffer[0] = DataPacketFlags::Compact | (m_subscriptionInfo.RemotelySynchronized ? DataPacketFlags::Synchronized : DataPacketFlags::NoFlags);
+    CompleteServerCommand(writer);
 
-    buffer[1] = bigEndianConnectionStringSizePtr[0];
-    buffer[2] = bigEndianConnectionStringSizePtr[1];
-    buffer[3] = bigEndianConnectionStringSizePtr[2];
-    buffer[4] = bigEndianConnectionStringSizePtr[3];
+    // Reset TSSC decompresser on successful (re)subscription
+    m_tsscResetRequested = true;
+}
 
-    for (i = 0; i < connectionStringSize; ++i)
-        buffer[5 + i] = connectionStringPtr[i];
+void DataSubscriber::OpenDataChannel(const UdpEndPoint& localEndPoint, const IPAddress& multicastGroup)
+{
+    m_dataChannelSocket.open(localEndPoint.protocol());
 
-    SendServerCommand(ServerCommand::Subscribe, &buffer[0], 0, bufferSize);
+    // Other subscribers on this machine may receive from the same multicast group
+    if (multicastGroup.is_multicast())
+        m_dataChannelSocket.set_option(socket_base::reuse_address(true));
 
-    // Reset TSSC decompresser on successful (re)subscription
-    m_tsscResetRequested = true;
+    // Attempt to bind to local UDP port
+#ifdef __linux__
+    // Binding to the group address keeps datagrams of other groups sent to the same port off the socket
+    m_dataChannelSocket.bind(multicastGroup.is_multicast() ? UdpEndPoint(multicastGroup, localEndPoint.port()) : localEndPoint);
+
+    // Only deliver datagrams of the groups joined on this socket, not those joined by other sockets
+    if (multicastGroup.is_v4())
+    {
+        const int32_t disabled = 0;
+        setsockopt(m_dataChannelSocket.native_handle(), IPPROTO_IP, IP_MULTICAST_ALL, &disabled, sizeof(disabled));
+    }
+#else
+    m_dataChannelSocket.bind(localEndPoint);
+#endif
+
+    if (multicastGroup.is_multicast())
+    {
+        if (multicastGroup.is_v4() && !m_subscriptionInfo.MulticastInterface.empty())
+            m_dataChannelSocket.set_option(multicast::join_group(multicastGroup.to_v4(), make_address_v4(m_subscriptionInfo.MulticastInterface)));
+        else
+            m_dataChannelSocket.set_option(multicast::join_group(multicastGroup));
+    }
+
+    if (m_subscriptionInfo.DataChannelReceiveBufferSize > 0)
+        m_dataChannelSocket.set_option(socket_base::receive_buffer_size(static_cast<int32_t>(m_subscriptionInfo.DataChannelReceiveBufferSize)));
+
+#ifdef __linux__
+    const int32_t enabled = 1;
+    const int socket = m_dataChannelSocket.native_handle();
+
+    // Have the kernel report its count of datagrams dropped due to a full receive buffer
+    setsockopt(socket, SOL_SOCKET, SO_RXQ_OVFL, &enabled, sizeof(enabled));
+
+    if (m_subscriptionInfo.DataChannelReceiveTimestamps)
+        setsockopt(socket, SOL_SOCKET, SO_TIMESTAMPNS, &enabled, sizeof(enabled));
+#endif
+
+    if (m_executor != nullptr)
+    {
+        // Shared I/O threads must never block on a receive
+        m_dataChannelSocket.non_blocking(true);
+        WaitForDataChannel();
+    }
+    else
+    {
+#ifdef __linux__
+        m_dataChannelResponseThread = Thread(bind(&DataSubscriber::RunBatchedDataChannelResponseThread, this));
+#else
+        m_dataChannelResponseThread = Thread(bind(&DataSubscriber::RunDataChannelResponseThread, this));
+#endif
+    }
+}
+
+// Joins the multicast group to which the server publishes the data packets of this subscription.
+void DataSubscriber::HandleUpdateMulticastGroup(uint8_t* data, uint32_t offset, uint32_t length)
+{
+    // Data channel stays open on the group joined for an earlier subscription
+    if (data == nullptr || m_dataChannelSocket.is_open())
+        return;
+
+    try
+    {
+        BinaryReader reader(data, offset, length);
+        const uint16_t port = reader.ReadBigEndian<uint16_t>();
+        IPAddress multicastGroup;
+
+        if (reader.Remaining() == 4)
+        {
+            address_v4::bytes_type bytes;
+            reader.ReadBytes(bytes.data(), static_cast<uint32_t>(bytes.size()));
+            multicastGroup = make_address_v4(bytes);
+        }
+        else
+        {
+            address_v6::bytes_type bytes;
+            reader.ReadBytes(bytes.data(), static_cast<uint32_t>(bytes.size()));
+            multicastGroup = make_address_v6(bytes);
+        }
+
+        OpenDataChannel(udp::endpoint(multicastGroup.is_v6() ? udp::v6() : udp::v4(), port), multicastGroup);
+        DispatchStatusMessage("Joined multicast group " + multicastGroup.to_string() + ":" + ToString(port) + " for data packets.");
+    }
+    catch (const std::exception& ex)
+    {
+        ErrorCode error;
+        m_dataChannelSocket.close(error);
+
+        DispatchErrorMessage("Failed to join multicast group for data packets: " + string(ex.what()));
+    }
 }
 
 // Unsubscribe from publisher to stop receiving data.
@@ -1218,6 +2025,7 @@ void DataSubscriber::Unsubscribe()
     m_dataChannelSocket.shutdown(UdpSocket::shutdown_receive, error);
     m_dataChannelSocket.close(error);
     m_dataChannelResponseThread.join();
+    m_dataChannelOperations.WaitForCompletion();
     m_disconnecting = false;
 
     SendServerCommand(ServerCommand::Unsubscribe);
@@ -1232,66 +2040,74 @@ void DataSubscriber::SendServerCommand(uint8_t commandCode)
 // Sends a command along with the given message to the server.
 void DataSubscriber::SendServerCommand(uint8_t commandCode, string message)
 {
-    uint32_t bufferSize;
-    vector<uint8_t> buffer;
+    const uint32_t messageSize = static_cast<uint32_t>(message.size() * sizeof(char));
+    BinaryWriter writer = StartServerCommand(commandCode, 4 + messageSize);
 
-    uint8_t* messagePtr;
-    uint32_t messageSize;
-    uint32_t bigEndianMessageSize;
-    uint8_t* bigEndianMessageSizePtr;
+    writer.WriteBigEndian(messageSize);
+    writer.WriteBytes(message.data(), messageSize);
 
-    messagePtr = reinterpret_cast<uint8_t*>(&message[0]);
-    messageSize = static_cast<uint32_t>(message.size() * sizeof(char));
-    bigEndianMessageSize = EndianConverter::Default.ConvertBigEndian(messageSize);
-    bigEndianMessageSizePtr = reinterpret_cast<uint8_t*>(&bigEndianMessageSize);
-
-    bufferSize = 4 + messageSize;
-    buffer.resize(bufferSize, 0);
+    CompleteServerCommand(writer);
+}
 
-    buffer[0] = bigEndianMessageSizePtr[0];
-    buffer[1] = bigEndianMessageSizePtr[1];
-    buffer[2] = bigEndianMessageSizePtr[2];
-    buffer[3] = bigEndianMessageSizePtr[3];
+// Sends a command along with the given data to the server.
+void DataSubscriber::SendServerCommand(uint8_t commandCode, const uint8_t* data, uint32_t offset, uint32_t length)
+{
+    BinaryWriter writer = StartServerCommand(commandCode, length);
 
-    for (uint32_t i = 0; i < messageSize; ++i)
-        buffer[4 + i] = messagePtr[i];
+    if (data != nullptr)
+        writer.WriteBytes(data + offset, length);
+    else
+        writer.Skip(length);
 
-    SendServerCommand(commandCode, &buffer[0], 0, bufferSize);
+    CompleteServerCommand(writer);
 }
 
-// Sends a command along with the given data to the server.
-void DataSubscriber::SendServerCommand(uint8_t commandCode, const uint8_t* data, uint32_t offset, uint32_t length)
+// Writes the header of a command with the given length of data to the write buffer.
+BinaryWriter DataSubscriber::StartServerCommand(uint8_t commandCode, uint32_t length)
 {
-    const uint32_t packetSize = 1 + static_cast<uint32_t>(length);
-    uint32_t littleEndianPacketSize = EndianConverter::Default.ConvertLittleEndian(packetSize);
-    uint8_t* littleEndianPacketSizePtr = reinterpret_cast<uint8_t*>(&littleEndianPacketSize);
-    const uint32_t commandBufferSize = packetSize + 8U;
+    static const uint8_t PayloadMarker[] = { 0xAA, 0xBB, 0xCC, 0xDD };
+
+    const uint32_t packetSize = 1 + length;
+    const uint32_t commandBufferSize = packetSize + Common::PayloadHeaderSize;
 
     if (commandBufferSize > static_cast<uint32_t>(m_writeBuffer.size()))
         m_writeBuffer.resize(commandBufferSize);
 
+    BinaryWriter writer(m_writeBuffer.data(), 0, commandBufferSize);
+
     // Insert payload marker
-    m_writeBuffer[0] = 0xAA;
-    m_writeBuffer[1] = 0xBB;
-    m_writeBuffer[2] = 0xCC;
-    m_writeBuffer[3] = 0xDD;
+    writer.WriteBytes(PayloadMarker, 4);
 
     // Insert packet size
-    m_writeBuffer[4] = littleEndianPacketSizePtr[0];
-    m_writeBuffer[5] = littleEndianPacketSizePtr[1];
-    m_writeBuffer[6] = littleEndianPacketSizePtr[2];
-    m_writeBuffer[7] = littleEndianPacketSizePtr[3];
+    writer.WriteLittleEndian(packetSize);
 
     // Insert command code
-    m_writeBuffer[8] = commandCode;
+    writer.WriteByte(commandCode);
 
-    if (data != nullptr)
+    return writer;
+}
+
+// Sends the command that has been written to the write buffer.
+void DataSubscriber::CompleteServerCommand(const BinaryWriter& writer)
+{
+    if (m_executor == nullptr)
     {
-        for (uint32_t i = 0; i < length; ++i)
-            m_writeBuffer[9 + i] = data[offset + i];
+        async_write(m_commandChannelSocket, buffer(m_writeBuffer, writer.Position()), bind(&DataSubscriber::WriteHandler, this, _1, _2));
+        return;
     }
 
-    async_write(m_commandChannelSocket, buffer(m_writeBuffer, commandBufferSize), bind(&DataSubscriber::WriteHandler, this, _1, _2));
+    // On a shared executor, writes are started on the subscriber's strand like the reads of the
+    // command channel and are tracked so disconnect waits for them. The command is copied since
+    // the write buffer can be reused by the next command before the write completes.
+    const SharedPtr<vector<uint8_t>> command = NewSharedPtr<vector<uint8_t>>(m_writeBuffer.begin(), m_writeBuffer.begin() + writer.Position());
+
+    post(*m_strand, m_commandChannelOperations.Track([this, command]
+    {
+        async_write(m_commandChannelSocket, buffer(*command), bind_executor(*m_strand, m_commandChannelOperations.Track([this, command](const ErrorCode& error, size_t bytesTransferred)
+        {
+            WriteHandler(error, static_cast<uint32_t>(bytesTransferred));
+        })));
+    }));
 }
 
 void DataSubscriber::WriteHandler(const ErrorCode& error, uint32_t bytesTransferred)
@@ -1322,7 +2138,6 @@ void DataSubscriber::WriteHandler(const ErrorCode& error, uint32_t bytesTransfer
 void DataSubscriber::SendOperationalModes()
 {
     uint32_t operationalModes = CompressionModes::GZip;
-    uint32_t bigEndianOperationalModes;
 
     operationalModes |= OperationalEncoding::UTF8;
     operationalModes |= OperationalModes::UseCommonSerializationFormat;
@@ -1337,8 +2152,13 @@ void DataSubscriber::SendOperationalModes()
     if (m_compressSignalIndexCache)
         operationalModes |= OperationalModes::CompressSignalIndexCache;
 
-    bigEndianOperationalModes = EndianConverter::Default.ConvertBigEndian(operationalModes);
-    SendServerCommand(ServerCommand::DefineOperationalModes, reinterpret_cast<uint8_t*>(&bigEndianOperationalModes), 0, 4);
+    // Subscription changes only need to send the signals that were added or removed
+    if (m_subscriptionInfo.SignalIndexCacheDeltas)
+        operationalModes |= OperationalModes::SignalIndexCacheDeltas;
+
+    BinaryWriter writer = StartServerCommand(ServerCommand::DefineOperationalModes, 4);
+    writer.WriteBigEndian(operationalModes);
+    CompleteServerCommand(writer);
 }
 
 // Gets the total number of bytes received via the command channel since last connection.
@@ -1372,4 +2192,131 @@ bool DataSubscriber::IsConnected() const
 bool DataSubscriber::IsSubscribed() const
 {
     return m_subscribed;
-}
\ No newline at end of file
+}
+
+// Gets the total number of measurement objects allocated by the measurement pool.
+uint64_t DataSubscriber::GetTotalMeasurementAllocations() const
+{
+    return m_measurementPool.GetTotalAllocations();
+}
+
+// Gets the total number of measurements handed out by the measurement pool.
+uint64_t DataSubscriber::GetTotalMeasurementAcquisitions() const
+{
+    return m_measurementPool.GetTotalAcquisitions();
+}
+
+// Gets the number of released measurement objects held for reuse by the measurement pool.
+uint32_t DataSubscriber::GetMeasurementPoolSize() const
+{
+    return static_cast<uint32_t>(m_measurementPool.Size());
+}
+
+// Gets the total number of reads completed on the command channel.
+uint64_t DataSubscriber::GetTotalCommandChannelReads() const
+{
+    return m_commandChannelFramer.GetTotalReads();
+}
+
+// Gets the average number of payloads completed by each command channel read.
+float64_t DataSubscriber::GetCommandChannelPayloadsPerRead() const
+{
+    return m_commandChannelFramer.GetAveragePayloadsPerRead();
+}
+
+// Gets the largest number of payloads completed by a single command channel read.
+uint32_t DataSubscriber::GetMaxCommandChannelPayloadsPerRead() const
+{
+    return m_commandChannelFramer.GetMaxPayloadsPerRead();
+}
+
+// Gets the total number of datagrams received on the UDP data channel.
+uint64_t DataSubscriber::GetTotalDataChannelDatagramsReceived() const
+{
+    return m_totalDataChannelDatagramsReceived;
+}
+
+// Gets the total number of datagrams discarded because they were larger than the receive buffer.
+uint64_t DataSubscriber::GetTotalDataChannelDatagramsTruncated() const
+{
+    return m_totalDataChannelDatagramsTruncated;
+}
+
+// Gets the total number of datagrams the operating system dropped because the socket receive buffer was full.
+uint64_t DataSubscriber::GetTotalDataChannelDatagramsDropped() const
+{
+    return m_totalDataChannelDatagramsDropped;
+}
+
+// Gets the total number of measurements dropped because they were offset from base times not yet received.
+uint64_t DataSubscriber::GetTotalMeasurementsWithoutBaseTime() const
+{
+    return m_totalMeasurementsWithoutBaseTime;
+}
+
+// Gets the number of data packets waiting for the decode thread.
+uint32_t DataSubscriber::GetDecodeQueueDepth() const
+{
+    return m_decodeQueue.Size();
+}
+
+// Gets the largest number of data packets that have waited for the decode thread since connecting.
+uint32_t DataSubscriber::GetDecodeQueueMaxDepth() const
+{
+    return m_decodeQueue.GetMaxDepth();
+}
+
+// Gets the number of decoded data packets waiting for the data callback thread.
+uint32_t DataSubscriber::GetDataCallbackQueueDepth() const
+{
+    return m_dataCallbackQueue.Size();
+}
+
+// Gets the largest number of decoded data packets that have waited for the data callback thread since connecting.
+uint32_t DataSubscriber::GetDataCallbackQueueMaxDepth() const
+{
+    return m_dataCallbackQueue.GetMaxDepth();
+}
+
+// Gets the total number of decoded data packets discarded by the pipeline backpressure policy since connecting.
+uint64_t DataSubscriber::GetTotalDroppedDataPackets() const
+{
+    return m_dataCallbackQueue.GetTotalDropped();
+}
+
+// Gets a snapshot of the latency distributions recorded since connecting or since they were last reset.
+LatencyStatistics DataSubscriber::GetLatencyStatistics() const
+{
+    LatencyStatistics statistics;
+
+    statistics.Network = m_networkLatency.GetSnapshot();
+    statistics.Decode = m_decodeLatency.GetSnapshot();
+    statistics.Callback = m_callbackLatency.GetSnapshot();
+
+    return statistics;
+}
+
+// Clears the latency distributions of all intervals.
+void DataSubscriber::ResetLatencyStatistics()
+{
+    m_networkLatency.Reset();
+    m_decodeLatency.Reset();
+    m_callbackLatency.Reset();
+}
+
+// Clears the latency distribution of the given interval.
+void DataSubscriber::ResetLatencyStatistics(LatencyInterval interval)
+{
+    switch (interval)
+    {
+        case LatencyInterval::Network:
+            m_networkLatency.Reset();
+            break;
+        case LatencyInterval::Decode:
+            m_decodeLatency.Reset();
+            break;
+        case LatencyInterval::Callback:
+            m_callbackLatency.Reset();
+            break;
+    }
+}
@@ -20,6 +20,21 @@
 //       Generated original version of source code.
 //  03/22/2018 - J. Ritchie Carroll
 //		 Updated DataSubscriber callback function signatures to always include instance reference.
+//  10/15/2026 - GSF Development Team
+//       Added recycling measurement pool so that steady-state parsing does not allocate.
+//       Added columnar measurement batch callback.
+//       Dispatched callback data now uses pooled buffers and is moved through the callback queue.
+//       Added optional pipelined data packet processing using bounded decode and callback queues.
+//       Callback queue now uses lock-free RingQueue and dispatches queued callbacks in bulk.
+//       Added batched UDP data channel receive with kernel timestamps and datagram counters on Linux.
+//       Added option to run on a SubscriberExecutor shared by many subscribers.
+//       Command channel now reads in large chunks and extracts all complete payloads per read.
+//       Added latency histograms for network, decode and callback intervals; statistics counters are now atomic.
+//       TSSC payloads are now decoded with the table-driven TSSCDecoder.
+//       Server commands are written in place into the write buffer with a BinaryWriter.
+//       Added handling of signal index cache deltas.
+//       Added partitioned TSSC subscriptions whose partitions are decoded in parallel.
+//       Added multicast data channel joined on the group named by the publisher.
 //
 //******************************************************************************************************
 
@@ -28,8 +43,16 @@
 
 #include "TransportTypes.h"
 #include "SignalIndexCache.h"
-#include "TSSCMeasurementParser.h"
-#include "../Common/ThreadSafeQueue.h"
+#include "MeasurementBatch.h"
+#include "SubscriberExecutor.h"
+#include "PayloadFramer.h"
+#include "TSSCDecoder.h"
+#include "TSSCPartitionDecoder.h"
+#include "../Common/RingQueue.h"
+#include "../Common/ObjectPool.h"
+#include "../Common/BoundedQueue.h"
+#include "../Common/LatencyHistogram.h"
+#include "../Common/BinaryCodec.h"
 
 namespace GSF {
 namespace TimeSeries {
@@ -48,12 +71,34 @@ namespace Transport
         bool UdpDataChannel;
         uint16_t DataChannelLocalPort;
 
+        // Receive buffer size of zero keeps the system default. Batch size and
+        // receive timestamps apply to the batched receive path used on Linux.
+        uint32_t DataChannelReceiveBufferSize;
+        uint32_t DataChannelReceiveBatchSize;
+        bool DataChannelReceiveTimestamps;
+
+        // Requests data packets on the multicast group the publisher shares among identical
+        // subscriptions, taking precedence over the UDP data channel. The group is joined on the
+        // given local IPv4 interface address, or the system default when empty. Data packets
+        // arrive on the command channel when the publisher does not assign a group.
+        bool MulticastDataChannel;
+        std::string MulticastInterface;
+
         bool IncludeTime;
         float64_t LagTime;
         float64_t LeadTime;
         bool UseLocalClockAsRealTime;
         bool UseMillisecondResolution;
 
+        // Number of independent TSSC streams the publisher splits the subscribed signals
+        // over so that they can be decoded in parallel, one keeps a single stream
+        uint32_t TSSCPartitions;
+
+        // Requests that a change of subscription sends only the runtime IDs removed from and the
+        // keys added to the signal index cache. The request is an extension specific to this
+        // implementation, other publishers ignore it and send the full cache.
+        bool SignalIndexCacheDeltas;
+
         std::string StartTime;
         std::string StopTime;
         std::string ConstraintParameters;
@@ -64,6 +109,25 @@ namespace Transport
         SubscriptionInfo();
     };
 
+    // Intervals measured by the subscriber latency statistics.
+    enum class LatencyInterval
+    {
+        // Measurement timestamp to arrival of its data packet.
+        Network,
+        // Data packet arrival to completion of measurement decoding.
+        Decode,
+        // Completion of decoding to return from the new measurements callbacks.
+        Callback
+    };
+
+    // Latency distributions, in ticks, of each interval measured by the subscriber.
+    struct LatencyStatistics
+    {
+        LatencyHistogramSnapshot Network;
+        LatencyHistogramSnapshot Decode;
+        LatencyHistogramSnapshot Callback;
+    };
+
     // Helper class to provide retry and auto-reconnect functionality to the subscriber.
     class SubscriberConnector
     {
@@ -141,6 +205,7 @@ namespace Transport
         typedef std::function<void(DataSubscriber*, int64_t)> DataStartTimeCallback;
         typedef std::function<void(DataSubscriber*, const std::vector<uint8_t>&)> MetadataCallback;
         typedef std::function<void(DataSubscriber*, const std::vector<MeasurementPtr>&)> NewMeasurementsCallback;
+        typedef std::function<void(DataSubscriber*, const MeasurementBatch&)> NewMeasurementBatchCallback;
         typedef std::function<void(DataSubscriber*)> ConfigurationChangedCallback;
         typedef std::function<void(DataSubscriber*)> ConnectionTerminatedCallback;
 
@@ -155,6 +220,24 @@ namespace Transport
             CallbackDispatcher();
         };
 
+        // Data packet waiting for the decode stage along with
+        // the parsing state that was active when it was received.
+        struct QueuedDataPacket
+        {
+            SharedPtr<std::vector<uint8_t>> Data;
+            SignalIndexCachePtr SignalIndexCache;
+            int64_t BaseTimeOffsets[2];
+            int64_t ReceiveTimestamp;
+        };
+
+        // Decoded data packet waiting for the callback stage.
+        struct DecodedDataPacket
+        {
+            MeasurementBatchPtr Batch;
+            SharedPtr<std::vector<MeasurementPtr>> Measurements;
+            int64_t DecodeTimestamp;
+        };
+
         SubscriberConnector m_connector;
         SubscriptionInfo m_subscriptionInfo;
         IPAddress m_hostAddress;
@@ -166,9 +249,20 @@ namespace Transport
         void* m_userData;
 
         // Statistics counters
-        uint64_t m_totalCommandChannelBytesReceived;
-        uint64_t m_totalDataChannelBytesReceived;
-        uint64_t m_totalMeasurementsReceived;
+        std::atomic<uint64_t> m_totalCommandChannelBytesReceived;
+        std::atomic<uint64_t> m_totalDataChannelBytesReceived;
+        std::atomic<uint64_t> m_totalMeasurementsReceived;
+        std::atomic<uint64_t> m_totalDataChannelDatagramsReceived;
+        std::atomic<uint64_t> m_totalDataChannelDatagramsTruncated;
+        std::atomic<uint64_t> m_totalDataChannelDatagramsDropped;
+        std::atomic<uint64_t> m_totalMeasurementsWithoutBaseTime;
+
+        // Latency statistics, recorded only when enabled
+        bool m_latencyStatisticsEnabled;
+        LatencyHistogram m_networkLatency;
+        LatencyHistogram m_decodeLatency;
+        LatencyHistogram m_callbackLatency;
+
         bool m_connected;
         bool m_subscribed;
 
@@ -176,19 +270,54 @@ namespace Transport
         SignalIndexCachePtr m_signalIndexCache;
         int32_t m_timeIndex;
         int64_t m_baseTimeOffsets[2];
-        TSSCMeasurementParser m_tsscMeasurementParser;
+        TSSCDecoder m_tsscDecoder;
         bool m_tsscResetRequested;
         uint16_t m_tsscSequenceNumber;
+        TSSCPartitionDecoder m_tsscPartitionDecoder;
+        std::vector<uint16_t> m_tsscPartitionSequenceNumbers;
+        std::vector<bool> m_tsscPartitionResetRequested;
+        int64_t m_dataPacketReceiveTimestamp;
+
+        // Parsed measurements are drawn from a recycling pool and
+        // collected into a reusable vector so that the data packet
+        // path does not allocate once the pool reaches steady-state
+        ObjectPool<Measurement> m_measurementPool;
+        std::vector<MeasurementPtr> m_measurements;
+        MeasurementBatch m_measurementBatch;
 
         // Callback thread members
         Thread m_callbackThread;
-        ThreadSafeQueue<CallbackDispatcher> m_callbackQueue;
+        RingQueue<CallbackDispatcher> m_callbackQueue;
+        ObjectPool<std::vector<uint8_t>> m_dispatchBufferPool;
+
+        // Data packet pipeline members, when enabled the thread reading
+        // from the socket only queues data packets for the decode thread
+        // which in turn queues decoded batches for the data callback thread
+        bool m_pipelinedDataProcessing;
+        bool m_pipelineActive;
+        Thread m_decodeThread;
+        Thread m_dataCallbackThread;
+        BoundedQueue<QueuedDataPacket> m_decodeQueue;
+        BoundedQueue<DecodedDataPacket> m_dataCallbackQueue;
+        ObjectPool<std::vector<uint8_t>> m_packetBufferPool;
+        ObjectPool<MeasurementBatch> m_measurementBatchPool;
+        ObjectPool<std::vector<MeasurementPtr>> m_measurementVectorPool;
+
+        // Shared executor members, only used when the subscriber was created with
+        // an executor. Strands keep this subscriber's handlers and callbacks in order.
+        SubscriberExecutorPtr m_executor;
+        SharedPtr<IOContext::strand> m_strand;
+        SharedPtr<IOContext::strand> m_callbackStrand;
+        AsyncOperationTracker m_commandChannelOperations;
+        AsyncOperationTracker m_dataChannelOperations;
+        AsyncOperationTracker m_callbackOperations;
+        std::vector<uint8_t> m_dataChannelBuffer;
 
         // Command channel
         Thread m_commandChannelResponseThread;
         boost::asio::io_context m_commandChannelService;
         TcpSocket m_commandChannelSocket;
-        std::vector<uint8_t> m_readBuffer;
+        PayloadFramer m_commandChannelFramer;
         std::vector<uint8_t> m_writeBuffer;
 
         // Data channel
@@ -202,6 +331,7 @@ namespace Transport
         DataStartTimeCallback m_dataStartTimeCallback;
         MetadataCallback m_metadataCallback;
         NewMeasurementsCallback m_newMeasurementsCallback;
+        NewMeasurementBatchCallback m_newMeasurementBatchCallback;
         MessageCallback m_processingCompleteCallback;
         ConfigurationChangedCallback m_configurationChangedCallback;
         ConnectionTerminatedCallback m_connectionTerminatedCallback;
@@ -211,12 +341,30 @@ namespace Transport
         void RunCallbackThread();
         void RunCommandChannelResponseThread();
         void RunDataChannelResponseThread();
+#ifdef __linux__
+        void RunBatchedDataChannelResponseThread();
+#endif
+        void RunDecodeThread();
+        void RunDataCallbackThread();
 
         // Command channel callbacks
-        void ReadPayloadHeader(const ErrorCode& error, uint32_t bytesTransferred);
-        void ReadPacket(const ErrorCode& error, uint32_t bytesTransferred);
+        void ReadCommandChannel();
+        void ReadPayloads(const ErrorCode& error, uint32_t bytesTransferred);
         void WriteHandler(const ErrorCode& error, uint32_t bytesTransferred);
 
+        // Writes the header of a command with the given length of data to the write buffer,
+        // returning a writer for the command data, then sends the command once it is written
+        BinaryWriter StartServerCommand(uint8_t commandCode, uint32_t length);
+        void CompleteServerCommand(const BinaryWriter& writer);
+
+        // Opens the data channel on the local end point, joining the multicast
+        // group when given one, and starts receiving data packets from it
+        void OpenDataChannel(const GSF::UdpEndPoint& localEndPoint, const GSF::IPAddress& multicastGroup);
+
+        // Data channel callbacks for shared executors
+        void WaitForDataChannel();
+        void ReadDataChannel(const ErrorCode& error);
+
         // Server response handlers
         void ProcessServerResponse(uint8_t* buffer, uint32_t offset, uint32_t length);
         void HandleSucceeded(uint8_t commandCode, uint8_t* data, uint32_t offset, uint32_t length);
@@ -225,17 +373,30 @@ namespace Transport
         void HandleDataStartTime(uint8_t* data, uint32_t offset, uint32_t length);
         void HandleProcessingComplete(uint8_t* data, uint32_t offset, uint32_t length);
         void HandleUpdateSignalIndexCache(uint8_t* data, uint32_t offset, uint32_t length);
+        void HandleUpdateSignalIndexCacheDelta(uint8_t* data, uint32_t offset, uint32_t length);
+        void HandleUpdateMulticastGroup(uint8_t* data, uint32_t offset, uint32_t length);
+        void DecompressSignalIndexCache(const uint8_t* data, uint32_t offset, uint32_t length, std::vector<uint8_t>& buffer) const;
         void HandleUpdateBaseTimes(uint8_t* data, uint32_t offset, uint32_t length);
         void HandleConfigurationChanged(uint8_t* data, uint32_t offset, uint32_t length);
         void HandleDataPacket(uint8_t* data, uint32_t offset, uint32_t length);
-        void ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint32_t length, std::vector<MeasurementPtr>& measurements);
-        void ParseCompactMeasurements(uint8_t* data, uint32_t offset, uint32_t length, bool includeTime, bool useMillisecondResolution, int64_t frameLevelTimestamp, std::vector<MeasurementPtr>& measurements);
+        void QueueDataPacket(uint8_t* data, uint32_t offset, uint32_t length);
+        void ParseDataPacket(uint8_t* data, uint32_t offset, uint32_t length, int64_t* baseTimeOffsets, MeasurementBatch& batch);
+        void ParseTSSCMeasurements(uint8_t* data, uint32_t offset, uint32_t length, MeasurementBatch& batch);
+        void ParsePartitionedTSSCMeasurements(uint8_t* data, uint32_t offset, uint32_t length, MeasurementBatch& batch);
+        void ParseCompactMeasurements(uint8_t* data, uint32_t offset, uint32_t length, bool includeTime, bool useMillisecondResolution, int64_t frameLevelTimestamp, int64_t* baseTimeOffsets, MeasurementBatch& batch);
+        void ToMeasurements(const MeasurementBatch& batch, std::vector<MeasurementPtr>& measurements);
+        void InvokeNewMeasurementsCallbacks(const MeasurementBatch& batch, std::vector<MeasurementPtr>& measurements);
+        MeasurementPtr AcquireMeasurement();
+        int64_t GetDataPacketArrivalTimestamp() const;
+        void RecordDecodeLatency(const MeasurementBatch& batch, int64_t decodeTimestamp);
+        void RecordCallbackLatency(int64_t decodeTimestamp);
 
         // Dispatchers
         void Dispatch(const DispatcherFunction& function);
         void Dispatch(const DispatcherFunction& function, const uint8_t* data, uint32_t offset, uint32_t length);
         void DispatchStatusMessage(const std::string& message);
         void DispatchErrorMessage(const std::string& message);
+        void InvokeDispatcher(const CallbackDispatcher& dispatcher);
 
         static void StatusMessageDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
         static void ErrorMessageDispatcher(DataSubscriber* source, const std::vector<uint8_t>& buffer);
@@ -253,9 +414,16 @@ namespace Transport
         void Disconnect(bool autoReconnect);
 
     public:
-        // Creates a new instance of the data subscriber.
+        // Creates a new instance of the data subscriber
+        // which runs on its own dedicated threads.
         DataSubscriber();
 
+        // Creates a new instance of the data subscriber which runs socket operations and
+        // callbacks on the threads of the given executor. Callbacks are still called one
+        // at a time in order, but not from a single thread. Disconnect must not be called
+        // from within a callback since it waits for pending callbacks to complete.
+        explicit DataSubscriber(const SubscriberExecutorPtr& executor);
+
         // Releases all threads and sockets
         // tied up by the subscriber.
         ~DataSubscriber();
@@ -268,17 +436,27 @@ namespace Transport
         //   void ProcessDataStartTime(DataSubscriber*, int64_t startTime)
         //   void ProcessMetadata(DataSubscriber*, const vector<uint8_t>& metadata)
         //   void ProcessNewMeasurements(DataSubscriber*, const vector<MeasurementPtr>& newMeasurements)
+        //   void ProcessNewMeasurementBatch(DataSubscriber*, const MeasurementBatch& newMeasurements)
         //   void ProcessProcessingComplete(DataSubscriber*, const string& message)
         //   void ProcessConfigurationChanged(DataSubscriber*)
         //   void ProcessConnectionTerminated(DataSubscriber*)
         //
         // Metadata is provided to the user as zlib-compressed XML,
         // and must be decompressed and interpreted before it can be used.
+        //
+        // The measurement batch callback provides the same measurements as the new measurements
+        // callback in columnar form, keyed by runtime signal index. Batch is reused for the next
+        // data packet, so its contents are only valid for the duration of the callback.
+        //
+        // When pipelined data processing is enabled, the new measurements callbacks
+        // are called from a dedicated data callback thread instead of the thread
+        // receiving data from the publisher.
         void RegisterStatusMessageCallback(const MessageCallback& statusMessageCallback);
         void RegisterErrorMessageCallback(const MessageCallback& errorMessageCallback);
         void RegisterDataStartTimeCallback(const DataStartTimeCallback& dataStartTimeCallback);
         void RegisterMetadataCallback(const MetadataCallback& metadataCallback);
         void RegisterNewMeasurementsCallback(const NewMeasurementsCallback& newMeasurementsCallback);
+        void RegisterNewMeasurementBatchCallback(const NewMeasurementBatchCallback& newMeasurementBatchCallback);
         void RegisterProcessingCompleteCallback(const MessageCallback& processingCompleteCallback);
         void RegisterConfigurationChangedCallback(const ConfigurationChangedCallback& configurationChangedCallback);
         void RegisterConnectionTerminatedCallback(const ConnectionTerminatedCallback& connectionTerminatedCallback);
@@ -286,6 +464,9 @@ namespace Transport
 
         const Guid& GetSubscriberID() const;
 
+        // Gets the executor shared with other subscribers, if any.
+        const SubscriberExecutorPtr& GetExecutor() const;
+
         // Gets or sets value that determines whether
         // payload data is compressed using TSSC.
         bool IsPayloadDataCompressed() const;
@@ -301,6 +482,30 @@ namespace Transport
         bool IsSignalIndexCacheCompressed() const;
         void SetSignalIndexCacheCompressed(bool compressed);
 
+        // Gets or sets value that determines whether data packets are processed in stages: the
+        // thread receiving data only queues each packet, a decode thread parses the packets and
+        // a data callback thread calls the new measurements callbacks. This keeps slow callbacks
+        // from stalling socket reads. Changes take effect the next time the subscriber connects.
+        bool IsPipelinedDataProcessing() const;
+        void SetPipelinedDataProcessing(bool pipelined);
+
+        // Gets or sets the maximum number of data packets held by each pipeline queue.
+        uint32_t GetPipelineQueueCapacity() const;
+        void SetPipelineQueueCapacity(uint32_t capacity);
+
+        // Gets or sets the action taken when the data callback thread falls behind and its queue
+        // is full. Decode queue always blocks the receiving thread since TSSC decompression needs
+        // every packet in sequence.
+        BackpressurePolicy GetPipelineBackpressurePolicy() const;
+        void SetPipelineBackpressurePolicy(BackpressurePolicy policy);
+
+        // Gets or sets value that determines whether latency statistics are recorded. Data packet
+        // arrival uses the kernel receive timestamp when available, otherwise the time at which the
+        // packet was handed to the subscriber. Network latency compares this with the timestamps of
+        // the measurements, so it also includes any clock difference with the publisher.
+        bool IsLatencyStatisticsEnabled() const;
+        void SetLatencyStatisticsEnabled(bool enabled);
+
         // Gets or sets user defined data reference
         void* GetUserData() const;
         void SetUserData(void* userData);
@@ -357,6 +562,45 @@ namespace Transport
         uint64_t GetTotalMeasurementsReceived() const;
         bool IsConnected() const;
         bool IsSubscribed() const;
+
+        // Functions for measurement pool statistics. Measurements provided to the new measurements
+        // callback are returned to the pool once all references to them have been released, so the
+        // total allocations will stop increasing when the pool has grown to cover the working set.
+        uint64_t GetTotalMeasurementAllocations() const;
+        uint64_t GetTotalMeasurementAcquisitions() const;
+        uint32_t GetMeasurementPoolSize() const;
+
+        // Functions for command channel read statistics. Each read takes whatever data is
+        // available, so under load a single read can complete many payloads.
+        uint64_t GetTotalCommandChannelReads() const;
+        float64_t GetCommandChannelPayloadsPerRead() const;
+        uint32_t GetMaxCommandChannelPayloadsPerRead() const;
+
+        // Functions for UDP data channel statistics. Truncated datagrams exceeded the receive buffer
+        // and were discarded; dropped datagrams were discarded by the operating system because the
+        // socket receive buffer was full. Truncation and drop counts are only available on Linux.
+        uint64_t GetTotalDataChannelDatagramsReceived() const;
+        uint64_t GetTotalDataChannelDatagramsTruncated() const;
+        uint64_t GetTotalDataChannelDatagramsDropped() const;
+
+        // Gets the total number of measurements dropped, without an error, because their timestamps were
+        // offsets from base times not yet received, e.g., measurements sent over UDP before the first base
+        // times arrive on the command channel. The count is reset on connect.
+        uint64_t GetTotalMeasurementsWithoutBaseTime() const;
+
+        // Functions for pipeline statistics. Max depths and drop counts are reset on connect.
+        uint32_t GetDecodeQueueDepth() const;
+        uint32_t GetDecodeQueueMaxDepth() const;
+        uint32_t GetDataCallbackQueueDepth() const;
+        uint32_t GetDataCallbackQueueMaxDepth() const;
+        uint64_t GetTotalDroppedDataPackets() const;
+
+        // Functions for latency statistics. Values are in ticks and are reset on connect. With
+        // pipelined data processing, decode and callback latencies include time spent waiting in
+        // the pipeline queues.
+        LatencyStatistics GetLatencyStatistics() const;
+        void ResetLatencyStatistics();
+        void ResetLatencyStatistics(LatencyInterval interval);
     };
 }}}
 
@@ -0,0 +1,157 @@
+//******************************************************************************************************
+//  DatagramSender.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "DatagramSender.h"
+
+#ifdef __linux__
+#include <cerrno>
+#include <cstring>
+#endif
+
+using namespace std;
+using namespace boost::asio;
+using namespace GSF;
+using namespace GSF::TimeSeries::Transport;
+
+DatagramSender::DatagramSender(IOContext& ioContext) :
+    m_socket(ioContext),
+    m_totalBytesSent(0UL)
+{
+}
+
+void DatagramSender::Open(const UdpEndPoint& destination)
+{
+    Close();
+
+    m_socket.open(destination.protocol());
+    m_destination = destination;
+}
+
+void DatagramSender::Close()
+{
+    ErrorCode error;
+
+    m_datagrams.clear();
+    m_socket.close(error);
+}
+
+bool DatagramSender::IsOpen() const
+{
+    return m_socket.is_open();
+}
+
+UdpSocket& DatagramSender::Socket()
+{
+    return m_socket;
+}
+
+const UdpEndPoint& DatagramSender::GetDestination() const
+{
+    return m_destination;
+}
+
+bool DatagramSender::Add(const SharedPtr<vector<uint8_t>>& buffer, uint32_t offset, uint32_t length)
+{
+    m_datagrams.push_back({ buffer, offset, length });
+    return m_datagrams.size() >= MaxBatchSize;
+}
+
+bool DatagramSender::Flush(string& errorMessage)
+{
+    const size_t count = m_datagrams.size();
+    bool success = true;
+
+    if (count == 0)
+        return success;
+
+#ifdef __linux__
+    const int socket = m_socket.native_handle();
+
+    m_vectors.resize(count);
+    m_messages.resize(count);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const Datagram& datagram = m_datagrams[i];
+        iovec& datagramVector = m_vectors[i];
+        msghdr& header = m_messages[i].msg_hdr;
+
+        datagramVector.iov_base = datagram.Buffer->data() + datagram.Offset;
+        datagramVector.iov_len = datagram.Length;
+
+        memset(&header, 0, sizeof(msghdr));
+        header.msg_name = m_destination.data();
+        header.msg_namelen = static_cast<socklen_t>(m_destination.size());
+        header.msg_iov = &datagramVector;
+        header.msg_iovlen = 1;
+    }
+
+    size_t sent = 0;
+
+    // Kernel may send fewer datagrams than requested per call
+    while (sent < count)
+    {
+        const int result = sendmmsg(socket, &m_messages[sent], static_cast<uint32_t>(count - sent), 0);
+
+        if (result < 0)
+        {
+            if (errno == EINTR)
+                continue;
+
+            errorMessage = strerror(errno);
+            success = false;
+            break;
+        }
+
+        for (size_t i = sent; i < sent + result; i++)
+            m_totalBytesSent += m_messages[i].msg_len;
+
+        sent += static_cast<size_t>(result);
+    }
+#else
+    for (const Datagram& datagram : m_datagrams)
+    {
+        ErrorCode error;
+        m_socket.send_to(buffer(datagram.Buffer->data() + datagram.Offset, datagram.Length), m_destination, 0, error);
+
+        if (error)
+        {
+            errorMessage = SystemError(error).what();
+            success = false;
+            break;
+        }
+
+        m_totalBytesSent += datagram.Length;
+    }
+#endif
+
+    // Sent buffers return to their pool
+    m_datagrams.clear();
+
+    return success;
+}
+
+uint64_t DatagramSender::GetTotalBytesSent() const
+{
+    return m_totalBytesSent;
+}
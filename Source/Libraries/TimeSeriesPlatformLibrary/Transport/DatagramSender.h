@@ -0,0 +1,94 @@
+//******************************************************************************************************
+//  DatagramSender.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __DATAGRAM_SENDER_H
+#define __DATAGRAM_SENDER_H
+
+#include "../Common/CommonTypes.h"
+
+#ifdef __linux__
+#include <sys/socket.h>
+#endif
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Sends datagrams to a single destination in batches.
+    //
+    // Datagrams are collected from send buffers, which are referenced until the batch is sent,
+    // then a flush sends the whole batch with a single sendmmsg call on Linux or one send per
+    // datagram elsewhere. The sender is not thread-safe, callers serialize access to it.
+    class DatagramSender // NOLINT
+    {
+    private:
+        // Datagram within a send buffer
+        struct Datagram
+        {
+            SharedPtr<std::vector<uint8_t>> Buffer;
+            uint32_t Offset;
+            uint32_t Length;
+        };
+
+        GSF::UdpSocket m_socket;
+        GSF::UdpEndPoint m_destination;
+        std::vector<Datagram> m_datagrams;
+        uint64_t m_totalBytesSent;
+#ifdef __linux__
+        std::vector<iovec> m_vectors;
+        std::vector<mmsghdr> m_messages;
+#endif
+
+    public:
+        // Most datagrams collected before a batch should be sent without waiting for the flush
+        static const uint32_t MaxBatchSize = 64U;
+
+        // Creates a new closed datagram sender.
+        DatagramSender(GSF::IOContext& ioContext);
+
+        // Opens the socket for sending to the destination, throws on failure.
+        void Open(const GSF::UdpEndPoint& destination);
+
+        // Closes the socket, discarding any datagrams not yet sent.
+        void Close();
+
+        bool IsOpen() const;
+
+        // Gets the socket, e.g., to bind it or set options, once it is open.
+        GSF::UdpSocket& Socket();
+
+        const GSF::UdpEndPoint& GetDestination() const;
+
+        // Adds the length bytes at the offset within the send buffer to the batch as one
+        // datagram. Returns true when the batch is full and should be flushed.
+        bool Add(const SharedPtr<std::vector<uint8_t>>& buffer, uint32_t offset, uint32_t length);
+
+        // Sends the batch and releases its send buffers. Returns false, with a description
+        // of the error, when sending failed; datagrams not yet sent are discarded.
+        bool Flush(std::string& errorMessage);
+
+        uint64_t GetTotalBytesSent() const;
+    };
+}}}
+
+#endif
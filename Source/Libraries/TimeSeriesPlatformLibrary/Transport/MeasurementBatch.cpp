@@ -0,0 +1,164 @@
+//******************************************************************************************************
+//  MeasurementBatch.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//       Added in-place extension so packets can be parsed directly into the measurement arrays.
+//
+//******************************************************************************************************
+
+#include "MeasurementBatch.h"
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+MeasurementBatch::MeasurementBatch() :
+    m_signalIndexCache(nullptr),
+    m_receiveTimestamp(0L)
+{
+}
+
+// Gets the number of measurements in the batch.
+uint32_t MeasurementBatch::Count() const
+{
+    return static_cast<uint32_t>(m_signalIndexes.size());
+}
+
+const vector<uint16_t>& MeasurementBatch::GetSignalIndexes() const
+{
+    return m_signalIndexes;
+}
+
+const vector<int64_t>& MeasurementBatch::GetTimestamps() const
+{
+    return m_timestamps;
+}
+
+const vector<float64_t>& MeasurementBatch::GetValues() const
+{
+    return m_values;
+}
+
+const vector<uint32_t>& MeasurementBatch::GetFlags() const
+{
+    return m_flags;
+}
+
+const SignalIndexCachePtr& MeasurementBatch::GetSignalIndexCache() const
+{
+    return m_signalIndexCache;
+}
+
+void MeasurementBatch::SetSignalIndexCache(const SignalIndexCachePtr& signalIndexCache)
+{
+    m_signalIndexCache = signalIndexCache;
+}
+
+int64_t MeasurementBatch::GetReceiveTimestamp() const
+{
+    return m_receiveTimestamp;
+}
+
+void MeasurementBatch::SetReceiveTimestamp(const int64_t receiveTimestamp)
+{
+    m_receiveTimestamp = receiveTimestamp;
+}
+
+// Gets the globally unique signal ID of the measurement at the given position in the batch.
+Guid MeasurementBatch::GetSignalID(const uint32_t index) const
+{
+    if (m_signalIndexCache == nullptr || index >= m_signalIndexes.size())
+        return Empty::Guid;
+
+    return m_signalIndexCache->GetSignalID(m_signalIndexes[index]);
+}
+
+// Adds a measurement to the end of the batch.
+void MeasurementBatch::Add(const uint16_t signalIndex, const int64_t timestamp, const float64_t value, const uint32_t flags)
+{
+    m_signalIndexes.push_back(signalIndex);
+    m_timestamps.push_back(timestamp);
+    m_values.push_back(value);
+    m_flags.push_back(flags);
+}
+
+// Reserves space for the given number of measurements.
+void MeasurementBatch::Reserve(const uint32_t count)
+{
+    m_signalIndexes.reserve(count);
+    m_timestamps.reserve(count);
+    m_values.reserve(count);
+    m_flags.reserve(count);
+}
+
+// Adds the given number of zeroed measurements to the end of the batch.
+uint32_t MeasurementBatch::Extend(const uint32_t count)
+{
+    const uint32_t start = Count();
+
+    m_signalIndexes.resize(start + count);
+    m_timestamps.resize(start + count);
+    m_values.resize(start + count);
+    m_flags.resize(start + count);
+
+    return start;
+}
+
+// Removes measurements from the end of the batch until the given number remain.
+void MeasurementBatch::Truncate(const uint32_t count)
+{
+    if (count >= Count())
+        return;
+
+    m_signalIndexes.resize(count);
+    m_timestamps.resize(count);
+    m_values.resize(count);
+    m_flags.resize(count);
+}
+
+uint16_t* MeasurementBatch::GetSignalIndexData()
+{
+    return m_signalIndexes.data();
+}
+
+int64_t* MeasurementBatch::GetTimestampData()
+{
+    return m_timestamps.data();
+}
+
+float64_t* MeasurementBatch::GetValueData()
+{
+    return m_values.data();
+}
+
+uint32_t* MeasurementBatch::GetFlagData()
+{
+    return m_flags.data();
+}
+
+// Removes all measurements and the receive timestamp from the batch, retaining allocated capacity.
+void MeasurementBatch::Clear()
+{
+    m_signalIndexes.clear();
+    m_timestamps.clear();
+    m_values.clear();
+    m_flags.clear();
+    m_receiveTimestamp = 0L;
+}
@@ -0,0 +1,103 @@
+//******************************************************************************************************
+//  MeasurementBatch.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//       Added in-place extension so packets can be parsed directly into the measurement arrays.
+//
+//******************************************************************************************************
+
+#ifndef __MEASUREMENT_BATCH_H
+#define __MEASUREMENT_BATCH_H
+
+#include "TransportTypes.h"
+#include "SignalIndexCache.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Columnar set of measurements parsed from a data packet.
+    //
+    // Each measurement is stored as its 16-bit runtime signal index, timestamp, value and
+    // flags in parallel contiguous arrays, i.e., element i of each array belongs to the same
+    // measurement. Globally unique signal IDs and human-readable measurement keys can be
+    // resolved as needed from the runtime signal index using the signal index cache that was
+    // active when the batch was parsed.
+    class MeasurementBatch
+    {
+    private:
+        std::vector<uint16_t> m_signalIndexes;
+        std::vector<int64_t> m_timestamps;
+        std::vector<float64_t> m_values;
+        std::vector<uint32_t> m_flags;
+        SignalIndexCachePtr m_signalIndexCache;
+        int64_t m_receiveTimestamp;
+
+    public:
+        // Creates a new empty batch.
+        MeasurementBatch();
+
+        // Gets the number of measurements in the batch.
+        uint32_t Count() const;
+
+        // Gets the contiguous measurement arrays.
+        const std::vector<uint16_t>& GetSignalIndexes() const;
+        const std::vector<int64_t>& GetTimestamps() const;
+        const std::vector<float64_t>& GetValues() const;
+        const std::vector<uint32_t>& GetFlags() const;
+
+        // Gets the signal index cache used to resolve runtime signal indexes.
+        const SignalIndexCachePtr& GetSignalIndexCache() const;
+        void SetSignalIndexCache(const SignalIndexCachePtr& signalIndexCache);
+
+        // Gets or sets the time, in ticks, at which the data packet was received from the
+        // network. Value is zero when the receive time was not captured.
+        int64_t GetReceiveTimestamp() const;
+        void SetReceiveTimestamp(int64_t receiveTimestamp);
+
+        // Gets the globally unique signal ID of the measurement at the given position in the batch.
+        GSF::Guid GetSignalID(uint32_t index) const;
+
+        // Adds a measurement to the end of the batch.
+        void Add(uint16_t signalIndex, int64_t timestamp, float64_t value, uint32_t flags);
+
+        // Reserves space for the given number of measurements.
+        void Reserve(uint32_t count);
+
+        // Adds the given number of zeroed measurements to the end of the batch so they can be
+        // written in place through the array data pointers. Returns the position of the first one.
+        uint32_t Extend(uint32_t count);
+
+        // Removes measurements from the end of the batch until the given number remain.
+        void Truncate(uint32_t count);
+
+        // Gets writable pointers to the measurement arrays, valid until the batch is next resized.
+        uint16_t* GetSignalIndexData();
+        int64_t* GetTimestampData();
+        float64_t* GetValueData();
+        uint32_t* GetFlagData();
+
+        // Removes all measurements and the receive timestamp from the batch, retaining allocated capacity.
+        void Clear();
+    };
+
+    typedef SharedPtr<MeasurementBatch> MeasurementBatchPtr;
+}}}
+
+#endif
@@ -0,0 +1,353 @@
+//******************************************************************************************************
+//  MetadataSnapshot.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "MetadataSnapshot.h"
+#include "../Common/Convert.h"
+#include "../Common/BinaryCodec.h"
+#include <boost/iostreams/device/mapped_file.hpp>
+#include <algorithm>
+#include <cstdio>
+#include <fstream>
+
+using namespace std;
+using namespace boost::iostreams;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+static const uint8_t FileMagic[4] = { 'G', 'S', 'F', 'M' };
+static const uint32_t FormatVersion = 1U;
+
+// Fixed sizes of the records that follow the string table
+static const uint32_t DeviceRecordLength = 72;
+static const uint32_t MeasurementRecordLength = 65;
+static const uint32_t PhasorRecordLength = 26;
+
+// Timestamps are stored as ticks, special values such as not-a-date-time are stored as the minimum value
+static int64_t ToSnapshotTicks(const DateTime& timestamp)
+{
+    return timestamp.is_special() ? Int64::MinValue : ToTicks(timestamp);
+}
+
+static DateTime FromSnapshotTicks(const int64_t ticks)
+{
+    return ticks == Int64::MinValue ? DateTime() : FromTicks(ticks);
+}
+
+MetadataSnapshot::MetadataSnapshot() :
+    NodeID(Empty::Guid),
+    VersionNumber(0)
+{
+}
+
+// Loads the snapshot from the given file.
+bool MetadataSnapshot::Load(const string& fileName, const string& connectionKey)
+{
+    Clear();
+
+    try
+    {
+        const mapped_file_source file(fileName);
+        BinaryReader reader(reinterpret_cast<const uint8_t*>(file.data()), 0, static_cast<uint32_t>(file.size()));
+        vector<pair<const char*, uint32_t>> strings;
+
+        if (memcmp(reader.ReadBytes(sizeof(FileMagic)), FileMagic, sizeof(FileMagic)) != 0 || reader.ReadLittleEndian<uint32_t>() != FormatVersion)
+            return false;
+
+        reader.ReadBytes(NodeID.data, 16);
+        VersionNumber = reader.ReadLittleEndian<int32_t>();
+
+        const uint32_t connectionKeyLength = reader.ReadLittleEndian<uint32_t>();
+        ConnectionKey.assign(reinterpret_cast<const char*>(reader.ReadBytes(connectionKeyLength)), connectionKeyLength);
+
+        if (ConnectionKey != connectionKey)
+        {
+            Clear();
+            return false;
+        }
+
+        // String table entries point into the mapped file, strings
+        // are only copied out when a record field is assigned
+        const uint32_t stringCount = reader.ReadLittleEndian<uint32_t>();
+        strings.reserve(min(stringCount, reader.Remaining() / 4));
+
+        for (uint32_t i = 0; i < stringCount; i++)
+        {
+            const uint32_t length = reader.ReadLittleEndian<uint32_t>();
+            strings.emplace_back(reinterpret_cast<const char*>(reader.ReadBytes(length)), length);
+        }
+
+        const auto readString = [&](string& value)
+        {
+            const uint32_t index = reader.ReadLittleEndian<uint32_t>();
+
+            if (index >= strings.size())
+                throw out_of_range("Metadata snapshot string index is out of range");
+
+            value.assign(strings[index].first, strings[index].second);
+        };
+
+        const uint32_t deviceCount = reader.ReadLittleEndian<uint32_t>();
+        Devices.reserve(min(deviceCount, reader.Remaining() / DeviceRecordLength));
+
+        for (uint32_t i = 0; i < deviceCount; i++)
+        {
+            DeviceMetadataPtr device = NewSharedPtr<DeviceMetadata>();
+
+            readString(device->Acronym);
+            readString(device->Name);
+            reader.ReadBytes(device->UniqueID.data, 16);
+            device->AccessID = reader.ReadLittleEndian<uint16_t>();
+            readString(device->ParentAcronym);
+            readString(device->ProtocolName);
+            device->FramesPerSecond = reader.ReadLittleEndian<uint16_t>();
+            readString(device->CompanyAcronym);
+            readString(device->VendorAcronym);
+            readString(device->VendorDeviceName);
+            device->Longitude = reader.ReadLittleEndian<float64_t>();
+            device->Latitude = reader.ReadLittleEndian<float64_t>();
+            device->UpdatedOn = FromSnapshotTicks(reader.ReadLittleEndian<int64_t>());
+
+            Devices.push_back(device);
+        }
+
+        const uint32_t measurementCount = reader.ReadLittleEndian<uint32_t>();
+        Measurements.reserve(min(measurementCount, reader.Remaining() / MeasurementRecordLength));
+
+        for (uint32_t i = 0; i < measurementCount; i++)
+        {
+            MeasurementMetadataPtr measurement = NewSharedPtr<MeasurementMetadata>();
+
+            readString(measurement->DeviceAcronym);
+            readString(measurement->ID);
+            reader.ReadBytes(measurement->SignalID.data, 16);
+            readString(measurement->PointTag);
+            reader.ReadBytes(measurement->Reference.SignalID.data, 16);
+            readString(measurement->Reference.Acronym);
+            measurement->Reference.Index = reader.ReadLittleEndian<uint16_t>();
+            measurement->Reference.Kind = static_cast<SignalKind>(min(reader.ReadByte(), static_cast<uint8_t>(SignalKind::Unknown)));
+            measurement->PhasorSourceIndex = reader.ReadLittleEndian<uint16_t>();
+            readString(measurement->Description);
+            measurement->UpdatedOn = FromSnapshotTicks(reader.ReadLittleEndian<int64_t>());
+
+            Measurements.push_back(measurement);
+        }
+
+        const uint32_t phasorCount = reader.ReadLittleEndian<uint32_t>();
+        Phasors.reserve(min(phasorCount, reader.Remaining() / PhasorRecordLength));
+
+        for (uint32_t i = 0; i < phasorCount; i++)
+        {
+            PhasorMetadataPtr phasor = NewSharedPtr<PhasorMetadata>();
+
+            readString(phasor->DeviceAcronym);
+            readString(phasor->Label);
+            readString(phasor->Type);
+            readString(phasor->Phase);
+            phasor->SourceIndex = reader.ReadLittleEndian<uint16_t>();
+            phasor->UpdatedOn = FromSnapshotTicks(reader.ReadLittleEndian<int64_t>());
+
+            Phasors.push_back(phasor);
+        }
+    }
+    catch (const exception&)
+    {
+        // Missing, truncated or otherwise unreadable files are treated as having no snapshot
+        Clear();
+        return false;
+    }
+
+    return true;
+}
+
+// Serializes the snapshot into the binary image that is saved to the file.
+void MetadataSnapshot::Serialize(vector<uint8_t>& buffer) const
+{
+    unordered_map<string, uint32_t> stringLookup;
+    vector<const string*> strings;
+    uint32_t stringTableLength = 4;
+
+    // Most string values, e.g., device acronyms, repeat across many
+    // records so each distinct string is only stored once
+    const auto intern = [&](const string& value)
+    {
+        if (stringLookup.emplace(value, static_cast<uint32_t>(strings.size())).second)
+        {
+            strings.push_back(&value);
+            stringTableLength += 4 + static_cast<uint32_t>(value.size());
+        }
+    };
+
+    for (const auto& device : Devices)
+    {
+        intern(device->Acronym);
+        intern(device->Name);
+        intern(device->ParentAcronym);
+        intern(device->ProtocolName);
+        intern(device->CompanyAcronym);
+        intern(device->VendorAcronym);
+        intern(device->VendorDeviceName);
+    }
+
+    for (const auto& measurement : Measurements)
+    {
+        intern(measurement->DeviceAcronym);
+        intern(measurement->ID);
+        intern(measurement->PointTag);
+        intern(measurement->Reference.Acronym);
+        intern(measurement->Description);
+    }
+
+    for (const auto& phasor : Phasors)
+    {
+        intern(phasor->DeviceAcronym);
+        intern(phasor->Label);
+        intern(phasor->Type);
+        intern(phasor->Phase);
+    }
+
+    const uint32_t binaryLength = sizeof(FileMagic) + 28 + static_cast<uint32_t>(ConnectionKey.size()) + stringTableLength +
+        12 + static_cast<uint32_t>(Devices.size()) * DeviceRecordLength +
+        static_cast<uint32_t>(Measurements.size()) * MeasurementRecordLength +
+        static_cast<uint32_t>(Phasors.size()) * PhasorRecordLength;
+
+    buffer.assign(binaryLength, 0);
+    BinaryWriter writer(buffer);
+
+    const auto writeString = [&](const string& value)
+    {
+        writer.WriteLittleEndian(stringLookup[value]);
+    };
+
+    writer.WriteBytes(FileMagic, sizeof(FileMagic));
+    writer.WriteLittleEndian(FormatVersion);
+    writer.WriteGuid(NodeID);
+    writer.WriteLittleEndian(VersionNumber);
+    writer.WriteLittleEndian(static_cast<uint32_t>(ConnectionKey.size()));
+    writer.WriteBytes(ConnectionKey.data(), static_cast<uint32_t>(ConnectionKey.size()));
+
+    writer.WriteLittleEndian(static_cast<uint32_t>(strings.size()));
+
+    for (const string* value : strings)
+    {
+        writer.WriteLittleEndian(static_cast<uint32_t>(value->size()));
+        writer.WriteBytes(value->data(), static_cast<uint32_t>(value->size()));
+    }
+
+    writer.WriteLittleEndian(static_cast<uint32_t>(Devices.size()));
+
+    for (const auto& device : Devices)
+    {
+        writeString(device->Acronym);
+        writeString(device->Name);
+        writer.WriteGuid(device->UniqueID);
+        writer.WriteLittleEndian(device->AccessID);
+        writeString(device->ParentAcronym);
+        writeString(device->ProtocolName);
+        writer.WriteLittleEndian(device->FramesPerSecond);
+        writeString(device->CompanyAcronym);
+        writeString(device->VendorAcronym);
+        writeString(device->VendorDeviceName);
+        writer.WriteLittleEndian(device->Longitude);
+        writer.WriteLittleEndian(device->Latitude);
+        writer.WriteLittleEndian(ToSnapshotTicks(device->UpdatedOn));
+    }
+
+    writer.WriteLittleEndian(static_cast<uint32_t>(Measurements.size()));
+
+    for (const auto& measurement : Measurements)
+    {
+        writeString(measurement->DeviceAcronym);
+        writeString(measurement->ID);
+        writer.WriteGuid(measurement->SignalID);
+        writeString(measurement->PointTag);
+        writer.WriteGuid(measurement->Reference.SignalID);
+        writeString(measurement->Reference.Acronym);
+        writer.WriteLittleEndian(measurement->Reference.Index);
+        writer.WriteByte(static_cast<uint8_t>(measurement->Reference.Kind));
+        writer.WriteLittleEndian(measurement->PhasorSourceIndex);
+        writeString(measurement->Description);
+        writer.WriteLittleEndian(ToSnapshotTicks(measurement->UpdatedOn));
+    }
+
+    writer.WriteLittleEndian(static_cast<uint32_t>(Phasors.size()));
+
+    for (const auto& phasor : Phasors)
+    {
+        writeString(phasor->DeviceAcronym);
+        writeString(phasor->Label);
+        writeString(phasor->Type);
+        writeString(phasor->Phase);
+        writer.WriteLittleEndian(phasor->SourceIndex);
+        writer.WriteLittleEndian(ToSnapshotTicks(phasor->UpdatedOn));
+    }
+}
+
+// Saves the snapshot to the given file, replacing any existing file only once the new one is complete.
+void MetadataSnapshot::Save(const string& fileName) const
+{
+    vector<uint8_t> buffer;
+    Serialize(buffer);
+
+    // Write to a temporary file first so a reader never sees a partially written snapshot
+    const string tempFileName = fileName + ".tmp";
+
+    {
+        ofstream stream(tempFileName, ios::binary | ios::trunc);
+        stream.write(reinterpret_cast<const char*>(buffer.data()), buffer.size());
+
+        if (!stream)
+            throw SubscriberException("Failed to write metadata snapshot file \"" + tempFileName + "\"");
+    }
+
+    if (rename(tempFileName.c_str(), fileName.c_str()) != 0)
+    {
+        // Rename does not replace an existing file on all platforms
+        remove(fileName.c_str());
+
+        if (rename(tempFileName.c_str(), fileName.c_str()) != 0)
+            throw SubscriberException("Failed to replace metadata snapshot file \"" + fileName + "\"");
+    }
+}
+
+// Determines if the snapshot defines the same publisher, version and records as the other snapshot.
+bool MetadataSnapshot::IsEquivalent(const MetadataSnapshot& other) const
+{
+    vector<uint8_t> buffer, otherBuffer;
+
+    Serialize(buffer);
+    other.Serialize(otherBuffer);
+
+    return buffer == otherBuffer;
+}
+
+// Empties the snapshot.
+void MetadataSnapshot::Clear()
+{
+    NodeID = Empty::Guid;
+    VersionNumber = 0;
+    ConnectionKey.clear();
+    Devices.clear();
+    Measurements.clear();
+    Phasors.clear();
+}
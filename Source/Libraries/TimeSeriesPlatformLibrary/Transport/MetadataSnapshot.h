@@ -0,0 +1,78 @@
+//******************************************************************************************************
+//  MetadataSnapshot.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __METADATA_SNAPSHOT_H
+#define __METADATA_SNAPSHOT_H
+
+#include "TransportTypes.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Parsed publisher metadata records that can be saved to a local file and loaded back.
+    //
+    // The file is a compact binary image: a header identifying the publisher, a table of the
+    // distinct strings followed by fixed-size device, measurement and phasor records that refer
+    // to the strings by index. Loading memory maps the file and builds the records straight from
+    // the mapped bytes, which takes a fraction of the time needed to decompress and parse the
+    // metadata XML, let alone request it from the publisher.
+    class MetadataSnapshot // NOLINT
+    {
+    public:
+        // ID of the publisher node that defined the metadata
+        GSF::Guid NodeID;
+
+        // Version number of the publisher metadata
+        int32_t VersionNumber;
+
+        // Identifies the connection and metadata filters the metadata was requested with,
+        // a snapshot is only loaded for the same connection key
+        std::string ConnectionKey;
+
+        // Metadata records, in the order they were defined by the publisher
+        std::vector<DeviceMetadataPtr> Devices;
+        std::vector<MeasurementMetadataPtr> Measurements;
+        std::vector<PhasorMetadataPtr> Phasors;
+
+        MetadataSnapshot();
+
+        // Loads the snapshot from the given file. Returns false, leaving the snapshot empty, when the file
+        // does not exist, is not a valid snapshot or was saved for a different connection key.
+        bool Load(const std::string& fileName, const std::string& connectionKey);
+
+        // Saves the snapshot to the given file, replacing any existing file only once the new one is complete.
+        void Save(const std::string& fileName) const;
+
+        // Determines if the snapshot defines the same publisher, version and records as the other snapshot.
+        bool IsEquivalent(const MetadataSnapshot& other) const;
+
+        // Empties the snapshot.
+        void Clear();
+
+    private:
+        void Serialize(std::vector<uint8_t>& buffer) const;
+    };
+}}}
+
+#endif
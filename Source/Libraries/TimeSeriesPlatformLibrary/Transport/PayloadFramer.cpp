@@ -0,0 +1,149 @@
+//******************************************************************************************************
+//  PayloadFramer.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "PayloadFramer.h"
+#include "Constants.h"
+#include "../Common/EndianConverter.h"
+#include <cstring>
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+PayloadFramer::PayloadFramer(uint32_t bufferSize) :
+    m_buffer(max(bufferSize, static_cast<uint32_t>(Common::MaxPacketSize))),
+    m_readOffset(0),
+    m_writeOffset(0),
+    m_totalReads(0UL),
+    m_totalPayloads(0UL),
+    m_lastReadPayloads(0),
+    m_maxPayloadsPerRead(0)
+{
+}
+
+// Gets the free space at the end of the buffer that the next read should fill.
+boost::asio::mutable_buffer PayloadFramer::GetReadBuffer()
+{
+    const uint32_t PacketSizeOffset = 4;
+
+    // Move the start of a partially received payload to the front of the buffer
+    if (m_readOffset > 0)
+    {
+        const uint32_t remaining = m_writeOffset - m_readOffset;
+
+        if (remaining > 0)
+            memmove(m_buffer.data(), m_buffer.data() + m_readOffset, remaining);
+
+        m_readOffset = 0;
+        m_writeOffset = remaining;
+    }
+
+    // Make sure a payload larger than the buffer can be received in full
+    if (m_writeOffset >= Common::PayloadHeaderSize)
+    {
+        const uint32_t packetSize = EndianConverter::ToLittleEndian<uint32_t>(m_buffer.data(), PacketSizeOffset);
+        const size_t payloadSize = static_cast<size_t>(Common::PayloadHeaderSize) + packetSize;
+
+        if (payloadSize > m_buffer.size())
+            m_buffer.resize(payloadSize);
+    }
+
+    return boost::asio::buffer(m_buffer.data() + m_writeOffset, m_buffer.size() - m_writeOffset);
+}
+
+// Adds the given number of bytes, read into the buffer from GetReadBuffer, to the framer.
+void PayloadFramer::CommitRead(uint32_t bytesTransferred)
+{
+    m_writeOffset += bytesTransferred;
+    m_totalReads++;
+    m_lastReadPayloads = 0;
+}
+
+// Gets the next complete payload body.
+bool PayloadFramer::TryGetPayload(uint8_t*& payload, uint32_t& length)
+{
+    const uint32_t PacketSizeOffset = 4;
+    const uint32_t available = m_writeOffset - m_readOffset;
+
+    if (available < Common::PayloadHeaderSize)
+        return false;
+
+    const uint32_t packetSize = EndianConverter::ToLittleEndian<uint32_t>(m_buffer.data(), m_readOffset + PacketSizeOffset);
+
+    if (available - Common::PayloadHeaderSize < packetSize)
+        return false;
+
+    payload = m_buffer.data() + m_readOffset + Common::PayloadHeaderSize;
+    length = packetSize;
+    m_readOffset += Common::PayloadHeaderSize + packetSize;
+
+    // Gather statistics
+    m_totalPayloads++;
+    m_lastReadPayloads++;
+
+    if (m_lastReadPayloads > m_maxPayloadsPerRead)
+        m_maxPayloadsPerRead = m_lastReadPayloads;
+
+    return true;
+}
+
+// Discards all buffered data and statistics.
+void PayloadFramer::Reset()
+{
+    m_readOffset = 0;
+    m_writeOffset = 0;
+    m_totalReads = 0UL;
+    m_totalPayloads = 0UL;
+    m_lastReadPayloads = 0;
+    m_maxPayloadsPerRead = 0;
+}
+
+uint64_t PayloadFramer::GetTotalReads() const
+{
+    return m_totalReads;
+}
+
+uint64_t PayloadFramer::GetTotalPayloads() const
+{
+    return m_totalPayloads;
+}
+
+uint32_t PayloadFramer::GetLastReadPayloads() const
+{
+    return m_lastReadPayloads;
+}
+
+uint32_t PayloadFramer::GetMaxPayloadsPerRead() const
+{
+    return m_maxPayloadsPerRead;
+}
+
+// Gets the average number of payloads completed per read.
+float64_t PayloadFramer::GetAveragePayloadsPerRead() const
+{
+    if (m_totalReads == 0UL)
+        return 0.0;
+
+    return static_cast<float64_t>(m_totalPayloads) / static_cast<float64_t>(m_totalReads);
+}
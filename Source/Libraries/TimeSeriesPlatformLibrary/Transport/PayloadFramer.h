@@ -0,0 +1,91 @@
+//******************************************************************************************************
+//  PayloadFramer.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __PAYLOAD_FRAMER_H
+#define __PAYLOAD_FRAMER_H
+
+#include "../Common/CommonTypes.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Extracts complete payloads from the byte stream of a GEP command channel.
+    //
+    // Rather than reading each payload header and body separately, the command channel
+    // reads as much data as is available into the framer's buffer and then extracts as
+    // many complete payloads as it holds. A payload that spans reads stays in the buffer
+    // until the rest of it arrives; unconsumed bytes are moved to the front of the buffer
+    // before the next read so that payloads are always contiguous. The buffer grows when
+    // a payload larger than the buffer is received.
+    class PayloadFramer // NOLINT
+    {
+    private:
+        std::vector<uint8_t> m_buffer;
+        uint32_t m_readOffset;
+        uint32_t m_writeOffset;
+
+        // Statistics
+        uint64_t m_totalReads;
+        uint64_t m_totalPayloads;
+        uint32_t m_lastReadPayloads;
+        uint32_t m_maxPayloadsPerRead;
+
+    public:
+        // Creates a new framer with the given initial buffer size.
+        PayloadFramer(uint32_t bufferSize = 65536);
+
+        // Gets the free space at the end of the buffer that the next read
+        // should fill. Payloads previously extracted become invalid.
+        boost::asio::mutable_buffer GetReadBuffer();
+
+        // Adds the given number of bytes, read into the
+        // buffer from GetReadBuffer, to the framer.
+        void CommitRead(uint32_t bytesTransferred);
+
+        // Gets the next complete payload body, i.e., the bytes following the payload header.
+        // Returns false when the buffer does not contain another complete payload. The payload
+        // remains valid until the next call to GetReadBuffer or Reset.
+        bool TryGetPayload(uint8_t*& payload, uint32_t& length);
+
+        // Discards all buffered data and statistics.
+        void Reset();
+
+        // Gets the total number of reads committed to the framer.
+        uint64_t GetTotalReads() const;
+
+        // Gets the total number of payloads extracted from the framer.
+        uint64_t GetTotalPayloads() const;
+
+        // Gets the number of payloads completed by the most recent read.
+        uint32_t GetLastReadPayloads() const;
+
+        // Gets the largest number of payloads completed by a single read.
+        uint32_t GetMaxPayloadsPerRead() const;
+
+        // Gets the average number of payloads completed per read.
+        float64_t GetAveragePayloadsPerRead() const;
+    };
+}}}
+
+#endif
@@ -20,13 +20,19 @@
 //       Generated original version of source code.
 //  02/07/2019 - J. Ritchie Carroll
 //       Moved parse functionality into class, added generate functionality.
+//  10/15/2026 - GSF Development Team
+//       Runtime IDs now index a flat table, sources are interned and key lookups can return references.
+//       Parse and serialize now use BinaryReader and BinaryWriter over exactly sized buffers.
+//       Added span parsing with reserved containers, key removal and signal index cache deltas.
+//       Added equivalence test used to share one cache between identical subscriptions.
 //
 //******************************************************************************************************
 
 #include "SignalIndexCache.h"
 #include "DataPublisher.h"
 #include "../Common/Convert.h"
-#include "../Common/EndianConverter.h"
+#include "../Common/BinaryCodec.h"
+#include <algorithm>
 
 using namespace std;
 using namespace GSF;
@@ -34,17 +40,106 @@ using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
 SignalIndexCache::SignalIndexCache() :
-    m_binaryLength(28)
+    m_referenceCount(0),
+    m_binaryLength(28),
+    m_lastSourceIndex(0)
 {
 }
 
-// Adds a measurement key to the cache.
+// Encodes a measurement key in the serialized signal index cache format.
+static void WriteMeasurementKey(BinaryWriter& writer, const uint16_t signalIndex, Guid signalID, const vector<uint8_t>& sourceBytes, const uint32_t id)
+{
+    // Encode run-time signal index
+    writer.WriteBigEndian(signalIndex);
+
+    // Encode signal ID
+    SwapGuidEndianness(signalID, true);
+    writer.WriteGuid(signalID);
+
+    // Encode source
+    writer.WriteBigEndian(int32_t(sourceBytes.size()));
+    writer.WriteBytes(sourceBytes);
+
+    // Encode ID
+    writer.WriteBigEndian(id);
+}
+
+// Gets the position in the signal lists of the given runtime ID, or NotMapped.
+inline uint32_t SignalIndexCache::GetVectorIndex(const uint16_t signalIndex) const
+{
+    // Table is only allocated once the first key is added
+    if (signalIndex >= m_reference.size())
+        return NotMapped;
+
+    return m_reference[signalIndex];
+}
+
+// Determines whether the key at the position in the signal lists matches the key at the position in the other cache.
+bool SignalIndexCache::HasSameKey(const uint32_t vectorIndex, const SignalIndexCache& other, const uint32_t otherVectorIndex) const
+{
+    return
+        m_signalIDList[vectorIndex] == other.m_signalIDList[otherVectorIndex] &&
+        m_idList[vectorIndex] == other.m_idList[otherVectorIndex] &&
+        m_sources[m_sourceIndexList[vectorIndex]] == other.m_sources[other.m_sourceIndexList[otherVectorIndex]];
+}
+
+// Gets the position of the source in the interned sources, adding it when it is new.
+uint32_t SignalIndexCache::GetSourceIndex(const string& source)
+{
+    // Consecutive keys almost always share their source, so check the last one before hashing
+    if (m_lastSourceIndex < m_sources.size() && m_sources[m_lastSourceIndex] == source)
+        return m_lastSourceIndex;
+
+    const auto result = m_sourceLookup.find(source);
+
+    if (result != m_sourceLookup.end())
+    {
+        m_lastSourceIndex = result->second;
+    }
+    else
+    {
+        m_lastSourceIndex = static_cast<uint32_t>(m_sources.size());
+        m_sources.push_back(source);
+        m_sourceLookup.emplace(source, m_lastSourceIndex);
+    }
+
+    return m_lastSourceIndex;
+}
+
+// Adds a measurement key to the cache, replacing the key of a runtime ID that is already mapped.
 void SignalIndexCache::AddMeasurementKey(const uint16_t signalIndex, const Guid& signalID, const string& source, const uint32_t id, const uint32_t charSizeEstimate)
 {
-    m_reference.insert_or_assign(signalIndex, m_signalIDList.size());
-    m_signalIDList.push_back(signalID);
-    m_sourceList.push_back(source);
-    m_idList.push_back(id);
+    if (m_reference.empty())
+        m_reference.resize(MaxSignalIndexCount, static_cast<uint32_t>(NotMapped)); // Copy avoids binding a reference to the class constant
+
+    const uint32_t sourceIndex = GetSourceIndex(source);
+    const uint32_t vectorIndex = m_reference[signalIndex];
+
+    if (vectorIndex == NotMapped)
+    {
+        m_reference[signalIndex] = static_cast<uint32_t>(m_signalIDList.size());
+        m_referenceCount++;
+
+        m_signalIndexList.push_back(signalIndex);
+        m_signalIDList.push_back(signalID);
+        m_sourceIndexList.push_back(sourceIndex);
+        m_idList.push_back(id);
+    }
+    else
+    {
+        // Replace the key in place so no stale entry is left behind in the lists
+        const auto result = m_signalIDCache.find(m_signalIDList[vectorIndex]);
+
+        if (result != m_signalIDCache.end() && result->second == signalIndex)
+            m_signalIDCache.erase(result);
+
+        m_binaryLength -= 26 + m_sources[m_sourceIndexList[vectorIndex]].size() * charSizeEstimate;
+
+        m_signalIDList[vectorIndex] = signalID;
+        m_sourceIndexList[vectorIndex] = sourceIndex;
+        m_idList[vectorIndex] = id;
+    }
+
     m_signalIDCache.insert_or_assign(signalID, signalIndex);
 
     // Char size here helps provide a rough-estimate on binary length used to reserve
@@ -52,84 +147,140 @@ void SignalIndexCache::AddMeasurementKey(const uint16_t signalIndex, const Guid&
     m_binaryLength += 26 + source.size() * charSizeEstimate;
 }
 
+// Removes the measurement key of the given runtime ID from the cache.
+bool SignalIndexCache::RemoveMeasurementKey(const uint16_t signalIndex, const uint32_t charSizeEstimate)
+{
+    const uint32_t vectorIndex = GetVectorIndex(signalIndex);
+
+    if (vectorIndex == NotMapped)
+        return false;
+
+    const auto result = m_signalIDCache.find(m_signalIDList[vectorIndex]);
+
+    if (result != m_signalIDCache.end() && result->second == signalIndex)
+        m_signalIDCache.erase(result);
+
+    m_binaryLength -= 26 + m_sources[m_sourceIndexList[vectorIndex]].size() * charSizeEstimate;
+
+    // Move the last key into the vacated position so the lists stay dense
+    const uint32_t lastIndex = static_cast<uint32_t>(m_signalIDList.size()) - 1;
+
+    if (vectorIndex != lastIndex)
+    {
+        m_signalIndexList[vectorIndex] = m_signalIndexList[lastIndex];
+        m_signalIDList[vectorIndex] = m_signalIDList[lastIndex];
+        m_sourceIndexList[vectorIndex] = m_sourceIndexList[lastIndex];
+        m_idList[vectorIndex] = m_idList[lastIndex];
+        m_reference[m_signalIndexList[vectorIndex]] = vectorIndex;
+    }
+
+    m_signalIndexList.pop_back();
+    m_signalIDList.pop_back();
+    m_sourceIndexList.pop_back();
+    m_idList.pop_back();
+
+    m_reference[signalIndex] = NotMapped;
+    m_referenceCount--;
+
+    return true;
+}
+
+// Reserves space for the given number of measurement keys.
+void SignalIndexCache::Reserve(const uint32_t count)
+{
+    m_signalIndexList.reserve(count);
+    m_signalIDList.reserve(count);
+    m_sourceIndexList.reserve(count);
+    m_idList.reserve(count);
+    m_signalIDCache.reserve(count);
+}
+
 // Empties the cache.
 void SignalIndexCache::Clear()
 {
     m_reference.clear();
+    m_referenceCount = 0;
+    m_signalIndexList.clear();
     m_signalIDList.clear();
-    m_sourceList.clear();
+    m_sourceIndexList.clear();
     m_idList.clear();
     m_signalIDCache.clear();
+    m_sources.clear();
+    m_sourceLookup.clear();
+    m_lastSourceIndex = 0;
+    m_binaryLength = 28;
 }
 
 // Determines whether an element with the given runtime ID exists in the signal index cache.
 bool SignalIndexCache::Contains(const uint16_t signalIndex) const
 {
-    return m_reference.find(signalIndex) != m_reference.end();
+    return GetVectorIndex(signalIndex) != NotMapped;
 }
 
 // Gets the globally unique signal ID associated with the given 16-bit runtime ID.
-Guid SignalIndexCache::GetSignalID(uint16_t signalIndex) const
+const Guid& SignalIndexCache::GetSignalID(const uint16_t signalIndex) const
 {
-    const auto result = m_reference.find(signalIndex);
+    const uint32_t vectorIndex = GetVectorIndex(signalIndex);
 
-    if (result != m_reference.end())
-    {
-        const uint32_t vectorIndex = result->second;
-        return m_signalIDList[vectorIndex];
-    }
+    if (vectorIndex == NotMapped)
+        return Empty::Guid;
 
-    return Empty::Guid;
+    return m_signalIDList[vectorIndex];
 }
 
 // Gets the first half of the human-readable measurement
 // key associated with the given 16-bit runtime ID.
 const string& SignalIndexCache::GetSource(const uint16_t signalIndex) const
 {
-    const auto result = m_reference.find(signalIndex);
+    const uint32_t vectorIndex = GetVectorIndex(signalIndex);
 
-    if (result != m_reference.end())
-    {
-        const uint32_t vectorIndex = result->second;
-        return m_sourceList[vectorIndex];
-    }
+    if (vectorIndex == NotMapped)
+        return Empty::String;
 
-    return Empty::String;
+    return m_sources[m_sourceIndexList[vectorIndex]];
 }
 
 // Gets the second half of the human-readable measurement
 // key associated with the given 16-bit runtime ID.
 uint32_t SignalIndexCache::GetID(const uint16_t signalIndex) const
 {
-    const auto result = m_reference.find(signalIndex);
+    const uint32_t vectorIndex = GetVectorIndex(signalIndex);
 
-    if (result != m_reference.end())
-    {
-        const uint32_t vectorIndex = result->second;
-        return m_idList[vectorIndex];
-    }
+    if (vectorIndex == NotMapped)
+        return UInt32::MaxValue;
 
-    return UInt32::MaxValue;
+    return m_idList[vectorIndex];
 }
 
 // Gets the globally unique signal ID as well as the human-readable
 // measurement key associated with the given 16-bit runtime ID.
 bool SignalIndexCache::GetMeasurementKey(const uint16_t signalIndex, Guid& signalID, string& source, uint32_t& id) const
 {
-    const auto result = m_reference.find(signalIndex);
+    const uint32_t vectorIndex = GetVectorIndex(signalIndex);
 
-    if (result != m_reference.end())
-    {
-        const uint32_t vectorIndex = result->second;
+    if (vectorIndex == NotMapped)
+        return false;
 
-        signalID = m_signalIDList[vectorIndex];
-        source = m_sourceList[vectorIndex];
-        id = m_idList[vectorIndex];
+    signalID = m_signalIDList[vectorIndex];
+    source = m_sources[m_sourceIndexList[vectorIndex]];
+    id = m_idList[vectorIndex];
 
-        return true;
-    }
+    return true;
+}
 
-    return false;
+// Gets references to the measurement key associated with the given 16-bit runtime ID.
+bool SignalIndexCache::TryGetMeasurementKey(const uint16_t signalIndex, const Guid*& signalID, const string*& source, uint32_t& id) const
+{
+    const uint32_t vectorIndex = GetVectorIndex(signalIndex);
+
+    if (vectorIndex == NotMapped)
+        return false;
+
+    signalID = &m_signalIDList[vectorIndex];
+    source = &m_sources[m_sourceIndexList[vectorIndex]];
+    id = m_idList[vectorIndex];
+
+    return true;
 }
 
 // Gets the 16-bit runtime ID associated with the given globally unique signal ID.
@@ -149,6 +300,23 @@ uint32_t SignalIndexCache::Count() const
     return m_signalIDCache.size();
 }
 
+// Determines whether the other cache maps exactly the same runtime IDs to the same measurement keys.
+bool SignalIndexCache::IsEquivalent(const SignalIndexCache& other) const
+{
+    if (m_signalIndexList.size() != other.m_signalIndexList.size())
+        return false;
+
+    for (uint32_t i = 0; i < m_signalIndexList.size(); i++)
+    {
+        const uint32_t otherIndex = other.GetVectorIndex(m_signalIndexList[i]);
+
+        if (otherIndex == NotMapped || !HasSameKey(i, other, otherIndex))
+            return false;
+    }
+
+    return true;
+}
+
 uint32_t SignalIndexCache::GetBinaryLength() const
 {
     return m_binaryLength;
@@ -159,56 +327,51 @@ void SignalIndexCache::RecalculateBinaryLength(const SubscriberConnectionPtr& co
     uint32_t binaryLength = 28;
 
     for (size_t i = 0; i < m_signalIDList.size(); i++)
-        binaryLength += 26 + connection->EncodeString(m_sourceList[i]).size();
+        binaryLength += 26 + connection->EncodeString(m_sources[m_sourceIndexList[i]]).size();
 
     m_binaryLength = binaryLength;
 }
 
-void SignalIndexCache::Parse(const vector<uint8_t>& buffer, Guid& subscriberID)
+// Parses the given number of serialized measurement keys and adds them to the cache.
+void SignalIndexCache::ParseMeasurementKeys(BinaryReader& reader, const uint32_t count)
 {
-    const uint8_t* data = buffer.data();
-    stringstream sourceStream;
+    // Every key takes at least 26 bytes, which bounds the space reserved for a malformed count
+    Reserve(static_cast<uint32_t>(m_signalIDList.size()) + min(count, reader.Remaining() / 26));
 
-    // Skip 4-byte length and parse subscriber ID
-    subscriberID = ParseGuid(data + 4);
-
-    const uint32_t* referenceCountPtr = reinterpret_cast<const uint32_t*>(data + 20);
-    const uint32_t referenceCount = EndianConverter::Default.ConvertBigEndian(*referenceCountPtr);
+    string source;
 
-    // Set up signalIndexPtr before entering the loop
-    const uint16_t* signalIndexPtr = reinterpret_cast<const uint16_t*>(referenceCountPtr + 1);
-
-    for (uint32_t i = 0; i < referenceCount; ++i)
+    for (uint32_t i = 0; i < count; ++i)
     {
-        // Begin setting up pointers
-        const uint8_t* signalIDPtr = reinterpret_cast<const uint8_t*>(signalIndexPtr + 1);
-        const uint32_t* sourceSizePtr = reinterpret_cast<const uint32_t*>(signalIDPtr + 16);
-
-        // Get the source size now so we can use it to find the ID
-        const uint32_t sourceSize = static_cast<uint32_t>(EndianConverter::Default.ConvertBigEndian(*sourceSizePtr)) / sizeof(char);
-
-        // Continue setting up pointers
-        const char* sourcePtr = reinterpret_cast<const char*>(sourceSizePtr + 1);
-        const uint32_t* idPtr = reinterpret_cast<const uint32_t*>(sourcePtr + sourceSize);
+        const uint16_t signalIndex = reader.ReadBigEndian<uint16_t>();
+        const Guid signalID = ParseGuid(reader.ReadBytes(16), true, true);
 
         // Build string from binary data -- NOTE: this presumes subscriber code is always UTF8
-        for (const char* sourceIter = sourcePtr; sourceIter < sourcePtr + sourceSize; ++sourceIter)
-            sourceStream << *sourceIter;
+        const uint32_t sourceSize = reader.ReadBigEndian<uint32_t>() / sizeof(char);
+        source.assign(reinterpret_cast<const char*>(reader.ReadBytes(sourceSize)), sourceSize);
 
-        // Set values for measurement key
-        const uint16_t signalIndex = EndianConverter::Default.ConvertBigEndian(*signalIndexPtr);
-        const Guid signalID = ParseGuid(signalIDPtr, true, true);
-        const string source = sourceStream.str();
-        const uint32_t id = EndianConverter::Default.ConvertBigEndian(*idPtr);
+        const uint32_t id = reader.ReadBigEndian<uint32_t>();
 
         // Add measurement key to the cache
         AddMeasurementKey(signalIndex, signalID, source, id);
-
-        // Advance signalIndexPtr to the next signal
-        // index and clear out the string stream
-        signalIndexPtr = reinterpret_cast<const uint16_t*>(idPtr + 1);
-        sourceStream.str("");
     }
+}
+
+void SignalIndexCache::Parse(const vector<uint8_t>& buffer, Guid& subscriberID)
+{
+    Parse(buffer.data(), 0, static_cast<uint32_t>(buffer.size()), subscriberID);
+}
+
+// Parses a serialized signal index cache from the given number of bytes starting at the offset in the data.
+void SignalIndexCache::Parse(const uint8_t* data, const uint32_t offset, const uint32_t length, Guid& subscriberID)
+{
+    BinaryReader reader(data, offset, length);
+
+    // Skip 4-byte length and parse subscriber ID
+    reader.Skip(4);
+    subscriberID = ParseGuid(reader.ReadBytes(16));
+
+    const uint32_t referenceCount = reader.ReadBigEndian<uint32_t>();
+    ParseMeasurementKeys(reader, referenceCount);
 
     // There is additional data about unauthorized signal
     // IDs that may need to be parsed in the future...
@@ -216,46 +379,146 @@ void SignalIndexCache::Parse(const vector<uint8_t>& buffer, Guid& subscriberID)
 
 void SignalIndexCache::Serialize(const SubscriberConnectionPtr& connection, vector<uint8_t>& buffer)
 {
-    const uint32_t binaryLengthLocation = buffer.size();
+    vector<vector<uint8_t>> sourceBytes(m_signalIDList.size());
     uint32_t binaryLength = 28;
 
-    // Reserve space for binary byte length of cache
-    WriteBytes(buffer, uint32_t(0));
+    // Encode sources first so the buffer can be sized exactly
+    for (size_t i = 0; i < m_signalIDList.size(); i++)
+    {
+        sourceBytes[i] = connection->EncodeString(m_sources[m_sourceIndexList[i]]);
+        binaryLength += 26 + static_cast<uint32_t>(sourceBytes[i].size());
+    }
+
+    const uint32_t offset = static_cast<uint32_t>(buffer.size());
+    buffer.resize(offset + binaryLength);
+
+    BinaryWriter writer(buffer, offset);
+
+    // Encode binary byte length of cache
+    writer.WriteBigEndian(binaryLength);
 
     // Encode subscriber ID
     Guid subscriberID = connection->GetSubscriberID();
     SwapGuidEndianness(subscriberID, true);
-    WriteBytes(buffer, subscriberID);
+    writer.WriteGuid(subscriberID);
 
     // Encode number of references
-    EndianConverter::WriteBigEndianBytes(buffer, int32_t(m_reference.size()));
+    writer.WriteBigEndian(int32_t(m_referenceCount));
 
     for (size_t i = 0; i < m_signalIDList.size(); i++)
+        WriteMeasurementKey(writer, m_signalIndexList[i], m_signalIDList[i], sourceBytes[i], m_idList[i]);
+
+    // For now, not reporting unauthorized IDs, may need to add in the future
+    writer.WriteBigEndian(uint32_t(0));
+
+    m_binaryLength = binaryLength;
+}
+
+// Serializes the changes needed to turn the previous cache into this one.
+bool SignalIndexCache::SerializeDelta(const SubscriberConnectionPtr& connection, const SignalIndexCache& previous, vector<uint8_t>& buffer) const
+{
+    vector<uint16_t> removedIndexes;
+    vector<uint16_t> removedRanges;
+    vector<uint32_t> changedKeys;
+
+    // Runtime IDs that are no longer mapped, coalesced into ranges since
+    // filter changes tend to drop runs of consecutively assigned IDs
+    for (const uint16_t signalIndex : previous.m_signalIndexList)
     {
-        Guid signalID = m_signalIDList[i];
+        if (GetVectorIndex(signalIndex) == NotMapped)
+            removedIndexes.push_back(signalIndex);
+    }
 
-        // Encode run-time signal index
-        EndianConverter::WriteBigEndianBytes(buffer, GetSignalIndex(signalID));
+    sort(removedIndexes.begin(), removedIndexes.end());
 
-        // Encode signal ID
-        SwapGuidEndianness(signalID, true);
-        WriteBytes(buffer, signalID);
+    for (size_t i = 0; i < removedIndexes.size(); i++)
+    {
+        if (i > 0 && removedIndexes[i] == removedRanges.back() + 1)
+        {
+            removedRanges.back() = removedIndexes[i];
+        }
+        else
+        {
+            removedRanges.push_back(removedIndexes[i]);
+            removedRanges.push_back(removedIndexes[i]);
+        }
+    }
 
-        // Encode source
-        vector<uint8_t> sourceBytes = connection->EncodeString(m_sourceList[i]);
-        EndianConverter::WriteBigEndianBytes(buffer, int32_t(sourceBytes.size()));
-        WriteBytes(buffer, sourceBytes);
+    // Keys of runtime IDs that are new or now map to a different key
+    for (uint32_t i = 0; i < m_signalIndexList.size(); i++)
+    {
+        const uint32_t previousIndex = previous.GetVectorIndex(m_signalIndexList[i]);
 
-        // Encode ID
-        EndianConverter::WriteBigEndianBytes(buffer, m_idList[i]);
+        if (previousIndex == NotMapped || !HasSameKey(i, previous, previousIndex))
+            changedKeys.push_back(i);
+    }
+
+    if (removedRanges.size() / 2 + changedKeys.size() > m_signalIndexList.size())
+        return false;
 
-        // Update binary length
-        binaryLength += 26 + sourceBytes.size();
+    vector<vector<uint8_t>> sourceBytes(changedKeys.size());
+    uint32_t binaryLength = 32 + static_cast<uint32_t>(removedRanges.size()) * 2;
+
+    for (size_t i = 0; i < changedKeys.size(); i++)
+    {
+        sourceBytes[i] = connection->EncodeString(m_sources[m_sourceIndexList[changedKeys[i]]]);
+        binaryLength += 26 + static_cast<uint32_t>(sourceBytes[i].size());
     }
 
-    // For now, not reporting unauthorized IDs, may need to add in the future
-    EndianConverter::WriteBigEndianBytes(buffer, uint32_t(0));
+    const uint32_t offset = static_cast<uint32_t>(buffer.size());
+    buffer.resize(offset + binaryLength);
+
+    BinaryWriter writer(buffer, offset);
+
+    // Encode binary byte length of delta
+    writer.WriteBigEndian(binaryLength);
+
+    // Encode subscriber ID
+    Guid subscriberID = connection->GetSubscriberID();
+    SwapGuidEndianness(subscriberID, true);
+    writer.WriteGuid(subscriberID);
+
+    // Encode removed runtime ID ranges as first and last ID of each range
+    writer.WriteBigEndian(uint32_t(removedRanges.size() / 2));
+
+    for (const uint16_t signalIndex : removedRanges)
+        writer.WriteBigEndian(signalIndex);
+
+    // Encode added or changed keys in the same form as the full cache
+    writer.WriteBigEndian(uint32_t(changedKeys.size()));
+
+    for (size_t i = 0; i < changedKeys.size(); i++)
+    {
+        const uint32_t vectorIndex = changedKeys[i];
+        WriteMeasurementKey(writer, m_signalIndexList[vectorIndex], m_signalIDList[vectorIndex], sourceBytes[i], m_idList[vectorIndex]);
+    }
+
+    // Same as the full cache, not reporting unauthorized IDs
+    writer.WriteBigEndian(uint32_t(0));
+
+    return true;
+}
+
+// Applies serialized changes from SerializeDelta to this cache.
+void SignalIndexCache::ApplyDelta(const uint8_t* data, const uint32_t offset, const uint32_t length, Guid& subscriberID)
+{
+    BinaryReader reader(data, offset, length);
+
+    // Skip 4-byte length and parse subscriber ID
+    reader.Skip(4);
+    subscriberID = ParseGuid(reader.ReadBytes(16));
+
+    const uint32_t removedRangeCount = reader.ReadBigEndian<uint32_t>();
+
+    for (uint32_t i = 0; i < removedRangeCount; i++)
+    {
+        const uint32_t firstIndex = reader.ReadBigEndian<uint16_t>();
+        const uint32_t lastIndex = reader.ReadBigEndian<uint16_t>();
+
+        for (uint32_t signalIndex = firstIndex; signalIndex <= lastIndex; signalIndex++)
+            RemoveMeasurementKey(static_cast<uint16_t>(signalIndex));
+    }
 
-    // Update binary byte length
-    *reinterpret_cast<uint32_t*>(&buffer[binaryLengthLocation]) = EndianConverter::Default.ConvertBigEndian(binaryLength);
+    const uint32_t changedKeyCount = reader.ReadBigEndian<uint32_t>();
+    ParseMeasurementKeys(reader, changedKeyCount);
 }
@@ -20,6 +20,10 @@
 //       Generated original version of source code.
 //  02/07/2019 - J. Ritchie Carroll
 //       Moved parse functionality into class, added generate functionality.
+//  10/15/2026 - GSF Development Team
+//       Runtime IDs now index a flat table, sources are interned and key lookups can return references.
+//       Added span parsing with reserved containers, key removal and signal index cache deltas.
+//       Added equivalence test used to share one cache between identical subscriptions.
 //
 //******************************************************************************************************
 
@@ -27,6 +31,7 @@
 #define __SIGNAL_INDEX_CACHE_H
 
 #include "../Common/CommonTypes.h"
+#include "../Common/BinaryCodec.h"
 
 namespace GSF {
 namespace TimeSeries {
@@ -41,19 +46,45 @@ namespace Transport
     class SignalIndexCache
     {
     private:
-        std::unordered_map<uint16_t, uint32_t> m_reference;
+        static const uint32_t MaxSignalIndexCount = 65536U;
+        static const uint32_t NotMapped = 0xFFFFFFFFU;
+
+        // Position in the signal lists of each runtime ID, runtime IDs are
+        // bounded to 16-bits so they are used to index the table directly
+        std::vector<uint32_t> m_reference;
+        uint32_t m_referenceCount;
+
+        // Runtime ID of each position in the signal lists
+        std::vector<uint16_t> m_signalIndexList;
         std::vector<GSF::Guid> m_signalIDList;
-        std::vector<std::string> m_sourceList;
+        std::vector<uint32_t> m_sourceIndexList;
         std::vector<uint32_t> m_idList;
         std::unordered_map<GSF::Guid, uint16_t> m_signalIDCache;
         uint32_t m_binaryLength;
 
+        // Distinct sources, since most signals share their source with many others
+        std::vector<std::string> m_sources;
+        std::unordered_map<std::string, uint32_t> m_sourceLookup;
+        uint32_t m_lastSourceIndex;
+
+        uint32_t GetVectorIndex(uint16_t signalIndex) const;
+        bool HasSameKey(uint32_t vectorIndex, const SignalIndexCache& other, uint32_t otherVectorIndex) const;
+        uint32_t GetSourceIndex(const std::string& source);
+        void ParseMeasurementKeys(BinaryReader& reader, uint32_t count);
+
     public:
         SignalIndexCache();
 
-        // Adds a measurement key to the cache.
+        // Adds a measurement key to the cache, replacing the key of a runtime ID that is already mapped.
         void AddMeasurementKey(uint16_t signalIndex, const GSF::Guid& signalID, const std::string& source, uint32_t id, uint32_t charSizeEstimate = 1U);
 
+        // Removes the measurement key of the given runtime ID from the cache. The char size
+        // estimate should match the one the key was added with.
+        bool RemoveMeasurementKey(uint16_t signalIndex, uint32_t charSizeEstimate = 1U);
+
+        // Reserves space for the given number of measurement keys.
+        void Reserve(uint32_t count);
+
         // Empties the cache.
         void Clear();
 
@@ -61,7 +92,7 @@ namespace Transport
         bool Contains(uint16_t signalIndex) const;
 
         // Gets the globally unique signal ID associated with the given 16-bit runtime ID.
-        GSF::Guid GetSignalID(uint16_t signalIndex) const;
+        const GSF::Guid& GetSignalID(uint16_t signalIndex) const;
 
         // Gets the first half of the human-readable measurement
         // key associated with the given 16-bit runtime ID.
@@ -75,12 +106,19 @@ namespace Transport
         // measurement key associated with the given 16-bit runtime ID.
         bool GetMeasurementKey(uint16_t signalIndex, GSF::Guid& signalID, std::string& source, uint32_t& id) const;
 
+        // Gets references to the signal ID and source, along with the ID, of the given 16-bit runtime ID
+        // without copying them. References remain valid until the cache is modified.
+        bool TryGetMeasurementKey(uint16_t signalIndex, const GSF::Guid*& signalID, const std::string*& source, uint32_t& id) const;
+
         // Gets the 16-bit runtime ID associated with the given globally unique signal ID.
         uint16_t GetSignalIndex(const GSF::Guid& signalID) const;
 
         // Gets the mapped signal count
         uint32_t Count() const;
 
+        // Determines whether the other cache maps exactly the same runtime IDs to the same measurement keys.
+        bool IsEquivalent(const SignalIndexCache& other) const;
+
         // Gets an estimated binary size of a serialized signal index cache useful for pre-allocating
         // a vector size, for an exact size call RecalculateBinaryLength first
         uint32_t GetBinaryLength() const;
@@ -89,7 +127,19 @@ namespace Transport
 
         void Parse(const std::vector<uint8_t>& buffer, Guid& subscriberID);
 
+        // Parses a serialized signal index cache from the given number of bytes starting at the offset in the data.
+        void Parse(const uint8_t* data, uint32_t offset, uint32_t length, Guid& subscriberID);
+
         void Serialize(const SubscriberConnectionPtr& connection, std::vector<uint8_t>& buffer);
+
+        // Serializes the changes needed to turn the previous cache into this one: ranges of runtime IDs that
+        // were removed followed by the keys that were added or changed. Returns false, leaving the buffer
+        // untouched, when there are more changes than keys in this cache so the full cache should be sent.
+        bool SerializeDelta(const SubscriberConnectionPtr& connection, const SignalIndexCache& previous, std::vector<uint8_t>& buffer) const;
+
+        // Applies serialized changes from SerializeDelta, found in the given number
+        // of bytes starting at the offset in the data, to this cache.
+        void ApplyDelta(const uint8_t* data, uint32_t offset, uint32_t length, Guid& subscriberID);
     };
 
     typedef SharedPtr<SignalIndexCache> SignalIndexCachePtr;
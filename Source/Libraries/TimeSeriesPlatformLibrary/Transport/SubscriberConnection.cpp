@@ -18,6 +18,19 @@
 //  ----------------------------------------------------------------------------------------------------
 //  02/07/2019 - J. Ritchie Carroll
 //       Generated original version of source code.
+//  10/15/2026 - GSF Development Team
+//       Command channel now reads in large chunks and extracts all complete payloads per read.
+//       Added TSSC compression of published measurements when negotiated by the subscriber.
+//       Added publishing of PublicationRecord values through per-connection handle to runtime ID maps.
+//       Responses are now written in place into pooled send buffers that are held until sent.
+//       Responses without data, e.g., NoOP, are now sent.
+//       Subscription changes are sent as signal index cache deltas when the subscriber accepts them.
+//       Added partitioned TSSC streams, negotiated by the subscriber, for parallel decoding.
+//       Added base time rotation so that compact measurements carry timestamps as base time offsets.
+//       Data packets can be serialized once and sent to every connection that shares their format.
+//       Added outbound send queue with gather writes, high-water marks and slow consumer policy.
+//       Added UDP data channel for data packets, batched into a single sendmmsg call on Linux.
+//       Added throttled subscriptions that are sent snapshots of the latest value of each signal.
 //
 //******************************************************************************************************
 
@@ -28,6 +41,8 @@
 #include "CompactMeasurement.h"
 #include "ActiveMeasurementsSchema.h"
 #include "../Common/EndianConverter.h"
+#include "../Common/BinaryCodec.h"
+#include "../Common/Convert.h"
 #include "../Data/DataSet.h"
 #include "../FilterExpressions/FilterExpressionParser.h"
 
@@ -41,6 +56,44 @@ using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
 static const uint32_t MaxPacketSize = 32768U;
+static const uint8_t TSSCVersion = 85;
+static const uint8_t PartitionedTSSCVersion = 86;
+static const uint32_t MaxTSSCPartitionCount = 16U;
+
+// Responses start with the payload marker and size followed by the response code, the in
+// response to command code and the size of the response data, which follows the header
+static const uint32_t ResponseHeaderLength = Common::PayloadHeaderSize + Common::ResponseHeaderSize;
+
+// Data packets start with the data packet flags and measurement count, TSSC
+// data packets follow these with the TSSC version and sequence number
+static const uint32_t DataPacketHeaderLength = 5U;
+static const uint32_t TSSCPacketHeaderLength = DataPacketHeaderLength + 3U;
+
+// Partitioned TSSC data packets follow the data packet header with the TSSC version and partition
+// count, then each partition is serialized as its sequence number, block length and block
+static const uint32_t PartitionedTSSCPacketHeaderLength = DataPacketHeaderLength + 2U;
+static const uint32_t TSSCPartitionHeaderLength = 6U;
+
+// Position within the send buffer at which serialized measurements start
+static const uint32_t DataPacketOffset = ResponseHeaderLength + DataPacketHeaderLength;
+static const uint32_t TSSCPacketOffset = ResponseHeaderLength + TSSCPacketHeaderLength;
+
+// Base times rotate before measurement timestamps outgrow the offsets from them, i.e.,
+// 2^32 ticks (about 7.2 minutes) for tick offsets or 2^16 milliseconds for millisecond offsets
+static const int64_t TickBaseTimeRotationInterval = 420LL * Ticks::PerSecond;
+static const int64_t MillisecondBaseTimeRotationInterval = 60LL * Ticks::PerSecond;
+
+// Largest send buffer capacity retained by the pool, e.g., after a metadata
+// refresh, before it is released rather than reused for small responses
+static const size_t MaxRetainedBufferCapacity = 1024 * 1024;
+
+// Most released send buffers kept by the pool for reuse, buffers released
+// beyond this after a burst of queued writes are freed
+static const size_t MaxRetainedSendBuffers = 256;
+
+// Most queued send buffers taken into a single gather write, which
+// matches the number of buffers Asio passes to each writev call
+static const size_t MaxBuffersPerWrite = 64;
 
 SubscriberConnection::SubscriberConnection(DataPublisherPtr parent, IOContext& commandChannelService, IOContext& dataChannelService) :
     m_parent(std::move(parent)),
@@ -54,17 +107,31 @@ SubscriberConnection::SubscriberConnection(DataPublisherPtr parent, IOContext& c
     m_useMillisecondResolution(false), // Defaults to microsecond resolution
     m_isNaNFiltered(false),
     m_isSubscribed(false),
+    m_throttled(false),
     m_startTimeSent(false),
     m_stopped(true),
     m_commandChannelSocket(m_commandChannelService),
-    m_readBuffer(Common::MaxPacketSize),
     m_udpPort(0),
-    m_dataChannelSocket(dataChannelService),
+    m_dataChannel(dataChannelService),
     m_totalCommandChannelBytesSent(0L),
     m_totalDataChannelBytesSent(0L),
     m_totalMeasurementsSent(0L),
+    m_totalDataPacketsDropped(0L),
     m_timeIndex(0),
-    m_baseTimeOffsets{0L, 0L}
+    m_baseTimeOffsets{0L, 0L},
+    m_baseTimeRotation(-1L),
+    m_tsscResetRequested(false),
+    m_tsscEncoders(1),
+    m_tsscSequenceNumbers(1, 0),
+    m_tsscPartitionCount(1),
+    m_lagTime(10.0),
+    m_processingInterval(-1),
+    m_throttledPublicationInterval(0L),
+    m_nextThrottledPublication(0L),
+    m_sendBufferPool(0, MaxRetainedSendBuffers),
+    m_sendQueueBytes(0L),
+    m_sendQueuePackets(0U),
+    m_writeInProgress(false)
 {
     // Setup ping timer
     m_pingTimer.SetInterval(5000);
@@ -75,6 +142,15 @@ SubscriberConnection::SubscriberConnection(DataPublisherPtr parent, IOContext& c
 
 SubscriberConnection::~SubscriberConnection() = default;
 
+SubscriberConnection::LatestMeasurement::LatestMeasurement() :
+    RuntimeID(0),
+    Timestamp(0L),
+    Flags(0U),
+    Value(0.0F),
+    Updated(false)
+{
+}
+
 const DataPublisherPtr& SubscriberConnection::GetParent() const
 {
     return m_parent;
@@ -119,6 +195,7 @@ void SubscriberConnection::SetOperationalModes(uint32_t value)
 {
     m_operationalModes = value;
     m_encoding = m_operationalModes & OperationalModes::EncodingMask;
+    UpdateDataPacketFormat();
 }
 
 uint32_t SubscriberConnection::GetEncoding() const
@@ -184,6 +261,12 @@ bool SubscriberConnection::GetIsSubscribed() const
 void SubscriberConnection::SetIsSubscribed(bool value)
 {
     m_isSubscribed = value;
+    UpdateDataPacketFormat();
+}
+
+bool SubscriberConnection::GetIsThrottled() const
+{
+    return m_throttled;
 }
 
 const string& SubscriberConnection::GetSubscriptionInfo() const
@@ -243,6 +326,26 @@ uint64_t SubscriberConnection::GetTotalMeasurementsSent() const
     return m_totalMeasurementsSent;
 }
 
+uint64_t SubscriberConnection::GetTotalDataPacketsDropped() const
+{
+    return m_totalDataPacketsDropped;
+}
+
+uint64_t SubscriberConnection::GetTotalCommandChannelReads() const
+{
+    return m_commandChannelFramer.GetTotalReads();
+}
+
+float64_t SubscriberConnection::GetCommandChannelPayloadsPerRead() const
+{
+    return m_commandChannelFramer.GetAveragePayloadsPerRead();
+}
+
+uint32_t SubscriberConnection::GetMaxCommandChannelPayloadsPerRead() const
+{
+    return m_commandChannelFramer.GetMaxPayloadsPerRead();
+}
+
 bool SubscriberConnection::CipherKeysDefined() const
 {
     return !m_keys[0].empty();
@@ -309,97 +412,299 @@ void SubscriberConnection::Start()
 
 void SubscriberConnection::Stop()
 {
-    m_stopped = true;
+    {
+        ScopeLock lock(m_sendQueueLock);
+        m_stopped = true;
+    }
+
+    // Release any publisher blocked on a full send queue
+    m_sendQueueDrained.notify_all();
+
     m_pingTimer.Stop();
-    m_commandChannelSocket.shutdown(socket_base::shutdown_both);
-    m_commandChannelSocket.cancel();
+    StopDataChannel();
+
+    // Socket may already be disconnected by the subscriber
+    ErrorCode error;
+    m_commandChannelSocket.shutdown(socket_base::shutdown_both, error);
+    m_commandChannelSocket.cancel(error);
     m_parent->RemoveConnection(shared_from_this());
 }
 
-void SubscriberConnection::PublishMeasurements(const vector<Measurement>& measurements)
+// Publishes the count measurement values given by index, along with the runtime ID each resolves to in
+// the signal index cache, UInt16::MaxValue when not subscribed, whatever the type of the measurements.
+template<class T>
+void SubscriberConnection::PublishMeasurementValues(const size_t count, const T& getValue, const vector<SubscriberConnectionPtr>& fanOutConnections)
 {
-    if (measurements.empty() || !m_isSubscribed)
+    if (count == 0 || !m_isSubscribed)
         return;
 
-    if (!m_startTimeSent)
-        m_startTimeSent = SendDataStartTime(measurements[0].Timestamp);
+    if (m_throttled)
+    {
+        CacheLatestMeasurementValues(count, getValue);
+        return;
+    }
+
+    const SignalIndexCachePtr signalIndexCache = m_signalIndexCache;
+
+    SendDataStartTimes(getValue(0, signalIndexCache).Timestamp, fanOutConnections);
 
     // TODO: Consider queuing measurements for processing
+    SerializeMeasurementValues(count, getValue, signalIndexCache, fanOutConnections);
+
+    // TSSC and base time locks are released before waiting for send queues to drain,
+    // TSSC packets are only sent to this connection
+    if (UseTSSCCompression())
+        WaitForSendQueues({});
+    else
+        WaitForSendQueues(fanOutConnections);
+}
+
+template<class T>
+void SubscriberConnection::SerializeMeasurementValues(const size_t count, const T& getValue, const SignalIndexCachePtr& signalIndexCache, const vector<SubscriberConnectionPtr>& fanOutConnections)
+{
+    if (UseTSSCCompression())
+    {
+        ScopeLock lock(m_tsscLock);
+        int32_t packetCount = 0;
+
+        StartTSSCBlock();
 
-    CompactMeasurement serializer(m_signalIndexCache, m_baseTimeOffsets, m_includeTime, m_useCompactMeasurementFormat);
-    vector<uint8_t> packet, buffer;
-    int32_t count = 0;
+        for (size_t i = 0; i < count; i++)
+        {
+            const MeasurementValue value = getValue(i, signalIndexCache);
 
-    packet.reserve(MaxPacketSize);
-    buffer.reserve(16);
+            if (value.RuntimeID != UInt16::MaxValue)
+                AddTSSCMeasurement(value.RuntimeID, value.Timestamp, value.Flags, value.Value, packetCount);
+        }
 
-    for (size_t i = 0; i < measurements.size(); i++)
+        if (packetCount > 0)
+            PublishTSSCDataPacket(packetCount);
+
+        return;
+    }
+
+    // Base times cannot rotate between serializing measurements against them and sending the packet
+    vector<UniqueLock> baseTimeLocks;
+    LockBaseTimes(fanOutConnections, baseTimeLocks);
+
+    CompactMeasurement serializer(signalIndexCache, m_baseTimeOffsets, m_includeTime, m_useMillisecondResolution, m_timeIndex);
+    SharedPtr<vector<uint8_t>> packet = AcquireSendBuffer(DataPacketHeaderLength + MaxPacketSize);
+    BinaryWriter writer(packet->data(), DataPacketOffset, MaxPacketSize);
+    int32_t packetCount = 0;
+
+    for (size_t i = 0; i < count; i++)
     {
-        const Measurement& measurement = measurements[i];
-        const uint16_t runtimeID = m_signalIndexCache->GetSignalIndex(measurement.SignalID);
+        const MeasurementValue value = getValue(i, signalIndexCache);
 
-        if (runtimeID == UInt16::MaxValue)
+        if (value.RuntimeID == UInt16::MaxValue)
             continue;
 
-        const uint32_t length = serializer.SerializeMeasurement(measurement, buffer, runtimeID);
-
-        if (packet.size() + length > MaxPacketSize)
+        if (writer.Remaining() < CompactMeasurement::MaximumBinaryLength)
         {
-            PublishDataPacket(packet, count);
-            packet.clear();
-            count = 0;
+            PublishDataPacket(packet, writer.Position(), packetCount, fanOutConnections);
+            packet = AcquireSendBuffer(DataPacketHeaderLength + MaxPacketSize);
+            writer = BinaryWriter(packet->data(), DataPacketOffset, MaxPacketSize);
+            packetCount = 0;
         }
 
-        WriteBytes(packet, buffer);
-        buffer.clear();
-        count++;
+        serializer.SerializeMeasurement(value.Timestamp, value.Value, value.Flags, writer, value.RuntimeID);
+        packetCount++;
+    }
+
+    if (packetCount > 0)
+        PublishDataPacket(packet, writer.Position(), packetCount, fanOutConnections);
+
+    FlushDataChannels(fanOutConnections);
+}
+
+template<class T>
+void SubscriberConnection::CacheLatestMeasurementValues(const size_t count, const T& getValue)
+{
+    // Runtime IDs are resolved under the lock so they cannot belong to a replaced signal index cache
+    ScopeLock lock(m_latestMeasurementsLock);
+    const SignalIndexCachePtr signalIndexCache = m_signalIndexCache;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        const MeasurementValue value = getValue(i, signalIndexCache);
+
+        if (value.RuntimeID != UInt16::MaxValue)
+            CacheLatestMeasurement(value.RuntimeID, value.Timestamp, value.Flags, value.Value);
     }
+}
+
+void SubscriberConnection::PublishMeasurements(const vector<Measurement>& measurements)
+{
+    PublishMeasurements(measurements, {});
+}
 
-    if (count > 0)
-        PublishDataPacket(packet, count);
+void SubscriberConnection::PublishMeasurements(const vector<Measurement>& measurements, const vector<SubscriberConnectionPtr>& fanOutConnections)
+{
+    PublishMeasurementValues(measurements.size(), [&measurements](const size_t index, const SignalIndexCachePtr& signalIndexCache)
+    {
+        const Measurement& measurement = measurements[index];
+        return MeasurementValue { signalIndexCache->GetSignalIndex(measurement.SignalID), measurement.Timestamp, measurement.Flags, static_cast<float32_t>(measurement.AdjustedValue()) };
+    },
+    fanOutConnections);
 }
 
 void SubscriberConnection::PublishMeasurements(const vector<MeasurementPtr>& measurements)
 {
-    if (measurements.empty() || !m_isSubscribed)
-        return;
+    PublishMeasurements(measurements, {});
+}
 
-    if (!m_startTimeSent)
-        m_startTimeSent = SendDataStartTime(measurements[0]->Timestamp);
+void SubscriberConnection::PublishMeasurements(const vector<MeasurementPtr>& measurements, const vector<SubscriberConnectionPtr>& fanOutConnections)
+{
+    PublishMeasurementValues(measurements.size(), [&measurements](const size_t index, const SignalIndexCachePtr& signalIndexCache)
+    {
+        const Measurement& measurement = *measurements[index];
+        return MeasurementValue { signalIndexCache->GetSignalIndex(measurement.SignalID), measurement.Timestamp, measurement.Flags, static_cast<float32_t>(measurement.AdjustedValue()) };
+    },
+    fanOutConnections);
+}
 
-    // TODO: Consider queuing measurements for processing
+void SubscriberConnection::PublishMeasurements(const vector<PublicationRecord>& records)
+{
+    PublishMeasurements(records, {});
+}
+
+void SubscriberConnection::PublishMeasurements(const vector<PublicationRecord>& records, const vector<SubscriberConnectionPtr>& fanOutConnections)
+{
+    // Runtime IDs of the handles are fetched again only when the signal index cache differs
+    SharedPtr<const PublicationRuntimeIDs> publicationRuntimeIDs;
+
+    PublishMeasurementValues(records.size(), [this, &records, &publicationRuntimeIDs](const size_t index, const SignalIndexCachePtr& signalIndexCache)
+    {
+        if (publicationRuntimeIDs == nullptr || publicationRuntimeIDs->SignalIndexCache != signalIndexCache)
+            publicationRuntimeIDs = GetPublicationRuntimeIDs(signalIndexCache);
 
-    CompactMeasurement serializer(m_signalIndexCache, m_baseTimeOffsets, m_includeTime, m_useCompactMeasurementFormat);
-    vector<uint8_t> packet, buffer;
-    int32_t count = 0;
+        const PublicationRecord& record = records[index];
+        const vector<uint16_t>& runtimeIDs = publicationRuntimeIDs->RuntimeIDs;
+        const uint16_t runtimeID = record.Handle < runtimeIDs.size() ? runtimeIDs[record.Handle] : UInt16::MaxValue;
 
-    packet.reserve(MaxPacketSize);
-    buffer.reserve(16);
+        return MeasurementValue { runtimeID, record.Timestamp, record.Flags, static_cast<float32_t>(record.Value) };
+    },
+    fanOutConnections);
+}
+
+// Publishes the latest values cached since the previous snapshot once the publication interval has elapsed.
+void SubscriberConnection::PublishLatestMeasurements(const int64_t now)
+{
+    if (!m_throttled || !m_isSubscribed)
+        return;
+
+    // Only the timer of the parent publishes snapshots, so the snapshot buffer is reused
+    vector<LatestMeasurement>& snapshot = m_latestMeasurementSnapshot;
+    SignalIndexCachePtr signalIndexCache;
 
-    for (size_t i = 0; i < measurements.size(); i++)
     {
-        const Measurement& measurement = *measurements[i];
-        const uint16_t runtimeID = m_signalIndexCache->GetSignalIndex(measurement.SignalID);
+        ScopeLock lock(m_latestMeasurementsLock);
 
-        if (runtimeID == UInt16::MaxValue)
-            continue;
+        // Runtime IDs of the snapshot belong to the signal index cache they were cached with
+        signalIndexCache = m_signalIndexCache;
+
+        if (now < m_nextThrottledPublication)
+            return;
+
+        // Snapshots keep to the interval unless publication fell a whole interval behind
+        m_nextThrottledPublication += m_throttledPublicationInterval;
+
+        if (m_nextThrottledPublication <= now)
+            m_nextThrottledPublication = now + m_throttledPublicationInterval;
+
+        snapshot.clear();
 
-        const uint32_t length = serializer.SerializeMeasurement(measurement, buffer, runtimeID);
+        // Signals of a dropped snapshot stay updated, so the next snapshot sends their latest values
+        if (m_updatedRuntimeIDs.empty() || DropThrottledPublication())
+            return;
 
-        if (packet.size() + length > MaxPacketSize)
+        for (const uint16_t runtimeID : m_updatedRuntimeIDs)
         {
-            PublishDataPacket(packet, count);
-            packet.clear();
-            count = 0;
+            LatestMeasurement& latest = m_latestMeasurements[runtimeID];
+            latest.Updated = false;
+            snapshot.push_back(latest);
         }
 
-        WriteBytes(packet, buffer);
-        buffer.clear();
-        count++;
+        m_updatedRuntimeIDs.clear();
     }
 
-    if (count > 0)
-        PublishDataPacket(packet, count);
+    SendDataStartTimes(snapshot[0].Timestamp, {});
+
+    SerializeMeasurementValues(snapshot.size(), [&snapshot](const size_t index, const SignalIndexCachePtr&)
+    {
+        const LatestMeasurement& latest = snapshot[index];
+        return MeasurementValue { latest.RuntimeID, latest.Timestamp, latest.Flags, latest.Value };
+    },
+    signalIndexCache, {});
+}
+
+// Processing interval takes precedence over lag time, zero publishes with every tick of the timer.
+void SubscriberConnection::UpdateThrottledPublicationInterval()
+{
+    const int64_t interval = m_processingInterval >= 0 ?
+        m_processingInterval * Ticks::PerMillisecond :
+        static_cast<int64_t>(m_lagTime * Ticks::PerSecond);
+
+    m_throttledPublicationInterval = max<int64_t>(interval, 0);
+}
+
+// Keeps the newest value of the signal until the next snapshot, the latest measurements lock must be held.
+void SubscriberConnection::CacheLatestMeasurement(const uint16_t runtimeID, const int64_t timestamp, const uint32_t flags, const float32_t value)
+{
+    if (runtimeID >= m_latestMeasurements.size())
+        m_latestMeasurements.resize(runtimeID + 1);
+
+    LatestMeasurement& latest = m_latestMeasurements[runtimeID];
+
+    if (latest.Updated)
+    {
+        if (timestamp < latest.Timestamp)
+            return;
+    }
+    else
+    {
+        latest.RuntimeID = runtimeID;
+        latest.Updated = true;
+        m_updatedRuntimeIDs.push_back(runtimeID);
+    }
+
+    latest.Timestamp = timestamp;
+    latest.Flags = flags;
+    latest.Value = value;
+}
+
+// Gets the runtime ID of each publication handle resolved against the signal index cache, resolving
+// all handles again when the signal index cache has changed and otherwise only new handles.
+SharedPtr<const SubscriberConnection::PublicationRuntimeIDs> SubscriberConnection::GetPublicationRuntimeIDs(const SignalIndexCachePtr& signalIndexCache)
+{
+    ScopeLock lock(m_publicationRuntimeIDsLock);
+    const SharedPtr<const PublicationRuntimeIDs> current = m_publicationRuntimeIDs;
+    const bool cacheChanged = current == nullptr || current->SignalIndexCache != signalIndexCache;
+
+    if (!cacheChanged && signalIndexCache == nullptr)
+        return current;
+
+    ScopeLock handlesLock(m_parent->m_publicationHandlesLock);
+    const vector<Guid>& signalIDs = m_parent->m_publicationSignalIDs;
+
+    if (!cacheChanged && current->RuntimeIDs.size() == signalIDs.size())
+        return current;
+
+    // Other threads may still be reading the current runtime IDs, so they are copied
+    const SharedPtr<PublicationRuntimeIDs> updated = cacheChanged ? NewSharedPtr<PublicationRuntimeIDs>() : NewSharedPtr<PublicationRuntimeIDs>(*current);
+    updated->SignalIndexCache = signalIndexCache;
+
+    if (signalIndexCache != nullptr)
+    {
+        updated->RuntimeIDs.reserve(signalIDs.size());
+
+        for (size_t handle = updated->RuntimeIDs.size(); handle < signalIDs.size(); handle++)
+            updated->RuntimeIDs.push_back(signalIndexCache->GetSignalIndex(signalIDs[handle]));
+    }
+
+    m_publicationRuntimeIDs = updated;
+
+    return updated;
 }
 
 void SubscriberConnection::HandleSubscribe(uint8_t* data, uint32_t length)
@@ -432,6 +737,9 @@ void SubscriberConnection::HandleSubscribe(uint8_t* data, uint32_t length)
                     const StringMap<string> settings = ParseKeyValuePairs(connectionString);
                     string setting;
 
+                    // Data packets are not shared while the subscription changes, the new format is set once subscribed
+                    boost::atomic_store(&m_dataPacketFormat, SharedPtr<const DataPacketFormat>());
+
                     if (TryGetValue(settings, "includeTime", setting))
                         SetIncludeTime(ParseBoolean(setting));
 
@@ -441,6 +749,27 @@ void SubscriberConnection::HandleSubscribe(uint8_t* data, uint32_t length)
                     if (TryGetValue(settings, "requestNaNValueFilter", setting))
                         SetIsNaNFiltered(ParseBoolean(setting));
 
+                    bool throttled = false;
+                    float64_t lagTime = m_lagTime;
+                    int32_t processingInterval = m_processingInterval;
+
+                    if (TryGetValue(settings, "trackLatestMeasurements", setting))
+                        throttled = ParseBoolean(setting);
+
+                    if (TryGetValue(settings, "lagTime", setting))
+                        lagTime = stod(setting);
+
+                    if (TryGetValue(settings, "processingInterval", setting))
+                        processingInterval = stoi(setting);
+
+                    uint32_t tsscPartitionCount = 1;
+
+                    if (TryGetValue(settings, "tsscPartitions", setting))
+                    {
+                        const int32_t requestedPartitionCount = stoi(setting);
+                        tsscPartitionCount = static_cast<uint32_t>(max(1, min(requestedPartitionCount, static_cast<int32_t>(MaxTSSCPartitionCount))));
+                    }
+
                     SetUsePayloadCompression(usePayloadCompression);
                     SetUseCompactMeasurementFormat(useCompactMeasurementFormat);
 
@@ -460,60 +789,94 @@ void SubscriberConnection::HandleSubscribe(uint8_t* data, uint32_t length)
                         m_parent->DispatchStatusMessage("Reported client subscription info: " + GetSubscriptionInfo());
                     }
 
-                    // TODO: Set up UDP data channel if client has requested this
+                    // Set up UDP data channel if client has requested this, multicast
+                    // takes precedence when the publisher has multicast enabled
+                    uint16_t dataChannelPort = 0;
+                    bool useMulticast = false;
+
                     if (TryGetValue(settings, "dataChannel", setting))
                     {
-                        /*
-                        Socket clientSocket = connection.GetCommandChannelSocket();
-                        Dictionary<string, string> settings = setting.ParseKeyValuePairs();
-                        IPEndPoint localEndPoint = null;
-                        string networkInterface = "::0";
-
-                        // Make sure return interface matches incoming client connection
-                        if ((object)clientSocket != null)
-                        localEndPoint = clientSocket.LocalEndPoint as IPEndPoint;
-
-                        if ((object)localEndPoint != null)
-                        {
-                        networkInterface = localEndPoint.Address.ToString();
-
-                        // Remove dual-stack prefix
-                        if (networkInterface.StartsWith("::ffff:", true, CultureInfo.InvariantCulture))
-                        networkInterface = networkInterface.Substring(7);
-                        }
-
-                        if (settings.TryGetValue("port", out setting) || settings.TryGetValue("localport", out setting))
-                        {
-                        if ((compressionModes & CompressionModes.TSSC) > 0)
-                        {
+                        const StringMap<string> dataChannelSettings = ParseKeyValuePairs(setting);
+
+                        if (TryGetValue(dataChannelSettings, "port", setting) || TryGetValue(dataChannelSettings, "localport", setting))
+                            dataChannelPort = static_cast<uint16_t>(stoi(setting));
+
+                        if (TryGetValue(dataChannelSettings, "multicast", setting))
+                            useMulticast = ParseBoolean(setting) && m_parent->GetMulticastAddress().is_multicast();
+                    }
+
+                    if ((dataChannelPort > 0 || useMulticast) && UseTSSCCompression())
+                    {
                         // TSSC is a stateful compression algorithm which will not reliably support UDP
-                        OnStatusMessage(MessageLevel.Warning, "Cannot use TSSC compression mode with UDP - special compression mode disabled");
-
-                        // Disable TSSC compression processing
-                        compressionModes &= ~CompressionModes.TSSC;
-                        connection.OperationalModes &= ~OperationalModes.CompressionModeMask;
-                        connection.OperationalModes |= (OperationalModes)compressionModes;
-                        }
-
-                        connection.DataChannel = new UdpServer($"Port=-1; Clients={connection.IPAddress}:{int.Parse(setting)}; interface={networkInterface}");
-                        connection.DataChannel.Start();
-                        }
-                        */
+                        m_parent->DispatchStatusMessage("Cannot use TSSC compression mode with UDP - special compression mode disabled");
+                        m_operationalModes &= ~CompressionModes::TSSC;
                     }
 
+                    StartDataChannel(dataChannelPort);
+
                     int32_t signalCount = 0;
 
                     if (signalIndexCache != nullptr)
                     {
                         signalCount = signalIndexCache->Count();
 
-                        // Send updated signal index cache to client with validated rights of the selected input measurement keys                        
-                        SendResponse(ServerResponse::UpdateSignalIndexCache, ServerCommand::Subscribe, SerializeSignalIndexCache(signalIndexCache));
+                        // Send updated signal index cache to client with validated rights of the selected input measurement keys,
+                        // only the changes to the cache the client already has are sent when it accepts signal index cache deltas
+                        bool delta;
+                        const vector<uint8_t> serializedCache = SerializeSignalIndexCache(signalIndexCache, m_signalIndexCache, delta);
+                        SendResponse(delta ? ServerResponse::UpdateSignalIndexCacheDelta : ServerResponse::UpdateSignalIndexCache, ServerCommand::Subscribe, serializedCache);
                     }
 
-                    SetSignalIndexCache(signalIndexCache);
+                    // Caches of identical subscriptions are shared so that their data packets can be shared too
+                    signalIndexCache = m_parent->ShareSignalIndexCache(signalIndexCache);
 
-                    const string message = "Client subscribed as " + string(useCompactMeasurementFormat ? "" : "non-") + "compact unsynchronized with " + ToString(signalCount) + " signals.";
+                    // Throttled subscriptions start over with an empty cache of latest values, which
+                    // also keeps them out of shared data packets and multicast groups. The signal index
+                    // cache is replaced along with the latest values so that no value is cached by the
+                    // runtime ID of the previous cache after the reset.
+                    {
+                        ScopeLock lock(m_latestMeasurementsLock);
+
+                        SetSignalIndexCache(signalIndexCache);
+                        m_throttled = throttled;
+                        m_lagTime = lagTime;
+                        m_processingInterval = processingInterval;
+                        m_latestMeasurements.clear();
+                        m_updatedRuntimeIDs.clear();
+                        UpdateThrottledPublicationInterval();
+                        m_nextThrottledPublication = ToTicks(UtcNow()) + m_throttledPublicationInterval;
+                    }
+
+                    if (throttled)
+                        m_parent->StartThrottledPublication();
+
+                    // Identical subscriptions share a multicast channel as well
+                    const MulticastChannelPtr multicastChannel = useMulticast && !throttled ? m_parent->AcquireMulticastChannel(*this) : nullptr;
+                    SetMulticastChannel(multicastChannel);
+
+                    // Subscriber resets its TSSC decoders on (re)subscription, so the
+                    // encoders restart with sequence number zero to match
+                    {
+                        ScopeLock lock(m_tsscLock);
+                        m_tsscPartitionCount = tsscPartitionCount;
+                        m_tsscResetRequested = true;
+                    }
+
+                    // Subscriber is sent base times again before the first measurements serialized against them
+                    ResetBaseTimes();
+
+                    string message = "Client subscribed as " + string(useCompactMeasurementFormat ? "" : "non-") + "compact unsynchronized with " + ToString(signalCount) + " signals.";
+
+                    if (throttled)
+                        message += " Throttled to the latest value of each signal every " + ToString(m_throttledPublicationInterval / Ticks::PerMillisecond) + " ms.";
+
+                    // Subscriber joins the multicast group it is sent ahead of the response
+                    if (multicastChannel != nullptr)
+                    {
+                        const UdpEndPoint& group = multicastChannel->Sender.GetDestination();
+                        message += " Data packets are published to multicast group " + group.address().to_string() + ":" + ToString(group.port()) + ".";
+                        SendMulticastGroup(group);
+                    }
 
                     SetIsSubscribed(true);
                     SendResponse(ServerResponse::Succeeded, ServerCommand::Subscribe, message);
@@ -624,6 +987,24 @@ void SubscriberConnection::HandleRotateCipherKeys()
 
 void SubscriberConnection::HandleUpdateProcessingInterval(uint8_t* data, uint32_t length)
 {
+    if (length < 4)
+        return;
+
+    const int32_t processingInterval = EndianConverter::ToBigEndian<int32_t>(data, 0);
+
+    {
+        ScopeLock lock(m_latestMeasurementsLock);
+
+        m_processingInterval = processingInterval;
+        UpdateThrottledPublicationInterval();
+
+        // Shorter interval takes effect without waiting out the current one
+        m_nextThrottledPublication = min(m_nextThrottledPublication, ToTicks(UtcNow()) + m_throttledPublicationInterval);
+    }
+
+    const string message = "New processing interval of " + ToString(processingInterval) + " assigned for client \"" + m_connectionID + "\".";
+    SendResponse(ServerResponse::Succeeded, ServerCommand::UpdateProcessingInterval, message);
+    m_parent->DispatchStatusMessage(message);
 }
 
 void SubscriberConnection::HandleDefineOperationalModes(uint8_t* data, uint32_t length)
@@ -722,37 +1103,289 @@ bool SubscriberConnection::ParseSubscriptionRequest(const std::string& filterExp
 
     // Create a new signal index cache for filtered measurements
     signalIndexCache = NewSharedPtr<SignalIndexCache>();
+    signalIndexCache->Reserve(static_cast<uint32_t>(rows.size()));
 
-    for (size_t i = 0; i < rows.size(); i++)
+    const auto addMeasurementKey = [&](const size_t rowIndex, const uint16_t signalIndex)
     {
-        const DataRowPtr& row = rows[i];
-        const Guid& signalID = row->ValueAsGuid(signalIDColumn).GetValueOrDefault();        
+        const DataRowPtr& row = rows[rowIndex];
+        const Guid signalID = row->ValueAsGuid(signalIDColumn).GetValueOrDefault();
         string source;
         uint32_t id;
 
         ParseMeasurementKey(row->ValueAsString(idColumn).GetValueOrDefault(), source, id);
-        signalIndexCache->AddMeasurementKey(uint16_t(i), signalID, source, id, charSizeEstimate);
+        signalIndexCache->AddMeasurementKey(signalIndex, signalID, source, id, charSizeEstimate);
+    };
+
+    const SignalIndexCachePtr previousCache = (m_operationalModes & OperationalModes::SignalIndexCacheDeltas) > 0 ? m_signalIndexCache : nullptr;
+
+    if (previousCache == nullptr)
+    {
+        for (size_t i = 0; i < rows.size(); i++)
+            addMeasurementKey(i, uint16_t(i));
+
+        return true;
+    }
+
+    // Signals that stay subscribed keep their runtime IDs so a signal index cache delta only
+    // needs to carry the signals that were added or removed, new signals take unused IDs
+    vector<bool> usedSignalIndexes(UInt16::MaxValue + 1);
+    vector<size_t> newRows;
+    uint32_t nextSignalIndex = 0;
+
+    for (size_t i = 0; i < rows.size(); i++)
+    {
+        const uint16_t signalIndex = previousCache->GetSignalIndex(rows[i]->ValueAsGuid(signalIDColumn).GetValueOrDefault());
+
+        if (signalIndex == UInt16::MaxValue || usedSignalIndexes[signalIndex])
+        {
+            newRows.push_back(i);
+            continue;
+        }
+
+        usedSignalIndexes[signalIndex] = true;
+        addMeasurementKey(i, signalIndex);
+    }
+
+    for (const size_t rowIndex : newRows)
+    {
+        while (nextSignalIndex < usedSignalIndexes.size() && usedSignalIndexes[nextSignalIndex])
+            nextSignalIndex++;
+
+        if (nextSignalIndex == usedSignalIndexes.size())
+            break;
+
+        usedSignalIndexes[nextSignalIndex] = true;
+        addMeasurementKey(rowIndex, uint16_t(nextSignalIndex));
     }
 
     return true;
 }
 
-void SubscriberConnection::PublishDataPacket(const vector<uint8_t>& packet, const int32_t count)
+// Gets a send buffer with room for a response header followed by the given length of response data.
+SharedPtr<vector<uint8_t>> SubscriberConnection::AcquireSendBuffer(const uint32_t dataLength)
 {
-    vector<uint8_t> buffer;
-    buffer.reserve(packet.size() + 5);
+    const uint32_t length = ResponseHeaderLength + dataLength;
+
+    // Responses are sent from multiple threads, buffers return to the pool once their write completes
+    const SharedPtr<vector<uint8_t>> sendBuffer = m_sendBufferPool.Acquire();
+
+    if (sendBuffer->capacity() > MaxRetainedBufferCapacity && length < MaxRetainedBufferCapacity)
+        vector<uint8_t>().swap(*sendBuffer);
+
+    if (sendBuffer->size() < length)
+        sendBuffer->resize(length);
+
+    return sendBuffer;
+}
+
+// Publishes a data packet whose measurements have been serialized in place after the data packet
+// header. Length is the position within the send buffer at which the serialized measurements end.
+void SubscriberConnection::PublishDataPacket(const SharedPtr<vector<uint8_t>>& packet, const uint32_t length, const int32_t count, const vector<SubscriberConnectionPtr>& fanOutConnections)
+{
+    BinaryWriter writer(*packet, ResponseHeaderLength);
 
     // Serialize data packet flags into response
-    buffer.push_back(DataPacketFlags::Compact);
+    writer.WriteByte(DataPacketFlags::Compact);
 
     // Serialize total number of measurement values to follow
-    EndianConverter::WriteBigEndianBytes(buffer, count);
-
-    // Serialize measurements to data buffer
-    WriteBytes(buffer, packet);
+    writer.WriteBigEndian(count);
 
     // Publish data packet to client
-    SendResponse(ServerResponse::DataPacket, ServerCommand::Subscribe, buffer);
+    if (SendResponse(ServerResponse::DataPacket, ServerCommand::Subscribe, packet, length - ResponseHeaderLength))
+        m_totalMeasurementsSent += count;
+
+    // Track last publication time
+    m_lastPublishTime = UtcNow();
+
+    // Response is complete once sent, so from here on the packet is only read. Connections sharing
+    // a data packet format share their multicast channel too, which is sent the packet only once.
+    MulticastChannelPtr multicastChannel = GetMulticastChannel();
+
+    for (const SubscriberConnectionPtr& connection : fanOutConnections)
+    {
+        const MulticastChannelPtr connectionMulticastChannel = connection->GetMulticastChannel();
+
+        if (connectionMulticastChannel != nullptr && connectionMulticastChannel == multicastChannel)
+        {
+            connection->m_totalMeasurementsSent += count;
+            connection->m_lastPublishTime = m_lastPublishTime;
+            continue;
+        }
+
+        connection->SendDataPacket(packet, length, count);
+
+        if (connectionMulticastChannel != nullptr)
+            multicastChannel = connectionMulticastChannel;
+    }
+}
+
+// Sends a complete data packet, serialized for another connection that shares the data packet format.
+void SubscriberConnection::SendDataPacket(const SharedPtr<vector<uint8_t>>& packet, const uint32_t length, const int32_t count)
+{
+    if (!DataChannelSendAsync(packet, Common::PayloadHeaderSize, length - Common::PayloadHeaderSize))
+    {
+        if (!CommandChannelSendAsync(packet, length, true))
+            return;
+
+        m_totalCommandChannelBytesSent += length;
+    }
+
+    m_totalMeasurementsSent += count;
+    m_lastPublishTime = UtcNow();
+}
+
+// Compact data packets only depend on the signal index cache, time options and base times; base times
+// follow a fixed schedule, so connections with the same time resolution use the same base times.
+bool SubscriberConnection::SharesDataPacketFormat(const SubscriberConnection& other) const
+{
+    const SharedPtr<const DataPacketFormat> format = boost::atomic_load(&m_dataPacketFormat);
+    const SharedPtr<const DataPacketFormat> otherFormat = boost::atomic_load(&other.m_dataPacketFormat);
+
+    return
+        format != nullptr && otherFormat != nullptr &&
+        format->SignalIndexCache == otherFormat->SignalIndexCache &&
+        format->IncludeTime == otherFormat->IncludeTime &&
+        format->UseMillisecondResolution == otherFormat->UseMillisecondResolution;
+}
+
+// Publishes the data packet format of the current subscription for other connections to compare.
+// Only subscribed, non-throttled connections that do not use TSSC compression share data packets.
+void SubscriberConnection::UpdateDataPacketFormat()
+{
+    SharedPtr<const DataPacketFormat> format;
+
+    if (m_isSubscribed && !UseTSSCCompression() && !m_throttled && m_signalIndexCache != nullptr)
+        format = NewSharedPtr<const DataPacketFormat>(DataPacketFormat { m_signalIndexCache, m_includeTime, m_useMillisecondResolution });
+
+    boost::atomic_store(&m_dataPacketFormat, format);
+}
+
+// TSSC is used only when the subscriber requested both payload compression and the TSSC compression mode.
+bool SubscriberConnection::UseTSSCCompression() const
+{
+    return m_usePayloadCompression && (m_operationalModes & CompressionModes::TSSC) > 0;
+}
+
+// Starts a new block of TSSC encoded measurements, resetting the encoders first when requested.
+void SubscriberConnection::StartTSSCBlock()
+{
+    if (m_tsscResetRequested)
+    {
+        m_tsscEncoders.resize(m_tsscPartitionCount);
+        m_tsscSequenceNumbers.assign(m_tsscPartitionCount, 0);
+
+        for (TSSCMeasurementEncoder& encoder : m_tsscEncoders)
+            encoder.Reset();
+
+        m_tsscResetRequested = false;
+    }
+
+    const uint32_t partitionCount = static_cast<uint32_t>(m_tsscEncoders.size());
+
+    // Measurements are encoded directly into the send buffer after the packet header
+    if (partitionCount == 1)
+    {
+        m_tsscPacket = AcquireSendBuffer(TSSCPacketHeaderLength + MaxPacketSize);
+        m_tsscEncoders[0].SetBuffer(m_tsscPacket->data(), TSSCPacketOffset, MaxPacketSize);
+        return;
+    }
+
+    // Each partition encodes into its own equal share of the packet, the
+    // blocks are packed together behind their headers once published
+    const uint32_t partitionLength = MaxPacketSize / partitionCount - TSSCPartitionHeaderLength;
+    uint32_t offset = ResponseHeaderLength + PartitionedTSSCPacketHeaderLength;
+
+    m_tsscPacket = AcquireSendBuffer(PartitionedTSSCPacketHeaderLength + MaxPacketSize);
+
+    for (TSSCMeasurementEncoder& encoder : m_tsscEncoders)
+    {
+        offset += TSSCPartitionHeaderLength;
+        encoder.SetBuffer(m_tsscPacket->data(), offset, partitionLength);
+        offset += partitionLength;
+    }
+}
+
+// Adds a measurement to the current TSSC block, publishing the block first when it is full.
+void SubscriberConnection::AddTSSCMeasurement(const uint16_t runtimeID, const int64_t timestamp, const uint32_t flags, const float32_t value, int32_t& count)
+{
+    TSSCMeasurementEncoder& encoder = m_tsscEncoders[runtimeID % m_tsscEncoders.size()];
+
+    if (!encoder.TryAddMeasurement(runtimeID, timestamp, flags, value))
+    {
+        PublishTSSCDataPacket(count);
+        count = 0;
+
+        StartTSSCBlock();
+        encoder.TryAddMeasurement(runtimeID, timestamp, flags, value);
+    }
+
+    count++;
+}
+
+void SubscriberConnection::PublishTSSCDataPacket(const int32_t count)
+{
+    BinaryWriter writer(*m_tsscPacket, ResponseHeaderLength);
+
+    // Serialize data packet flags into response
+    writer.WriteByte(DataPacketFlags::Compressed);
+
+    // Serialize total number of measurement values to follow
+    writer.WriteBigEndian(count);
+
+    if (m_tsscEncoders.size() == 1)
+    {
+        const uint32_t length = m_tsscEncoders[0].FinishBlock();
+
+        // Serialize TSSC version and sequence number, subscriber
+        // ignores packets until it receives sequence number zero
+        writer.WriteByte(TSSCVersion);
+        writer.WriteBigEndian(m_tsscSequenceNumbers[0]);
+        writer.Skip(length);
+
+        // Do not increment to 0 on roll-over
+        if (++m_tsscSequenceNumbers[0] == 0)
+            m_tsscSequenceNumbers[0] = 1;
+    }
+    else
+    {
+        const uint32_t partitionLength = MaxPacketSize / static_cast<uint32_t>(m_tsscEncoders.size()) - TSSCPartitionHeaderLength;
+        uint32_t blockOffset = ResponseHeaderLength + PartitionedTSSCPacketHeaderLength;
+
+        writer.WriteByte(PartitionedTSSCVersion);
+        writer.WriteByte(static_cast<uint8_t>(m_tsscEncoders.size()));
+
+        for (size_t i = 0; i < m_tsscEncoders.size(); i++)
+        {
+            const uint32_t length = m_tsscEncoders[i].FinishBlock();
+            uint16_t& sequenceNumber = m_tsscSequenceNumbers[i];
+
+            blockOffset += TSSCPartitionHeaderLength;
+
+            // Serialize partition sequence number and block length, partitions without
+            // measurements in this packet keep their sequence number for the next one
+            writer.WriteBigEndian(sequenceNumber);
+            writer.WriteBigEndian(length);
+
+            if (length > 0)
+            {
+                memmove(m_tsscPacket->data() + writer.Position(), m_tsscPacket->data() + blockOffset, length);
+                writer.Skip(length);
+
+                if (++sequenceNumber == 0)
+                    sequenceNumber = 1;
+            }
+
+            blockOffset += partitionLength;
+        }
+    }
+
+    // Publish data packet to client, releasing the send buffer once written. Encoder state
+    // already includes the measurements of a packet that was not sent, e.g., dropped by the
+    // slow consumer policy, so streams restart from sequence number zero with the next packet.
+    if (!SendResponse(ServerResponse::DataPacket, ServerCommand::Subscribe, m_tsscPacket, writer.Position() - ResponseHeaderLength))
+        m_tsscResetRequested = true;
+
+    m_tsscPacket.reset();
 
     // Track last publication time
     m_lastPublishTime = UtcNow();
@@ -760,63 +1393,104 @@ void SubscriberConnection::PublishDataPacket(const vector<uint8_t>& packet, cons
 
 bool SubscriberConnection::SendDataStartTime(uint64_t timestamp)
 {
-    vector<uint8_t> buffer;
-    EndianConverter::WriteBigEndianBytes(buffer, timestamp);
-    const bool result = SendResponse(ServerResponse::DataStartTime, ServerCommand::Subscribe, buffer);
+    const SharedPtr<vector<uint8_t>> sendBuffer = AcquireSendBuffer(8);
+    BinaryWriter writer(*sendBuffer, ResponseHeaderLength);
+
+    writer.WriteBigEndian(timestamp);
+
+    const bool result = SendResponse(ServerResponse::DataStartTime, ServerCommand::Subscribe, sendBuffer, 8);
 
     if (result)
         m_parent->DispatchStatusMessage("Start time sent to " + m_connectionID + ".");
 
     return result;
 }
-// All commands received from the client are handled by this thread.
-void SubscriberConnection::ReadCommandChannel()
+
+// Sends the data start time to this connection and any of the fan-out connections that have not been sent it yet.
+void SubscriberConnection::SendDataStartTimes(const int64_t timestamp, const vector<SubscriberConnectionPtr>& fanOutConnections)
 {
-    if (!m_stopped)
-        async_read(m_commandChannelSocket, buffer(m_readBuffer, Common::PayloadHeaderSize), bind(&SubscriberConnection::ReadPayloadHeader, this, _1, _2));
+    if (!m_startTimeSent)
+        m_startTimeSent = SendDataStartTime(timestamp);
+
+    for (const SubscriberConnectionPtr& connection : fanOutConnections)
+    {
+        if (!connection->m_startTimeSent)
+            connection->m_startTimeSent = connection->SendDataStartTime(timestamp);
+    }
 }
 
-void SubscriberConnection::ReadPayloadHeader(const ErrorCode& error, uint32_t bytesTransferred)
+// Clears the base times so that they are sent again before the next data packet.
+void SubscriberConnection::ResetBaseTimes()
 {
-    const uint32_t PacketSizeOffset = 4;
+    ScopeLock lock(m_baseTimeLock);
+    m_baseTimeRotation = -1L;
+    m_timeIndex = 0;
+    m_baseTimeOffsets[0] = 0L;
+    m_baseTimeOffsets[1] = 0L;
+}
 
-    if (m_stopped)
+// Brings the base times up to date with the rotation schedule, sending them to the subscriber when they change.
+// Rotation n starts at n rotation intervals since the tick epoch and uses that time as its base time, the other
+// base time is set to the start of the next rotation. Caller must hold the base time lock.
+void SubscriberConnection::UpdateBaseTimes(const int64_t realTime)
+{
+    if (!m_includeTime)
         return;
 
-    // Stop cleanly, i.e., don't report, on these errors
-    if (error == error::connection_aborted || error == error::connection_reset || error == error::eof)
-    {
-        Stop();
+    const int64_t interval = m_useMillisecondResolution ? MillisecondBaseTimeRotationInterval : TickBaseTimeRotationInterval;
+    const int64_t rotation = realTime / interval;
+
+    if (rotation == m_baseTimeRotation)
         return;
-    }
 
-    if (error)
-    {
-        stringstream messageStream;
+    m_baseTimeRotation = rotation;
+    m_timeIndex = static_cast<int32_t>(rotation & 1);
+    m_baseTimeOffsets[m_timeIndex] = rotation * interval;
+    m_baseTimeOffsets[m_timeIndex ^ 1] = (rotation + 1) * interval;
 
-        messageStream << "Error reading data from client \"";
-        messageStream << m_connectionID;
-        messageStream << "\" command channel: ";
-        messageStream << SystemError(error).what();
+    const SharedPtr<vector<uint8_t>> sendBuffer = AcquireSendBuffer(20);
+    BinaryWriter writer(*sendBuffer, ResponseHeaderLength);
 
-        m_parent->DispatchErrorMessage(messageStream.str());
+    writer.WriteBigEndian(m_timeIndex);
+    writer.WriteBigEndian(m_baseTimeOffsets[0]);
+    writer.WriteBigEndian(m_baseTimeOffsets[1]);
 
-        Stop();
-        return;
-    }
+    SendResponse(ServerResponse::UpdateBaseTimes, ServerCommand::Subscribe, sendBuffer, 20);
+}
+
+// Locks the base times of this connection and the fan-out connections and brings them up to date. Locks
+// are taken in address order so that publications to overlapping sets of connections cannot deadlock.
+void SubscriberConnection::LockBaseTimes(const vector<SubscriberConnectionPtr>& fanOutConnections, vector<UniqueLock>& locks)
+{
+    vector<SubscriberConnection*> connections;
+    const int64_t realTime = ToTicks(UtcNow());
 
-    const uint32_t packetSize = EndianConverter::ToLittleEndian<uint32_t>(&m_readBuffer[0], PacketSizeOffset);
+    connections.reserve(fanOutConnections.size() + 1);
+    connections.push_back(this);
 
-    if (packetSize > static_cast<uint32_t>(m_readBuffer.size()))
-        m_readBuffer.resize(packetSize);
+    for (const SubscriberConnectionPtr& connection : fanOutConnections)
+        connections.push_back(connection.get());
 
-    // Read packet (payload body)
-    // This read method is guaranteed not to return until the
-    // requested size has been read or an error has occurred.
-    async_read(m_commandChannelSocket, buffer(m_readBuffer, packetSize), bind(&SubscriberConnection::ParseCommand, this, _1, _2));
+    sort(connections.begin(), connections.end());
+    locks.reserve(connections.size());
+
+    for (SubscriberConnection* connection : connections)
+    {
+        locks.emplace_back(connection->m_baseTimeLock);
+        connection->UpdateBaseTimes(realTime);
+    }
+}
+
+// All commands received from the client are handled by this thread.
+void SubscriberConnection::ReadCommandChannel()
+{
+    if (!m_stopped)
+        m_commandChannelSocket.async_read_some(m_commandChannelFramer.GetReadBuffer(), boost::bind(&SubscriberConnection::ReadPayloads, this, boost::asio::placeholders::error, boost::asio::placeholders::bytes_transferred));
 }
 
-void SubscriberConnection::ParseCommand(const ErrorCode& error, uint32_t bytesTransferred)
+// Callback for async read of the command channel. A single read
+// may complete any number of commands, including none at all.
+void SubscriberConnection::ReadPayloads(const ErrorCode& error, uint32_t bytesTransferred)
 {
     if (m_stopped)
         return;
@@ -843,40 +1517,60 @@ void SubscriberConnection::ParseCommand(const ErrorCode& error, uint32_t bytesTr
         return;
     }
 
+    m_commandChannelFramer.CommitRead(bytesTransferred);
+
+    uint8_t* payload;
+    uint32_t length;
+
+    while (m_commandChannelFramer.TryGetPayload(payload, length))
+    {
+        ParseCommand(payload, length);
+
+        if (m_stopped)
+            return;
+    }
+
+    // Read more data, any partial command is kept by the framer
+    ReadCommandChannel();
+}
+
+// Parses and handles a single command received from the client.
+void SubscriberConnection::ParseCommand(uint8_t* payload, uint32_t length)
+{
     try
     {
-        uint8_t* data = &m_readBuffer[0];
+        uint8_t* data = payload;
         const uint32_t command = data[0];
         data++;
 
         switch (command)
         {
             case ServerCommand::Subscribe:
-                HandleSubscribe(data, bytesTransferred);
+                HandleSubscribe(data, length);
                 break;
             case ServerCommand::Unsubscribe:
                 HandleUnsubscribe();
                 break;
             case ServerCommand::MetadataRefresh:
-                HandleMetadataRefresh(data, bytesTransferred);
+                HandleMetadataRefresh(data, length);
                 break;
             case ServerCommand::RotateCipherKeys:
                 HandleRotateCipherKeys();
                 break;
             case ServerCommand::UpdateProcessingInterval:
-                HandleUpdateProcessingInterval(data, bytesTransferred);
+                HandleUpdateProcessingInterval(data, length);
                 break;
             case ServerCommand::DefineOperationalModes:
-                HandleDefineOperationalModes(data, bytesTransferred);
+                HandleDefineOperationalModes(data, length);
                 break;
             case ServerCommand::ConfirmNotification:
-                HandleConfirmNotification(data, bytesTransferred);
+                HandleConfirmNotification(data, length);
                 break;
             case ServerCommand::ConfirmBufferBlock:
-                HandleConfirmBufferBlock(data, bytesTransferred);
+                HandleConfirmBufferBlock(data, length);
                 break;
             case ServerCommand::PublishCommandMeasurements:
-                HandlePublishCommandMeasurements(data, bytesTransferred);
+                HandlePublishCommandMeasurements(data, length);
                 break;
             case ServerCommand::UserCommand00:
             case ServerCommand::UserCommand01:
@@ -894,7 +1588,7 @@ void SubscriberConnection::ParseCommand(const ErrorCode& error, uint32_t bytesTr
             case ServerCommand::UserCommand13:
             case ServerCommand::UserCommand14:
             case ServerCommand::UserCommand15:
-                HandleUserCommand(command, data, bytesTransferred);
+                HandleUserCommand(command, data, length);
                 break;
             default:
             {
@@ -915,11 +1609,11 @@ void SubscriberConnection::ParseCommand(const ErrorCode& error, uint32_t bytesTr
     {
         m_parent->DispatchErrorMessage("Encountered an exception while processing received client data: " + string(ex.what()));
     }
-
-    ReadCommandChannel();
 }
 
-std::vector<uint8_t> SubscriberConnection::SerializeSignalIndexCache(const SignalIndexCachePtr& signalIndexCache)
+// Serializes the signal index cache, or only its changes from the previous cache when the subscriber accepts
+// signal index cache deltas and the delta is smaller. Delta is set to indicate which form was serialized.
+std::vector<uint8_t> SubscriberConnection::SerializeSignalIndexCache(const SignalIndexCachePtr& signalIndexCache, const SignalIndexCachePtr& previousCache, bool& delta)
 {
     vector<uint8_t> serializationBuffer;
 
@@ -931,8 +1625,11 @@ std::vector<uint8_t> SubscriberConnection::SerializeSignalIndexCache(const Signa
     if (!useCommonSerializationFormat)
         throw PublisherException("DataPublisher only supports common serialization format");
 
-    serializationBuffer.reserve(uint32_t(signalIndexCache->GetBinaryLength() * 0.02));
-    signalIndexCache->Serialize(shared_from_this(), serializationBuffer);
+    delta = (operationalModes & OperationalModes::SignalIndexCacheDeltas) > 0 && previousCache != nullptr &&
+        signalIndexCache->SerializeDelta(shared_from_this(), *previousCache, serializationBuffer);
+
+    if (!delta)
+        signalIndexCache->Serialize(shared_from_this(), serializationBuffer);
 
     if (compressSignalIndexCache && useGZipCompression)
     {
@@ -1017,16 +1714,292 @@ DataSetPtr SubscriberConnection::FilterClientMetadata(const StringMap<Expression
     return dataSet;
 }
 
+// Copies the data into a pooled send buffer, since the caller's data may not outlive the write.
+SharedPtr<vector<uint8_t>> SubscriberConnection::CopyToSendBuffer(const uint8_t* data, uint32_t offset, uint32_t length)
+{
+    const SharedPtr<vector<uint8_t>> sendBuffer = m_sendBufferPool.Acquire();
+
+    sendBuffer->assign(data + offset, data + offset + length);
+
+    return sendBuffer;
+}
+
 void SubscriberConnection::CommandChannelSendAsync(uint8_t* data, uint32_t offset, uint32_t length)
 {
-    if (!m_stopped)
-        async_write(m_commandChannelSocket, buffer(&data[offset], length), bind(&SubscriberConnection::WriteHandler, this, _1, _2));
+    CommandChannelSendAsync(CopyToSendBuffer(data, offset, length), length);
+}
+
+// Queues the start of the send buffer for sending, holding a reference to the buffer until it has been written.
+bool SubscriberConnection::CommandChannelSendAsync(const SharedPtr<vector<uint8_t>>& sendBuffer, uint32_t length, bool dataPacket)
+{
+    UniqueLock lock(m_sendQueueLock);
+
+    if (m_stopped)
+        return false;
+
+    // Responses to commands are always queued, only data packets are held to the high-water marks
+    if (dataPacket && SendQueueFull())
+    {
+        switch (m_parent->GetSlowConsumerPolicy())
+        {
+            case SlowConsumerPolicy::BlockPublisher:
+                // Packet is queued past the high-water mark, the publisher then waits for
+                // the queue to drain in WaitForSendQueues once it holds no other locks
+                break;
+            case SlowConsumerPolicy::Disconnect:
+            {
+                // Refuse any further sends right away, the socket itself
+                // is shut down from the command channel thread
+                m_stopped = true;
+                lock.unlock();
+                m_sendQueueDrained.notify_all();
+
+                m_parent->DispatchErrorMessage("Disconnecting client \"" + m_connectionID + "\": send queue exceeded its high-water mark.");
+
+                const SubscriberConnectionPtr self = shared_from_this();
+                post(m_commandChannelService, [self] { self->Stop(); });
+
+                return false;
+            }
+            default:
+                m_totalDataPacketsDropped++;
+                return false;
+        }
+    }
+
+    m_sendQueue.push_back({ sendBuffer, length });
+    m_sendQueueBytes += length;
+    m_sendQueuePackets++;
+
+    if (!m_writeInProgress)
+        WriteQueuedBuffers();
+
+    return true;
+}
+
+// Waits, under the BlockPublisher policy, until the send queues of this connection and the fan-out
+// connections are below the high-water marks. Publishing only waits once it has released the TSSC
+// and base time locks, since the command channel threads that drain the queues take them too.
+void SubscriberConnection::WaitForSendQueues(const vector<SubscriberConnectionPtr>& fanOutConnections)
+{
+    if (m_parent->GetSlowConsumerPolicy() != SlowConsumerPolicy::BlockPublisher)
+        return;
+
+    WaitForSendQueue();
+
+    for (const SubscriberConnectionPtr& connection : fanOutConnections)
+        connection->WaitForSendQueue();
+}
+
+// Waits until the send queue is below the high-water marks or the connection has stopped.
+void SubscriberConnection::WaitForSendQueue()
+{
+    UniqueLock lock(m_sendQueueLock);
+
+    while (SendQueueFull() && !m_stopped)
+        m_sendQueueDrained.wait(lock);
+}
+
+// Determines whether the data waiting to be sent has reached either high-water
+// mark of the parent, the send queue lock must be held.
+bool SubscriberConnection::SendQueueFull() const
+{
+    return m_sendQueueBytes >= m_parent->GetMaxSendQueueSize() || m_sendQueuePackets >= m_parent->GetMaxSendQueuePackets();
+}
+
+// Snapshots of throttled subscriptions are published from the shared timer of the parent, which cannot
+// wait on a single slow subscriber, so whatever the slow consumer policy a snapshot is dropped rather
+// than queued once the send queue has reached a high-water mark. Counts the drop, returns true if so.
+bool SubscriberConnection::DropThrottledPublication()
+{
+    ScopeLock lock(m_sendQueueLock);
+
+    if (!SendQueueFull())
+        return false;
+
+    m_totalDataPacketsDropped++;
+    return true;
+}
+
+// Starts a single gather write of the buffers in the send queue, the send queue lock must be held.
+void SubscriberConnection::WriteQueuedBuffers()
+{
+    m_writeEntries.clear();
+    m_writeBuffers.clear();
+
+    while (!m_sendQueue.empty() && m_writeEntries.size() < MaxBuffersPerWrite)
+    {
+        SendQueueEntry& entry = m_sendQueue.front();
+
+        m_writeBuffers.emplace_back(entry.Buffer->data(), entry.Length);
+        m_writeEntries.push_back(std::move(entry));
+        m_sendQueue.pop_front();
+    }
+
+    m_writeInProgress = true;
+
+    const SubscriberConnectionPtr self = shared_from_this();
+
+    async_write(m_commandChannelSocket, m_writeBuffers, [this, self](const ErrorCode& error, size_t bytesTransferred)
+    {
+        WriteQueuedBuffersHandler(error, static_cast<uint32_t>(bytesTransferred));
+    });
+}
+
+void SubscriberConnection::WriteQueuedBuffersHandler(const ErrorCode& error, uint32_t bytesTransferred)
+{
+    {
+        ScopeLock lock(m_sendQueueLock);
+
+        for (const SendQueueEntry& entry : m_writeEntries)
+            m_sendQueueBytes -= entry.Length;
+
+        m_sendQueuePackets -= static_cast<uint32_t>(m_writeEntries.size());
+
+        // Written buffers return to the pool
+        m_writeEntries.clear();
+        m_writeInProgress = false;
+
+        if (error || m_stopped)
+        {
+            m_sendQueue.clear();
+            m_sendQueueBytes = 0L;
+            m_sendQueuePackets = 0U;
+        }
+        else if (!m_sendQueue.empty())
+        {
+            // Everything queued while the last write was in flight goes out together
+            WriteQueuedBuffers();
+        }
+    }
+
+    m_sendQueueDrained.notify_all();
+    WriteHandler(error, bytesTransferred);
 }
 
+// Sends the data on the data channel right away, or on the command channel when there is no data channel.
 void SubscriberConnection::DataChannelSendAsync(uint8_t* data, uint32_t offset, uint32_t length)
 {
-    // TODO: Implement UDP send
-    CommandChannelSendAsync(data, offset, length);
+    const SharedPtr<vector<uint8_t>> sendBuffer = CopyToSendBuffer(data, offset, length);
+
+    if (DataChannelSendAsync(sendBuffer, 0, length))
+        FlushDataChannel();
+    else
+        CommandChannelSendAsync(sendBuffer, length);
+}
+
+// Adds the datagram to those sent by the next data channel flush, holding a reference to the send
+// buffer until then. Datagrams go to the multicast channel when one is assigned. Returns false,
+// without taking the datagram, when there is neither a multicast channel nor a data channel.
+bool SubscriberConnection::DataChannelSendAsync(const SharedPtr<vector<uint8_t>>& sendBuffer, uint32_t offset, uint32_t length)
+{
+    {
+        ScopeLock lock(m_dataChannelLock);
+
+        if (m_multicastChannel != nullptr)
+        {
+            ScopeLock multicastLock(m_multicastChannel->SenderLock);
+
+            if (!m_multicastChannel->Sender.Add(sendBuffer, offset, length))
+                return true;
+        }
+        else
+        {
+            if (m_udpPort == 0)
+                return false;
+
+            if (!m_dataChannel.Add(sendBuffer, offset, length))
+                return true;
+        }
+    }
+
+    FlushDataChannel();
+
+    return true;
+}
+
+// Sends the datagrams collected since the last flush.
+void SubscriberConnection::FlushDataChannel()
+{
+    ScopeLock lock(m_dataChannelLock);
+    string errorMessage;
+    bool flushed;
+
+    if (m_multicastChannel != nullptr)
+    {
+        // Multicast bytes are counted once, by the publisher, rather than for each connection
+        ScopeLock multicastLock(m_multicastChannel->SenderLock);
+        flushed = m_multicastChannel->Sender.Flush(errorMessage);
+    }
+    else
+    {
+        const uint64_t totalBytesSent = m_dataChannel.GetTotalBytesSent();
+        flushed = m_dataChannel.Flush(errorMessage);
+        m_totalDataChannelBytesSent += m_dataChannel.GetTotalBytesSent() - totalBytesSent;
+    }
+
+    if (!flushed)
+        m_parent->DispatchErrorMessage("Error sending data to client \"" + m_connectionID + "\" data channel: " + errorMessage);
+}
+
+// Sends the datagrams collected for this connection and its fan-out connections.
+void SubscriberConnection::FlushDataChannels(const vector<SubscriberConnectionPtr>& fanOutConnections)
+{
+    FlushDataChannel();
+
+    for (const SubscriberConnectionPtr& connection : fanOutConnections)
+        connection->FlushDataChannel();
+}
+
+// Opens the data channel to the given port of the subscriber, replacing any previous
+// data channel. Port zero leaves the data channel closed.
+void SubscriberConnection::StartDataChannel(const uint16_t port)
+{
+    StopDataChannel();
+
+    if (port == 0)
+        return;
+
+    ScopeLock lock(m_dataChannelLock);
+
+    try
+    {
+        // Send from the interface on which the subscriber connected
+        const TcpEndPoint localEndPoint = m_commandChannelSocket.local_endpoint();
+
+        m_dataChannel.Open(UdpEndPoint(m_ipAddress, port));
+        m_dataChannel.Socket().bind(UdpEndPoint(localEndPoint.address(), 0));
+        m_udpPort = port;
+    }
+    catch (const std::exception& ex)
+    {
+        m_dataChannel.Close();
+        m_parent->DispatchErrorMessage("Failed to open data channel to client \"" + m_connectionID + "\", data packets will be sent on the command channel: " + string(ex.what()));
+    }
+}
+
+void SubscriberConnection::StopDataChannel()
+{
+    ScopeLock lock(m_dataChannelLock);
+
+    m_udpPort = 0;
+    m_dataChannel.Close();
+    m_multicastChannel.reset();
+}
+
+MulticastChannelPtr SubscriberConnection::GetMulticastChannel()
+{
+    ScopeLock lock(m_dataChannelLock);
+    return m_multicastChannel;
+}
+
+void SubscriberConnection::SetMulticastChannel(const MulticastChannelPtr& multicastChannel)
+{
+    // Datagrams collected for the previous channel are sent before switching
+    FlushDataChannel();
+
+    ScopeLock lock(m_dataChannelLock);
+    m_multicastChannel = multicastChannel;
 }
 
 void SubscriberConnection::WriteHandler(const ErrorCode& error, uint32_t bytesTransferred)
@@ -1056,6 +2029,28 @@ void SubscriberConnection::WriteHandler(const ErrorCode& error, uint32_t bytesTr
     }
 }
 
+void SubscriberConnection::SendMulticastGroup(const UdpEndPoint& group)
+{
+    const IPAddress& address = group.address();
+    vector<uint8_t> data(2);
+    BinaryWriter writer(data);
+
+    writer.WriteBigEndian(group.port());
+
+    if (address.is_v4())
+    {
+        const auto bytes = address.to_v4().to_bytes();
+        data.insert(data.end(), bytes.begin(), bytes.end());
+    }
+    else
+    {
+        const auto bytes = address.to_v6().to_bytes();
+        data.insert(data.end(), bytes.begin(), bytes.end());
+    }
+
+    SendResponse(ServerResponse::UpdateMulticastGroup, ServerCommand::Subscribe, data);
+}
+
 bool SubscriberConnection::SendResponse(uint8_t responseCode, uint8_t commandCode, const string& message)
 {
     return SendResponse(responseCode, commandCode, EncodeString(message));
@@ -1063,101 +2058,87 @@ bool SubscriberConnection::SendResponse(uint8_t responseCode, uint8_t commandCod
 
 bool SubscriberConnection::SendResponse(uint8_t responseCode, uint8_t commandCode, const vector<uint8_t>& data)
 {
+    const uint32_t dataLength = static_cast<uint32_t>(data.size());
+    const SharedPtr<vector<uint8_t>> sendBuffer = AcquireSendBuffer(dataLength);
+    BinaryWriter writer(*sendBuffer, ResponseHeaderLength);
+
+    writer.WriteBytes(data);
+
+    return SendResponse(responseCode, commandCode, sendBuffer, dataLength);
+}
+
+bool SubscriberConnection::SendResponse(uint8_t responseCode, uint8_t commandCode, const SharedPtr<vector<uint8_t>>& sendBuffer, uint32_t dataLength)
+{
+    static const uint8_t PayloadMarker[] = { 0xAA, 0xBB, 0xCC, 0xDD };
+
     bool success = false;
 
     try
     {
         const bool dataPacketResponse = responseCode == ServerResponse::DataPacket;
         const bool useDataChannel = dataPacketResponse || responseCode == ServerResponse::BufferBlock;
-        const uint32_t packetSize = data.size() + 6;
-        vector<uint8_t> buffer {};
-
-        buffer.reserve(Common::PayloadHeaderSize + packetSize);
+        const uint32_t packetSize = dataLength + Common::ResponseHeaderSize;
+        BinaryWriter writer(*sendBuffer);
 
         // Add command payload alignment header (deprecated)
-        buffer.push_back(0xAA);
-        buffer.push_back(0xBB);
-        buffer.push_back(0xCC);
-        buffer.push_back(0xDD);
-
-        EndianConverter::WriteLittleEndianBytes(buffer, packetSize);
+        writer.WriteBytes(PayloadMarker, 4);
+        writer.WriteLittleEndian(packetSize);
 
         // Add response code
-        buffer.push_back(responseCode);
+        writer.WriteByte(responseCode);
 
         // Add original in response to command code
-        buffer.push_back(commandCode);
+        writer.WriteByte(commandCode);
 
-        if (data.empty())
-        {
-            // Add zero sized data buffer to response packet
-            WriteBytes(buffer, uint32_t(0));
-        }
-        else
+        if (dataPacketResponse && dataLength > 0 && CipherKeysDefined())
         {
-            if (dataPacketResponse && CipherKeysDefined())
-            {
-                // TODO: Implement UDP AES data packet encryption
-                //// Get a local copy of volatile keyIVs and cipher index since these can change at any time
-                //byte[][][] keyIVs = connection.KeyIVs;
-                //int cipherIndex = connection.CipherIndex;
+            // TODO: Implement UDP AES data packet encryption
+            //// Get a local copy of volatile keyIVs and cipher index since these can change at any time
+            //byte[][][] keyIVs = connection.KeyIVs;
+            //int cipherIndex = connection.CipherIndex;
 
-                //// Reserve space for size of data buffer to go into response packet
-                //workingBuffer.Write(ZeroLengthBytes, 0, 4);
+            //// Reserve space for size of data buffer to go into response packet
+            //workingBuffer.Write(ZeroLengthBytes, 0, 4);
 
-                //// Get data packet flags
-                //DataPacketFlags flags = (DataPacketFlags)data[0];
+            //// Get data packet flags
+            //DataPacketFlags flags = (DataPacketFlags)data[0];
 
-                //// Encode current cipher index into data packet flags
-                //if (cipherIndex > 0)
-                //    flags |= DataPacketFlags.CipherIndex;
+            //// Encode current cipher index into data packet flags
+            //if (cipherIndex > 0)
+            //    flags |= DataPacketFlags.CipherIndex;
 
-                //// Write data packet flags into response packet
-                //workingBuffer.WriteByte((byte)flags);
+            //// Write data packet flags into response packet
+            //workingBuffer.WriteByte((byte)flags);
 
-                //// Copy source data payload into a memory stream
-                //MemoryStream sourceData = new MemoryStream(data, 1, data.Length - 1);
+            //// Copy source data payload into a memory stream
+            //MemoryStream sourceData = new MemoryStream(data, 1, data.Length - 1);
 
-                //// Encrypt payload portion of data packet and copy into the response packet
-                //Common.SymmetricAlgorithm.Encrypt(sourceData, workingBuffer, keyIVs[cipherIndex][0], keyIVs[cipherIndex][1]);
+            //// Encrypt payload portion of data packet and copy into the response packet
+            //Common.SymmetricAlgorithm.Encrypt(sourceData, workingBuffer, keyIVs[cipherIndex][0], keyIVs[cipherIndex][1]);
 
-                //// Calculate length of encrypted data payload
-                //int payloadLength = (int)workingBuffer.Length - 6;
+            //// Calculate length of encrypted data payload
+            //int payloadLength = (int)workingBuffer.Length - 6;
 
-                //// Move the response packet position back to the packet size reservation
-                //workingBuffer.Seek(2, SeekOrigin.Begin);
+            //// Move the response packet position back to the packet size reservation
+            //workingBuffer.Seek(2, SeekOrigin.Begin);
 
-                //// Add the actual size of payload length to response packet
-                //workingBuffer.Write(BigEndian.GetBytes(payloadLength), 0, 4);
-            }
-            else
-            {
-                // Add size of data buffer to response packet
-                EndianConverter::WriteBigEndianBytes(buffer, static_cast<int32_t>(data.size()));
+            //// Add the actual size of payload length to response packet
+            //workingBuffer.Write(BigEndian.GetBytes(payloadLength), 0, 4);
+        }
 
-                // Write data buffer
-                WriteBytes(buffer, data);
-            }
+        // Add size of data buffer to response packet, the data
+        // itself has already been written after the header
+        writer.WriteBigEndian(static_cast<int32_t>(dataLength));
 
-            // TODO: Publish packet on UDP
-            //// Data packets and buffer blocks can be published on a UDP data channel, so check for this...
-            //if (useDataChannel)
-            //    publishChannel = m_clientPublicationChannels.GetOrAdd(clientID, id => (object)connection != null ? connection.PublishChannel : m_commandChannel);
-            //else
-            //    publishChannel = m_commandChannel;
-
-            //// Send response packet
-            //if ((object)publishChannel != null && publishChannel.CurrentState == ServerState.Running)
-            //{
-            //    if (publishChannel is UdpServer)
-            //        publishChannel.MulticastAsync(buffer, 0, buffer.size());
-            //    else
-            //        publishChannel.SendToAsync(connection, buffer, 0, buffer.size());
-
-            //}
-
-            CommandChannelSendAsync(buffer.data(), 0, buffer.size());
-            m_totalCommandChannelBytesSent += buffer.size();
+        // Data packets and buffer blocks are published on the UDP data channel when there is one,
+        // datagrams carry the response without the payload header since they need no framing
+        if (useDataChannel && DataChannelSendAsync(sendBuffer, Common::PayloadHeaderSize, Common::ResponseHeaderSize + dataLength))
+        {
+            success = true;
+        }
+        else if (CommandChannelSendAsync(sendBuffer, ResponseHeaderLength + dataLength, dataPacketResponse))
+        {
+            m_totalCommandChannelBytesSent += ResponseHeaderLength + dataLength;
             success = true;
         }
     }
@@ -18,6 +18,19 @@
 //  ----------------------------------------------------------------------------------------------------
 //  02/07/2019 - J. Ritchie Carroll
 //       Generated original version of source code.
+//  10/15/2026 - GSF Development Team
+//       Command channel now reads in large chunks and extracts all complete payloads per read.
+//       Added TSSC compression of published measurements when negotiated by the subscriber.
+//       Added publishing of PublicationRecord values through per-connection handle to runtime ID maps.
+//       Responses are now written in place into pooled send buffers that are held until sent.
+//       Subscription changes are sent as signal index cache deltas when the subscriber accepts them.
+//       Added partitioned TSSC streams, negotiated by the subscriber, for parallel decoding.
+//       Added base time rotation so that compact measurements carry timestamps as base time offsets.
+//       Data packets can be serialized once and sent to every connection that shares their format.
+//       Added outbound send queue with gather writes, high-water marks and slow consumer policy.
+//       Added UDP data channel for data packets, batched into a single sendmmsg call on Linux.
+//       Data packets can be published to a multicast group shared by identical subscriptions.
+//       Added throttled subscriptions that are sent snapshots of the latest value of each signal.
 //
 //******************************************************************************************************
 
@@ -26,9 +39,15 @@
 
 #include "../Common/CommonTypes.h"
 #include "../Common/Timer.h"
+#include "../Common/ObjectPool.h"
 #include "../Data/DataSet.h"
 #include "SignalIndexCache.h"
 #include "TransportTypes.h"
+#include "PayloadFramer.h"
+#include "TSSCMeasurementEncoder.h"
+#include "DatagramSender.h"
+#include <atomic>
+#include <deque>
 
 namespace GSF {
 namespace TimeSeries {
@@ -37,6 +56,9 @@ namespace Transport
     class DataPublisher;
     typedef GSF::SharedPtr<DataPublisher> DataPublisherPtr;
 
+    struct MulticastChannel;
+    typedef GSF::SharedPtr<MulticastChannel> MulticastChannelPtr;
+
     // Represents a subscriber connection to a data publisher
     class SubscriberConnection : public GSF::EnableSharedThisPtr<SubscriberConnection> // NOLINT
     {
@@ -55,18 +77,23 @@ namespace Transport
         bool m_useMillisecondResolution;
         bool m_isNaNFiltered;
         bool m_isSubscribed;
+        std::atomic<bool> m_throttled; // Read by publishing threads and the throttled publication timer
         bool m_startTimeSent;
         bool m_stopped;
 
         // Command channel
         GSF::TcpSocket m_commandChannelSocket;
-        std::vector<uint8_t> m_readBuffer;
+        PayloadFramer m_commandChannelFramer;
         GSF::IPAddress m_ipAddress;
         std::string m_hostName;
 
-        // Data channel
-        int16_t m_udpPort;
-        GSF::UdpSocket m_dataChannelSocket;        
+        // Data channel, open when the subscriber requested data packets over UDP. Datagrams
+        // are collected while measurements are published and sent together by the flush that
+        // follows. Multicast channel, when assigned, takes the place of the data channel.
+        uint16_t m_udpPort;
+        DatagramSender m_dataChannel;
+        GSF::Mutex m_dataChannelLock;
+        MulticastChannelPtr m_multicastChannel;
         std::vector<uint8_t> m_keys[2];
         std::vector<uint8_t> m_ivs[2];
 
@@ -74,15 +101,104 @@ namespace Transport
         uint64_t m_totalCommandChannelBytesSent;
         uint64_t m_totalDataChannelBytesSent;
         uint64_t m_totalMeasurementsSent;
+        uint64_t m_totalDataPacketsDropped;
 
         // Measurement parsing
         SignalIndexCachePtr m_signalIndexCache;
+
+        // Data packet format compared by other connections, which publish on other threads: it is
+        // replaced as a whole once a subscription is complete and is null when packets are not shared
+        struct DataPacketFormat
+        {
+            SignalIndexCachePtr SignalIndexCache;
+            bool IncludeTime;
+            bool UseMillisecondResolution;
+        };
+
+        SharedPtr<const DataPacketFormat> m_dataPacketFormat;
         int32_t m_timeIndex;
         int64_t m_baseTimeOffsets[2];
+        int64_t m_baseTimeRotation;
+        GSF::Mutex m_baseTimeLock;
         DateTime m_lastPublishTime;
-        //TSSCMeasurementParser m_tsscMeasurementParser;
-        //bool m_tsscResetRequested;
-        //uint16_t m_tsscSequenceNumber;
+        SharedPtr<std::vector<uint8_t>> m_tsscPacket;
+        bool m_tsscResetRequested;
+        GSF::Mutex m_tsscLock;
+
+        // Signals are split by runtime ID over the TSSC partitions, each
+        // of which is an independent stream with its own sequence number
+        std::vector<TSSCMeasurementEncoder> m_tsscEncoders;
+        std::vector<uint16_t> m_tsscSequenceNumbers;
+        uint32_t m_tsscPartitionCount;
+
+        // Runtime ID of each publication handle registered with the parent, UInt16::MaxValue
+        // when the signal is not subscribed, resolved against the given signal index cache
+        struct PublicationRuntimeIDs
+        {
+            SignalIndexCachePtr SignalIndexCache;
+            std::vector<uint16_t> RuntimeIDs;
+        };
+
+        // Threads publishing at the same time share the current runtime IDs, which are never
+        // modified once assigned: new handles or a new signal index cache replace them
+        SharedPtr<const PublicationRuntimeIDs> m_publicationRuntimeIDs;
+        GSF::Mutex m_publicationRuntimeIDsLock;
+
+        // Value of a measurement to publish along with the runtime ID of its signal
+        struct MeasurementValue
+        {
+            uint16_t RuntimeID;
+            int64_t Timestamp;
+            uint32_t Flags;
+            float32_t Value;
+        };
+
+        // Latest value of a signal of a throttled subscription
+        struct LatestMeasurement
+        {
+            uint16_t RuntimeID;
+            int64_t Timestamp;
+            uint32_t Flags;
+            float32_t Value;
+            bool Updated;
+
+            LatestMeasurement();
+        };
+
+        // Throttled subscriptions only cache published measurements by runtime ID, the shared timer of
+        // the parent then publishes the signals updated since the previous snapshot once per interval:
+        // the processing interval, in milliseconds, unless negative, otherwise the lag time, in seconds
+        float64_t m_lagTime;
+        int32_t m_processingInterval;
+        int64_t m_throttledPublicationInterval;
+        int64_t m_nextThrottledPublication;
+        std::vector<LatestMeasurement> m_latestMeasurements;
+        std::vector<uint16_t> m_updatedRuntimeIDs;
+        std::vector<LatestMeasurement> m_latestMeasurementSnapshot;
+        GSF::Mutex m_latestMeasurementsLock;
+
+        // Responses are written in place into pooled send buffers, each
+        // buffer is held by its pending write until the write completes
+        ObjectPool<std::vector<uint8_t>> m_sendBufferPool;
+
+        // Send buffer and the number of bytes at its start to send
+        struct SendQueueEntry
+        {
+            SharedPtr<std::vector<uint8_t>> Buffer;
+            uint32_t Length;
+        };
+
+        // Buffers wait in the send queue while a write is in flight, then everything
+        // queued is sent with the next write as a single gather write. Queued bytes
+        // and packets include those of the write in flight.
+        std::deque<SendQueueEntry> m_sendQueue;
+        std::vector<SendQueueEntry> m_writeEntries;
+        std::vector<boost::asio::const_buffer> m_writeBuffers;
+        uint64_t m_sendQueueBytes;
+        uint32_t m_sendQueuePackets;
+        bool m_writeInProgress;
+        GSF::Mutex m_sendQueueLock;
+        GSF::WaitHandle m_sendQueueDrained;
 
         // Server request handlers
         void HandleSubscribe(uint8_t* data, uint32_t length);
@@ -97,15 +213,52 @@ namespace Transport
         void HandleUserCommand(uint8_t command, uint8_t* data, uint32_t length);
 
         bool ParseSubscriptionRequest(const std::string& filterExpression, SignalIndexCachePtr& signalIndexCache);
-        void PublishDataPacket(const std::vector<uint8_t>& packet, int32_t count);
+        SharedPtr<std::vector<uint8_t>> AcquireSendBuffer(uint32_t dataLength);
+        SharedPtr<std::vector<uint8_t>> CopyToSendBuffer(const uint8_t* data, uint32_t offset, uint32_t length);
+        bool SendQueueFull() const;
+        bool DropThrottledPublication();
+        void WaitForSendQueues(const std::vector<SharedPtr<SubscriberConnection>>& fanOutConnections);
+        void WaitForSendQueue();
+        void WriteQueuedBuffers();
+        void WriteQueuedBuffersHandler(const ErrorCode& error, uint32_t bytesTransferred);
+        void StartDataChannel(uint16_t port);
+        void StopDataChannel();
+        bool DataChannelSendAsync(const SharedPtr<std::vector<uint8_t>>& sendBuffer, uint32_t offset, uint32_t length);
+        void FlushDataChannel();
+        void FlushDataChannels(const std::vector<SharedPtr<SubscriberConnection>>& fanOutConnections);
+        MulticastChannelPtr GetMulticastChannel();
+        void SetMulticastChannel(const MulticastChannelPtr& multicastChannel);
+        void PublishDataPacket(const SharedPtr<std::vector<uint8_t>>& packet, uint32_t length, int32_t count, const std::vector<SharedPtr<SubscriberConnection>>& fanOutConnections);
+        void SendDataPacket(const SharedPtr<std::vector<uint8_t>>& packet, uint32_t length, int32_t count);
+        bool UseTSSCCompression() const;
+        void StartTSSCBlock();
+        void AddTSSCMeasurement(uint16_t runtimeID, int64_t timestamp, uint32_t flags, float32_t value, int32_t& count);
+        SharedPtr<const PublicationRuntimeIDs> GetPublicationRuntimeIDs(const SignalIndexCachePtr& signalIndexCache);
+        void UpdateThrottledPublicationInterval();
+        void UpdateDataPacketFormat();
+        void CacheLatestMeasurement(uint16_t runtimeID, int64_t timestamp, uint32_t flags, float32_t value);
+        void PublishTSSCDataPacket(int32_t count);
         bool SendDataStartTime(uint64_t timestamp);
+        void SendDataStartTimes(int64_t timestamp, const std::vector<SharedPtr<SubscriberConnection>>& fanOutConnections);
+        void ResetBaseTimes();
+        void UpdateBaseTimes(int64_t realTime);
+        void LockBaseTimes(const std::vector<SharedPtr<SubscriberConnection>>& fanOutConnections, std::vector<UniqueLock>& locks);
         void ReadCommandChannel();
-        void ReadPayloadHeader(const ErrorCode& error, uint32_t bytesTransferred);
-        void ParseCommand(const ErrorCode& error, uint32_t bytesTransferred);
-        std::vector<uint8_t> SerializeSignalIndexCache(const SignalIndexCachePtr& signalIndexCache);
+        void ReadPayloads(const ErrorCode& error, uint32_t bytesTransferred);
+        void ParseCommand(uint8_t* payload, uint32_t length);
+        std::vector<uint8_t> SerializeSignalIndexCache(const SignalIndexCachePtr& signalIndexCache, const SignalIndexCachePtr& previousCache, bool& delta);
         std::vector<uint8_t> SerializeMetadata(const GSF::Data::DataSetPtr& metadata) const;
         GSF::Data::DataSetPtr FilterClientMetadata(const StringMap<GSF::FilterExpressions::ExpressionTreePtr>& filterExpressions) const;
 
+        template<class T>
+        void PublishMeasurementValues(size_t count, const T& getValue, const std::vector<SharedPtr<SubscriberConnection>>& fanOutConnections);
+
+        template<class T>
+        void SerializeMeasurementValues(size_t count, const T& getValue, const SignalIndexCachePtr& signalIndexCache, const std::vector<SharedPtr<SubscriberConnection>>& fanOutConnections);
+
+        template<class T>
+        void CacheLatestMeasurementValues(size_t count, const T& getValue);
+
         static void PingTimerElapsed(Timer* timer, void* userData);
     public:
         SubscriberConnection(DataPublisherPtr parent, GSF::IOContext& commandChannelService, GSF::IOContext& dataChannelService);
@@ -146,6 +299,10 @@ namespace Transport
         bool GetIsSubscribed() const;
         void SetIsSubscribed(bool value);
 
+        // Determines whether the subscriber requested throttled publication, i.e., snapshots of the
+        // latest value of each signal, with the trackLatestMeasurements connection string setting.
+        bool GetIsThrottled() const;
+
         const std::string& GetSubscriptionInfo() const;
         void SetSubscriptionInfo(const std::string& value);
 
@@ -156,6 +313,10 @@ namespace Transport
         uint64_t GetTotalCommandChannelBytesSent() const;
         uint64_t GetTotalDataChannelBytesSent() const;
         uint64_t GetTotalMeasurementsSent() const;
+        uint64_t GetTotalDataPacketsDropped() const;
+        uint64_t GetTotalCommandChannelReads() const;
+        float64_t GetCommandChannelPayloadsPerRead() const;
+        uint32_t GetMaxCommandChannelPayloadsPerRead() const;
 
         bool CipherKeysDefined() const;
         std::vector<uint8_t> Keys(int32_t cipherIndex);
@@ -166,14 +327,40 @@ namespace Transport
 
         void PublishMeasurements(const std::vector<Measurement>& measurements);
         void PublishMeasurements(const std::vector<MeasurementPtr>& measurements);
+        void PublishMeasurements(const std::vector<PublicationRecord>& records);
+
+        // Determines whether data packets for this connection are serialized exactly as they
+        // are for the other connection, so that the same packets can be sent to both.
+        bool SharesDataPacketFormat(const SubscriberConnection& other) const;
+
+        // Publishes to this connection and to the fan-out connections, which must share its data packet
+        // format: each data packet is serialized once and the same send buffer is sent to every connection.
+        void PublishMeasurements(const std::vector<Measurement>& measurements, const std::vector<SharedPtr<SubscriberConnection>>& fanOutConnections);
+        void PublishMeasurements(const std::vector<MeasurementPtr>& measurements, const std::vector<SharedPtr<SubscriberConnection>>& fanOutConnections);
+        void PublishMeasurements(const std::vector<PublicationRecord>& records, const std::vector<SharedPtr<SubscriberConnection>>& fanOutConnections);
+
+        // Publishes the latest value of each signal updated since the previous snapshot when the publication
+        // interval of a throttled subscription has elapsed at the given time, in ticks. Called by the parent.
+        // Snapshot is dropped, whatever the slow consumer policy, while the send queue is at a high-water mark.
+        void PublishLatestMeasurements(int64_t now);
 
         void CommandChannelSendAsync(uint8_t* data, uint32_t offset, uint32_t length);
+
+        // Queues the start of the send buffer for sending, holding a reference to the buffer until
+        // it has been written. Data packets are subject to the slow consumer policy of the parent
+        // once the send queue is full, returns false when the buffer was not queued.
+        bool CommandChannelSendAsync(const SharedPtr<std::vector<uint8_t>>& sendBuffer, uint32_t length, bool dataPacket = false);
         void DataChannelSendAsync(uint8_t* data, uint32_t offset, uint32_t length);
         void WriteHandler(const ErrorCode& error, uint32_t bytesTransferred);
 
+        void SendMulticastGroup(const GSF::UdpEndPoint& group);
         bool SendResponse(uint8_t responseCode, uint8_t commandCode, const std::string& message);
         bool SendResponse(uint8_t responseCode, uint8_t commandCode, const std::vector<uint8_t>& data = {});
 
+        // Sends a response whose data has already been written to the send buffer,
+        // following the space reserved for the response header
+        bool SendResponse(uint8_t responseCode, uint8_t commandCode, const SharedPtr<std::vector<uint8_t>>& sendBuffer, uint32_t dataLength);
+
         std::string DecodeString(const uint8_t* data, uint32_t offset, uint32_t length) const;
         std::vector<uint8_t> EncodeString(const std::string& value) const;
     };
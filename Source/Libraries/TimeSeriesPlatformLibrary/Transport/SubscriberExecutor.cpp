@@ -0,0 +1,129 @@
+//******************************************************************************************************
+//  SubscriberExecutor.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "SubscriberExecutor.h"
+
+using namespace std;
+using namespace boost::asio;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+// --- SubscriberExecutor ---
+
+SubscriberExecutor::SubscriberExecutor(uint32_t ioThreadCount, uint32_t callbackThreadCount) :
+    m_ioWork(make_work_guard(m_ioContext)),
+    m_callbackWork(make_work_guard(m_callbackContext)),
+    m_ioThreadCount(ioThreadCount),
+    m_callbackThreadCount(callbackThreadCount > 0 ? callbackThreadCount : 1)
+{
+    if (m_ioThreadCount == 0)
+        m_ioThreadCount = max(Thread::hardware_concurrency(), 1U);
+
+    // Work guards keep the contexts running while no subscriber has operations outstanding
+    for (uint32_t i = 0; i < m_ioThreadCount; i++)
+        m_threads.push_back(NewSharedPtr<Thread>([this] { m_ioContext.run(); }));
+
+    for (uint32_t i = 0; i < m_callbackThreadCount; i++)
+        m_threads.push_back(NewSharedPtr<Thread>([this] { m_callbackContext.run(); }));
+}
+
+SubscriberExecutor::~SubscriberExecutor()
+{
+    Stop();
+}
+
+// Gets the context used for subscriber socket operations.
+IOContext& SubscriberExecutor::GetIOContext()
+{
+    return m_ioContext;
+}
+
+// Gets the context used for subscriber callbacks.
+IOContext& SubscriberExecutor::GetCallbackContext()
+{
+    return m_callbackContext;
+}
+
+uint32_t SubscriberExecutor::GetIOThreadCount() const
+{
+    return m_ioThreadCount;
+}
+
+uint32_t SubscriberExecutor::GetCallbackThreadCount() const
+{
+    return m_callbackThreadCount;
+}
+
+// Stops the executor and joins all of its threads.
+void SubscriberExecutor::Stop()
+{
+    m_ioWork.reset();
+    m_callbackWork.reset();
+    m_ioContext.stop();
+    m_callbackContext.stop();
+
+    for (const SharedPtr<Thread>& thread : m_threads)
+        thread->join();
+
+    m_threads.clear();
+}
+
+// --- AsyncOperationTracker ---
+
+AsyncOperationTracker::AsyncOperationTracker() :
+    m_pendingOperations(0)
+{
+}
+
+// Counts a new operation.
+void AsyncOperationTracker::Begin()
+{
+    ScopeLock lock(m_mutex);
+    m_pendingOperations++;
+}
+
+// Marks an operation as complete.
+void AsyncOperationTracker::End()
+{
+    ScopeLock lock(m_mutex);
+
+    if (m_pendingOperations > 0 && --m_pendingOperations == 0)
+        m_waitHandle.notify_all();
+}
+
+// Waits for all outstanding operations to complete.
+void AsyncOperationTracker::WaitForCompletion()
+{
+    UniqueLock lock(m_mutex);
+
+    while (m_pendingOperations > 0)
+        m_waitHandle.wait(lock);
+}
+
+// Gets the number of outstanding operations.
+uint32_t AsyncOperationTracker::GetPendingOperations()
+{
+    ScopeLock lock(m_mutex);
+    return m_pendingOperations;
+}
@@ -0,0 +1,151 @@
+//******************************************************************************************************
+//  SubscriberExecutor.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __SUBSCRIBER_EXECUTOR_H
+#define __SUBSCRIBER_EXECUTOR_H
+
+#include "../Common/CommonTypes.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Fixed-size pools of threads that can be shared by many DataSubscriber instances.
+    //
+    // By default each subscriber runs its own command channel, data channel and callback
+    // threads. Subscribers created with an executor instead run their socket operations
+    // on the executor's I/O threads and their callbacks on its callback threads, so the
+    // number of threads no longer grows with the number of subscribers. Each subscriber
+    // uses its own strands on these pools, so its callbacks still run one at a time in
+    // the order they were dispatched.
+    //
+    // An executor must outlive the subscribers that use it, which is ensured by
+    // subscribers holding a reference to it.
+    class SubscriberExecutor // NOLINT
+    {
+    private:
+        typedef boost::asio::executor_work_guard<IOContext::executor_type> WorkGuard;
+
+        IOContext m_ioContext;
+        IOContext m_callbackContext;
+        WorkGuard m_ioWork;
+        WorkGuard m_callbackWork;
+        std::vector<SharedPtr<Thread>> m_threads;
+        uint32_t m_ioThreadCount;
+        uint32_t m_callbackThreadCount;
+
+    public:
+        // Creates a new executor with the given number of I/O and callback threads. An I/O thread
+        // count of zero uses one thread per processor.
+        SubscriberExecutor(uint32_t ioThreadCount = 0, uint32_t callbackThreadCount = 1);
+
+        // Stops the executor and joins all of its threads.
+        ~SubscriberExecutor();
+
+        // Gets the context used for subscriber socket operations.
+        IOContext& GetIOContext();
+
+        // Gets the context used for subscriber callbacks.
+        IOContext& GetCallbackContext();
+
+        // Gets the number of threads in each pool.
+        uint32_t GetIOThreadCount() const;
+        uint32_t GetCallbackThreadCount() const;
+
+        // Stops the executor and joins all of its threads. All subscribers
+        // using the executor should be disconnected before it is stopped.
+        void Stop();
+    };
+
+    typedef SharedPtr<SubscriberExecutor> SubscriberExecutorPtr;
+
+    // Counts asynchronous operations that a subscriber has outstanding on a shared
+    // executor so that it can wait for their completion before releasing resources.
+    class AsyncOperationTracker // NOLINT
+    {
+    private:
+        Mutex m_mutex;
+        WaitHandle m_waitHandle;
+        uint32_t m_pendingOperations;
+
+    public:
+        // Wraps a completion handler so that the operation is counted until the handler has run.
+        template<class Handler>
+        class TrackedHandler
+        {
+        private:
+            AsyncOperationTracker* m_tracker;
+            Handler m_handler;
+
+        public:
+            TrackedHandler(AsyncOperationTracker* tracker, Handler handler) :
+                m_tracker(tracker),
+                m_handler(std::move(handler))
+            {
+            }
+
+            template<class... Args>
+            void operator()(Args&&... args)
+            {
+                // Operation is complete even if the handler throws
+                struct Completion
+                {
+                    AsyncOperationTracker* Tracker;
+                    ~Completion() { Tracker->End(); }
+                }
+                completion { m_tracker };
+
+                m_handler(std::forward<Args>(args)...);
+            }
+        };
+
+        // Creates a new instance.
+        AsyncOperationTracker();
+
+        // Counts a new operation and wraps its completion handler.
+        template<class Handler>
+        TrackedHandler<Handler> Track(Handler handler);
+
+        // Counts a new operation.
+        void Begin();
+
+        // Marks an operation as complete.
+        void End();
+
+        // Waits for all outstanding operations to complete.
+        void WaitForCompletion();
+
+        // Gets the number of outstanding operations.
+        uint32_t GetPendingOperations();
+    };
+
+    // Counts a new operation and wraps its completion handler.
+    template<class Handler>
+    AsyncOperationTracker::TrackedHandler<Handler> AsyncOperationTracker::Track(Handler handler)
+    {
+        Begin();
+        return TrackedHandler<Handler>(this, std::move(handler));
+    }
+}}}
+
+#endif
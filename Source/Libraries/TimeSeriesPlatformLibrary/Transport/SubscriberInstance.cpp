@@ -18,11 +18,15 @@
 //  ----------------------------------------------------------------------------------------------------
 //  03/21/2018 - J. Ritchie Carroll
 //       Generated original version of source code.
+//  10/15/2026 - GSF Development Team
+//       Added constructor to run the subscriber on a shared SubscriberExecutor.
+//       Added optional metadata snapshot file so a restart can subscribe without waiting on metadata.
 //
 //******************************************************************************************************
 
 #include "SubscriberInstance.h"
 #include "Constants.h"
+#include "MetadataSnapshot.h"
 #include "../Common/Convert.h"
 #include "../Common/EndianConverter.h"
 #include "../Common/pugixml.hpp"
@@ -34,7 +38,17 @@ using namespace GSF;
 using namespace GSF::TimeSeries;
 using namespace GSF::TimeSeries::Transport;
 
+// Metadata filters that leave only what identifies the publisher metadata: the node ID of the first
+// device and the schema version. Used to validate a metadata snapshot without requesting all metadata.
+static const string MetadataVersionFilters = "FILTER TOP 1 DeviceDetail WHERE True; FILTER MeasurementDetail WHERE False; FILTER PhasorDetail WHERE False";
+
 SubscriberInstance::SubscriberInstance() :
+    SubscriberInstance(nullptr)
+{
+}
+
+SubscriberInstance::SubscriberInstance(const SubscriberExecutorPtr& executor) :
+    m_subscriber(executor),
     m_hostname("localhost"),
     m_port(6165),
     m_udpPort(0U),
@@ -43,6 +57,8 @@ SubscriberInstance::SubscriberInstance() :
     m_maxRetries(-1),
     m_retryInterval(2000),
     m_filterExpression(SubscribeAllNoStatsExpression),
+    m_subscribedFromSnapshot(false),
+    m_validatingMetadataSnapshot(false),
     m_startTime(""),
     m_stopTime(""),
     m_userData(nullptr)
@@ -138,6 +154,16 @@ void SubscriberInstance::SetMetadataFilters(const std::string& metadataFilters)
     m_metadataFilters = metadataFilters;
 }
 
+const std::string& SubscriberInstance::GetMetadataSnapshotPath() const
+{
+    return m_metadataSnapshotPath;
+}
+
+void SubscriberInstance::SetMetadataSnapshotPath(const std::string& metadataSnapshotPath)
+{
+    m_metadataSnapshotPath = metadataSnapshotPath;
+}
+
 void SubscriberInstance::ConnectAsync()
 {
     Thread(bind(&SubscriberInstance::Connect, this));
@@ -173,6 +199,14 @@ void SubscriberInstance::Connect()
         m_subscriptionInfo.DataChannelLocalPort = m_udpPort;
     }
 
+    // Metadata saved by a previous run can be used right away, the publisher is only asked
+    // for its metadata version to validate it and for full metadata when the version differs
+    const bool loadedMetadataSnapshot = m_autoParseMetadata && TryLoadMetadataSnapshot();
+
+    // Flags only apply to the metadata requested by this connection
+    m_subscribedFromSnapshot = false;
+    m_validatingMetadataSnapshot = false;
+
     // Connect and subscribe to publisher
     if (connector.Connect(m_subscriber, m_subscriptionInfo))
     {
@@ -180,11 +214,23 @@ void SubscriberInstance::Connect()
 
         // If automatically parsing metadata, request metadata upon successful connection,
         // after metadata is handled the SubscriberInstance will then initiate subscribe;
-        // otherwise, initiate subscribe immediately
-        if (m_autoParseMetadata)
+        // otherwise, initiate subscribe immediately. When metadata was loaded from a
+        // snapshot, subscribe immediately and validate the snapshot in the background.
+        if (m_autoParseMetadata && !loadedMetadataSnapshot)
+        {
             SendMetadataRefreshCommand();
+        }
         else
+        {
+            m_subscribedFromSnapshot = loadedMetadataSnapshot;
             m_subscriber.Subscribe();
+
+            if (loadedMetadataSnapshot)
+            {
+                m_validatingMetadataSnapshot = true;
+                SendMetadataRefreshCommand(MetadataVersionFilters);
+            }
+        }
     }
     else
     {
@@ -571,10 +617,55 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
     if (!m_autoParseMetadata)
         return;
 
+    MetadataSnapshot snapshot;
+
+    if (!ParseMetadata(payload, snapshot))
+        return;
+
+    // Metadata requested after loading a snapshot replaces the snapshot only when it differs
+    SharedPtr<MetadataSnapshot> loadedSnapshot;
+
+    {
+        ScopeLock lock(m_configurationUpdateLock);
+        loadedSnapshot.swap(m_metadataSnapshot);
+    }
+
+    if (loadedSnapshot != nullptr)
+    {
+        if (loadedSnapshot->NodeID != snapshot.NodeID)
+        {
+            ErrorMessage("Rejected metadata snapshot of publisher node " + ToString(loadedSnapshot->NodeID) + ", connected publisher is node " + ToString(snapshot.NodeID));
+        }
+        else if (loadedSnapshot->IsEquivalent(snapshot))
+        {
+            StatusMessage("Metadata snapshot version " + ToString(loadedSnapshot->VersionNumber) + " matches publisher metadata");
+            return;
+        }
+    }
+
+    // Save the parsed metadata so the next start can subscribe without waiting for it
+    if (!m_metadataSnapshotPath.empty())
+    {
+        try
+        {
+            snapshot.Save(m_metadataSnapshotPath);
+        }
+        catch (const exception& ex)
+        {
+            ErrorMessage("Failed to save metadata snapshot: " + string(ex.what()));
+        }
+    }
+
+    LoadMetadata(snapshot, "GEP meta data");
+}
+
+// Parses the metadata records of a metadata refresh response, returning false when the payload cannot be parsed.
+bool SubscriberInstance::ParseMetadata(const vector<uint8_t>& payload, MetadataSnapshot& snapshot)
+{
     if (payload.empty())
     {
         ErrorMessage("Received empty payload for meta data refresh.");
-        return;
+        return false;
     }
 
     vector<uint8_t>* uncompressesBuffer;
@@ -610,15 +701,13 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
         stringstream errorMessageStream;
         errorMessageStream << "Failed to parse meta data XML, status code = " << ToHex(result.status);
         ErrorMessage(errorMessageStream.str());
-        return;
+        return false;
     }
 
     // Find root node
     xml_node rootNode = document.document_element();
 
     // Query DeviceDetail records from metadata
-    StringMap<DeviceMetadataPtr> devices;
-
     for (xml_node device = rootNode.child("DeviceDetail"); device; device = device.next_sibling("DeviceDetail"))
     {
         DeviceMetadataPtr deviceMetadata = NewSharedPtr<DeviceMetadata>();
@@ -637,12 +726,14 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
         deviceMetadata->Latitude = stod(Coalesce(device.child_value("Latitude"), "0.0"));
         deviceMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
 
-        devices.insert_or_assign(deviceMetadata->Acronym, deviceMetadata);
+        // Devices carry the ID of the publisher node that defines them
+        if (snapshot.Devices.empty() && *device.child_value("NodeID") != '\0')
+            snapshot.NodeID = ParseGuid(device.child_value("NodeID"));
+
+        snapshot.Devices.push_back(deviceMetadata);
     }
 
     // Query MeasurementDetail records from metadata
-    unordered_map<Guid, MeasurementMetadataPtr> measurements;
-
     for (xml_node device = rootNode.child("MeasurementDetail"); device; device = device.next_sibling("MeasurementDetail"))
     {
         MeasurementMetadataPtr measurementMetadata = NewSharedPtr<MeasurementMetadata>();
@@ -656,6 +747,105 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
         measurementMetadata->Description = device.child_value("Description");
         measurementMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
 
+        snapshot.Measurements.push_back(measurementMetadata);
+    }
+
+    // Query PhasorDetail records from metadata
+    for (xml_node device = rootNode.child("PhasorDetail"); device; device = device.next_sibling("PhasorDetail"))
+    {
+        PhasorMetadataPtr phasorMetadata = NewSharedPtr<PhasorMetadata>();
+
+        phasorMetadata->DeviceAcronym = device.child_value("DeviceAcronym");
+        phasorMetadata->Label = device.child_value("Label");
+        phasorMetadata->Type = device.child_value("Type");
+        phasorMetadata->Phase = device.child_value("Phase");
+        phasorMetadata->SourceIndex = stoi(Coalesce(device.child_value("SourceIndex"), "0"));
+        phasorMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
+
+        snapshot.Phasors.push_back(phasorMetadata);
+    }
+
+    // Query SchemaVersion record from metadata
+    const xml_node schemaVersion = rootNode.child("SchemaVersion");
+
+    if (schemaVersion)
+        snapshot.VersionNumber = stoi(Coalesce(schemaVersion.child_value("VersionNumber"), "0"));
+
+    // Release uncompressed buffer
+    if (IsMetadataCompressed())
+        delete uncompressesBuffer;
+
+    snapshot.ConnectionKey = GetMetadataSnapshotKey();
+
+    return true;
+}
+
+// Compares the metadata version sent by the publisher with the loaded metadata snapshot,
+// requesting full metadata to replace the snapshot when the publisher version differs.
+void SubscriberInstance::ValidateMetadataSnapshot(const vector<uint8_t>& payload)
+{
+    MetadataSnapshot version;
+    bool matched = false;
+
+    if (ParseMetadata(payload, version))
+    {
+        ScopeLock lock(m_configurationUpdateLock);
+        matched = m_metadataSnapshot != nullptr && m_metadataSnapshot->NodeID == version.NodeID && m_metadataSnapshot->VersionNumber == version.VersionNumber;
+    }
+
+    if (matched)
+    {
+        StatusMessage("Metadata snapshot version " + ToString(version.VersionNumber) + " matches publisher metadata version");
+
+        // No metadata follows the snapshot subscription
+        m_subscribedFromSnapshot = false;
+        return;
+    }
+
+    StatusMessage("Metadata snapshot does not match publisher metadata version " + ToString(version.VersionNumber) + ", requesting metadata...");
+    SendMetadataRefreshCommand();
+}
+
+// Loads metadata from the snapshot file, if one exists for the current connection.
+bool SubscriberInstance::TryLoadMetadataSnapshot()
+{
+    if (m_metadataSnapshotPath.empty())
+        return false;
+
+    const SharedPtr<MetadataSnapshot> snapshot = NewSharedPtr<MetadataSnapshot>();
+
+    if (!snapshot->Load(m_metadataSnapshotPath, GetMetadataSnapshotKey()))
+        return false;
+
+    LoadMetadata(*snapshot, "metadata snapshot version " + ToString(snapshot->VersionNumber));
+
+    // Keep the snapshot to compare with the metadata received from the publisher
+    ScopeLock lock(m_configurationUpdateLock);
+    m_metadataSnapshot = snapshot;
+
+    return true;
+}
+
+// Gets the key that identifies the metadata requested by this instance: the publisher connection and metadata filters.
+string SubscriberInstance::GetMetadataSnapshotKey() const
+{
+    return m_hostname + ":" + ToString(m_port) + ";" + m_metadataFilters;
+}
+
+// Links the metadata records of the snapshot to each other, constructs the
+// configuration frames and makes the metadata available to consumers.
+void SubscriberInstance::LoadMetadata(const MetadataSnapshot& snapshot, const string& source)
+{
+    StringMap<DeviceMetadataPtr> devices;
+
+    for (const DeviceMetadataPtr& deviceMetadata : snapshot.Devices)
+        devices.insert_or_assign(deviceMetadata->Acronym, deviceMetadata);
+
+    unordered_map<Guid, MeasurementMetadataPtr> measurements;
+    measurements.reserve(snapshot.Measurements.size());
+
+    for (const MeasurementMetadataPtr& measurementMetadata : snapshot.Measurements)
+    {
         measurements.insert_or_assign(measurementMetadata->SignalID, measurementMetadata);
 
         // Lookup associated device
@@ -669,20 +859,10 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
         }
     }
 
-    // Query PhasorDetail records from metadata
     uint16_t phasorCount = 0;
 
-    for (xml_node device = rootNode.child("PhasorDetail"); device; device = device.next_sibling("PhasorDetail"))
+    for (const PhasorMetadataPtr& phasorMetadata : snapshot.Phasors)
     {
-        PhasorMetadataPtr phasorMetadata = NewSharedPtr<PhasorMetadata>();
-
-        phasorMetadata->DeviceAcronym = device.child_value("DeviceAcronym");
-        phasorMetadata->Label = device.child_value("Label");
-        phasorMetadata->Type = device.child_value("Type");
-        phasorMetadata->Phase = device.child_value("Phase");
-        phasorMetadata->SourceIndex = stoi(Coalesce(device.child_value("SourceIndex"), "0"));
-        phasorMetadata->UpdatedOn = ParseTimestamp(device.child_value("UpdatedOn"));
-
         // Create a new phasor reference
         PhasorReferencePtr phasorReference = NewSharedPtr<PhasorReference>();
         phasorReference->Phasor = phasorMetadata;
@@ -753,20 +933,21 @@ void SubscriberInstance::ReceivedMetadata(const vector<uint8_t>& payload)
     m_configurationUpdateLock.unlock();
 
     stringstream message;
-    message << "Loaded " << devices.size() << " devices, " << measurements.size() << " measurements and " << phasorCount << " phasors from GEP meta data...";
+    message << "Loaded " << devices.size() << " devices, " << measurements.size() << " measurements and " << phasorCount << " phasors from " << source << "...";
     StatusMessage(message.str());
 
-    // Release uncompressed buffer
-    if (IsMetadataCompressed())
-        delete uncompressesBuffer;
-
     // Notify derived class that meta-data has been parsed and is now available
     ParsedMetadata();
 }
 
 void SubscriberInstance::SendMetadataRefreshCommand()
 {
-    if (m_metadataFilters.empty())
+    SendMetadataRefreshCommand(m_metadataFilters);
+}
+
+void SubscriberInstance::SendMetadataRefreshCommand(const string& metadataFilters)
+{
+    if (metadataFilters.empty())
     {
         m_subscriber.SendServerCommand(ServerCommand::MetadataRefresh);
         return;
@@ -775,8 +956,8 @@ void SubscriberInstance::SendMetadataRefreshCommand()
     // Send meta-data filters when some are specified
     vector<uint8_t> buffer;
     
-    const uint8_t* metadataFiltersPtr = reinterpret_cast<uint8_t*>(&m_metadataFilters[0]);
-    const uint32_t metadataFiltersSize = static_cast<uint32_t>(m_metadataFilters.size() * sizeof(char));
+    const uint8_t* metadataFiltersPtr = reinterpret_cast<const uint8_t*>(metadataFilters.data());
+    const uint32_t metadataFiltersSize = static_cast<uint32_t>(metadataFilters.size() * sizeof(char));
     const uint32_t bufferSize = 4 + metadataFiltersSize;
 
     buffer.reserve(bufferSize);
@@ -1030,6 +1211,10 @@ void SubscriberInstance::HandleResubscribe(DataSubscriber* source)
     {
         instance->StatusMessage("Reconnected. Subscribing to data...");
         instance->ConnectionEstablished();
+
+        // Metadata requested before the connection was lost no longer follows a snapshot subscription
+        instance->m_subscribedFromSnapshot = false;
+        instance->m_validatingMetadataSnapshot = false;
         source->Subscribe();
     }
     else
@@ -1067,11 +1252,19 @@ void SubscriberInstance::HandleMetadata(DataSubscriber* source, const vector<uin
 {
     SubscriberInstance* instance = static_cast<SubscriberInstance*>(source->GetUserData());
 
+    // Metadata version requested to validate a snapshot is not handed to the virtual method
+    if (instance->m_validatingMetadataSnapshot.exchange(false))
+    {
+        instance->ValidateMetadataSnapshot(payload);
+        return;
+    }
+
     // Call virtual method to handle metadata payload
     instance->ReceivedMetadata(payload);
 
-    // When auto-parsing metadata, start subscription after successful user meta-data handling
-    if (instance->m_autoParseMetadata)
+    // When auto-parsing metadata, start subscription after successful user meta-data handling,
+    // unless already subscribed with the metadata snapshot this metadata was requested to validate
+    if (instance->m_autoParseMetadata && !instance->m_subscribedFromSnapshot.exchange(false))
         source->Subscribe();
 }
 
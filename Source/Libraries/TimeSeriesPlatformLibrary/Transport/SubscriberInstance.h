@@ -18,6 +18,9 @@
 //  ----------------------------------------------------------------------------------------------------
 //  03/21/2018 - J. Ritchie Carroll
 //       Generated original version of source code.
+//  10/15/2026 - GSF Development Team
+//       Added constructor to run the subscriber on a shared SubscriberExecutor.
+//       Added optional metadata snapshot file so a restart can subscribe without waiting on metadata.
 //
 //******************************************************************************************************
 
@@ -30,6 +33,8 @@ namespace GSF {
 namespace TimeSeries {
 namespace Transport
 {
+    class MetadataSnapshot;
+
     class SubscriberInstance  // NOLINT
     {
     private:
@@ -45,6 +50,10 @@ namespace Transport
         int16_t m_retryInterval;
         std::string m_filterExpression;
         std::string m_metadataFilters;
+        std::string m_metadataSnapshotPath;
+        SharedPtr<MetadataSnapshot> m_metadataSnapshot;
+        std::atomic<bool> m_subscribedFromSnapshot;
+        std::atomic<bool> m_validatingMetadataSnapshot;
         std::string m_startTime;
         std::string m_stopTime;
 
@@ -56,6 +65,12 @@ namespace Transport
         void* m_userData;
 
         void SendMetadataRefreshCommand();
+        void SendMetadataRefreshCommand(const std::string& metadataFilters);
+        bool ParseMetadata(const std::vector<uint8_t>& payload, MetadataSnapshot& snapshot);
+        void ValidateMetadataSnapshot(const std::vector<uint8_t>& payload);
+        bool TryLoadMetadataSnapshot();
+        std::string GetMetadataSnapshotKey() const;
+        void LoadMetadata(const MetadataSnapshot& snapshot, const std::string& source);
 
         static void ConstructConfigurationFrames(const GSF::StringMap<DeviceMetadataPtr>& devices, const std::unordered_map<Guid, MeasurementMetadataPtr>& measurements, GSF::StringMap<ConfigurationFramePtr>& configurationFrames);
         static bool TryFindMeasurement(const std::vector<MeasurementMetadataPtr>& measurements, SignalKind kind, uint16_t index, MeasurementMetadataPtr& measurementMetadata);
@@ -90,6 +105,9 @@ namespace Transport
 
         SubscriberInstance();
 
+        // Creates an instance whose subscriber runs on an executor shared with other subscribers.
+        explicit SubscriberInstance(const SubscriberExecutorPtr& executor);
+
     public:
         virtual ~SubscriberInstance();
 
@@ -160,6 +178,15 @@ namespace Transport
         const std::string& GetMetadataFilters() const;
         void SetMetadataFilters(const std::string& metadataFilters);
 
+        // Gets or sets the path of a file used to save parsed metadata between runs. When set and
+        // metadata is automatically parsed, metadata saved for the same host, port and metadata
+        // filters is loaded on connect and the subscription starts without waiting for metadata.
+        // Metadata is still requested from the publisher on each connect to validate the snapshot;
+        // it replaces and re-saves the snapshot only when it differs or is from another publisher
+        // node, without subscribing again. Delete the file to discard the snapshot.
+        const std::string& GetMetadataSnapshotPath() const;
+        void SetMetadataSnapshotPath(const std::string& metadataSnapshotPath);
+
         // Starts the connection cycle to a GEP publisher. Upon connection, meta-data will be requested,
         // when received, a subscription will be established
         void Connect();
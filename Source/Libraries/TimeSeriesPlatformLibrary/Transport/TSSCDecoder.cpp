@@ -0,0 +1,876 @@
+//******************************************************************************************************
+//  TSSCDecoder.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "TSSCDecoder.h"
+#include "Constants.h"
+#include "../Common/BinaryCodec.h"
+#include <cstring>
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+uint32_t Decode7BitUInt32(const uint8_t* stream, uint32_t& position);
+uint64_t Decode7BitUInt64(const uint8_t* stream, uint32_t& position);
+
+// Decodes a 7-bit encoded integer that ends before the last position. When the longest encoding
+// fits, the unrolled decoder is used, otherwise each byte is checked before it is read so that a
+// truncated encoding fails instead of reading past the end of the buffer.
+template<class T>
+static bool TryDecode7BitUInt(const uint8_t* data, uint32_t& position, uint32_t lastPosition, T& value)
+{
+    const uint32_t maxLength = sizeof(T) == sizeof(uint64_t) ? 9U : 5U;
+
+    if (position < lastPosition && lastPosition - position >= maxLength)
+    {
+        value = sizeof(T) == sizeof(uint64_t) ? static_cast<T>(Decode7BitUInt64(data, position)) : static_cast<T>(Decode7BitUInt32(data, position));
+        return true;
+    }
+
+    value = 0;
+
+    for (uint32_t i = 0; i < maxLength; i++)
+    {
+        if (position >= lastPosition)
+            return false;
+
+        const T byte = data[position++];
+
+        // The last byte of the longest encoding contributes all of its bits
+        if (i == maxLength - 1)
+        {
+            value |= byte << (7 * i);
+            break;
+        }
+
+        value |= (byte & 0x7F) << (7 * i);
+
+        if (byte < 128)
+            break;
+    }
+
+    return true;
+}
+
+// Gets the length in nibbles of the XOR read for the given code, which is zero for any code other than ValueXOR4 through ValueXOR32.
+static uint8_t GetXORLength(uint32_t code)
+{
+    return code >= TSSCCodeWords::ValueXOR4 && code <= TSSCCodeWords::ValueXOR32 ? static_cast<uint8_t>(code - TSSCCodeWords::ValueZero) : 0;
+}
+
+// Resolves the next eight bits of the bitstream to the length of the codeword they start with
+// and the prefix slot of that codeword, for each of the four encoding modes. The slot is held as
+// the shift that selects its code from the point's codes, where slot zero means the codeword ends
+// with the code itself as a 5-bit literal, which is held with the entry along with its XOR length.
+class CodeWordTable
+{
+public:
+    struct Entry
+    {
+        uint8_t Length;
+        uint8_t Shift;
+        uint8_t Literal;
+        uint8_t LiteralXORLength;
+    };
+
+    Entry Entries[4][256];
+
+    CodeWordTable()
+    {
+        for (uint32_t mode = 1; mode <= 4; mode++)
+        {
+            for (uint32_t window = 0; window < 256; window++)
+            {
+                Entry& entry = Entries[mode - 1][window];
+                uint32_t prefixLength = 0;
+
+                // Mode N uses the prefixes 1, 01, ... with N - 1 prefixed codes
+                // followed by a run of N - 1 zeros ahead of the literal code
+                while (prefixLength < mode - 1 && (window & (0x80 >> prefixLength)) == 0)
+                    prefixLength++;
+
+                if (prefixLength < mode - 1)
+                {
+                    entry.Length = static_cast<uint8_t>(prefixLength + 1);
+                    entry.Shift = static_cast<uint8_t>((prefixLength + 1) * 8);
+                    entry.Literal = 0;
+                    entry.LiteralXORLength = 0;
+                }
+                else
+                {
+                    entry.Length = static_cast<uint8_t>(prefixLength + 5);
+                    entry.Shift = 0;
+                    entry.Literal = static_cast<uint8_t>(window >> (3 - prefixLength) & 0x1F);
+                    entry.LiteralXORLength = GetXORLength(entry.Literal);
+                }
+            }
+        }
+    }
+};
+
+static const CodeWordTable CodeWords;
+
+// Describes how the value of a measurement and the new history of values of its point are taken
+// for each value code, as indexes into the candidates: the previous value XOR the bits read from
+// the stream, then the first, second and third previous values, then zero. Selecting with loads
+// rather than masks keeps the arithmetic units free for the bitstream, which limits decoding.
+struct ValueCode
+{
+    uint8_t Value;
+    uint8_t PrevValue2;
+    uint8_t PrevValue3;
+};
+
+static const ValueCode ValueCodes[] =
+{
+    { 0, 2, 3 },    // Value1
+    { 2, 1, 3 },    // Value2
+    { 3, 1, 2 },    // Value3
+    { 4, 1, 2 },    // ValueZero
+    { 0, 1, 2 },    // ValueXOR4 through ValueXOR32
+    { 0, 1, 2 },
+    { 0, 1, 2 },
+    { 0, 1, 2 },
+    { 0, 1, 2 },
+    { 0, 1, 2 },
+    { 0, 1, 2 },
+    { 0, 1, 2 }
+};
+
+static const uint32_t ValueByteMasks[] = { 0x00000000, 0x000000FF, 0x0000FFFF, 0x00FFFFFF, 0xFFFFFFFF };
+
+TSSCDecoder::PointMetadata::PointMetadata(uint16_t prevNextPointId1) :
+    CommandsSentSinceLastChange(0),
+    AdaptCommandCount(5),
+    Mode(4),
+    Predictable(false),
+    Codes(TSSCCodeWords::Value1 << 8 | TSSCCodeWords::Value2 << 16 | TSSCCodeWords::Value3 << 24),
+    XORLengths(0),
+    PrevNextPointId1(prevNextPointId1),
+    PrevQuality1(0),
+    PrevQuality2(0),
+    PrevValue1(0),
+    PrevValue2(0),
+    PrevValue3(0)
+{
+    memset(CommandStats, 0, CommandStatsLength);
+}
+
+TSSCDecoder::StreamPosition::StreamPosition() :
+    Data(nullptr),
+    Position(0),
+    LastPosition(0),
+    BitStreamCount(0),
+    BitStreamCache(0)
+{
+}
+
+TSSCDecoder::TSSCDecoder() :
+    m_prevTimestamp1(0L),
+    m_prevTimestamp2(0L),
+    m_prevTimeDelta1(Int64::MaxValue),
+    m_prevTimeDelta2(Int64::MaxValue),
+    m_prevTimeDelta3(Int64::MaxValue),
+    m_prevTimeDelta4(Int64::MaxValue),
+    m_lastPoint(0)
+{
+    m_points.emplace_back();
+}
+
+// Resets the decoder to the initial state.
+void TSSCDecoder::Reset()
+{
+    m_stream = StreamPosition();
+    m_points.clear();
+    m_points.emplace_back();
+    m_lastPoint = 0;
+    m_prevTimeDelta1 = Int64::MaxValue;
+    m_prevTimeDelta2 = Int64::MaxValue;
+    m_prevTimeDelta3 = Int64::MaxValue;
+    m_prevTimeDelta4 = Int64::MaxValue;
+    m_prevTimestamp1 = 0L;
+    m_prevTimestamp2 = 0L;
+    m_errorMessage.clear();
+}
+
+// Sets the buffer to decode measurements from.
+void TSSCDecoder::SetBuffer(const uint8_t* data, uint32_t offset, uint32_t length)
+{
+    ClearBitStream(m_stream);
+    m_stream.Data = data;
+    m_stream.Position = offset;
+    m_stream.LastPosition = length;
+}
+
+// Gets the byte that would be read next, or zero at the end of the buffer.
+inline uint32_t TSSCDecoder::PeekByte(const StreamPosition& stream)
+{
+    return stream.Position < stream.LastPosition ? stream.Data[stream.Position] : 0U;
+}
+
+// Gets the four bytes that would be read next in little-endian order, where bytes
+// past the end of the buffer read as zero.
+inline uint32_t TSSCDecoder::PeekBytes(const StreamPosition& stream)
+{
+    const uint8_t* data = stream.Data + stream.Position;
+    uint32_t bytes = 0U;
+
+    if (stream.Position + 4 <= stream.LastPosition)
+    {
+        bytes = static_cast<uint32_t>(data[0]) | static_cast<uint32_t>(data[1]) << 8 | static_cast<uint32_t>(data[2]) << 16 | static_cast<uint32_t>(data[3]) << 24;
+    }
+    else
+    {
+        for (uint32_t i = 0; stream.Position + i < stream.LastPosition; i++)
+            bytes |= static_cast<uint32_t>(data[i]) << (i * 8);
+    }
+
+    return bytes;
+}
+
+// Gets the next eight bits of the bitstream, i.e., the bits remaining in the
+// current bitstream byte followed by the byte that would be read next.
+inline uint32_t TSSCDecoder::PeekBits(const StreamPosition& stream, uint32_t nextByte)
+{
+    return (stream.BitStreamCache << 8 | nextByte) >> stream.BitStreamCount & 0xFF;
+}
+
+// Consumes bits from the bitstream, moving the next byte into the bitstream cache
+// when more bits are needed than remain. Reading past the end of the buffer leaves
+// the position past the last position, which fails the measurement being decoded.
+// The cache is selected with a mask since whether a byte is loaded is unpredictable.
+inline void TSSCDecoder::SkipBits(StreamPosition& stream, uint32_t length, uint32_t nextByte)
+{
+    const uint32_t load = length > stream.BitStreamCount ? 1U : 0U;
+    const uint32_t mask = 0U - load;
+
+    stream.BitStreamCache = (nextByte & mask) | (stream.BitStreamCache & ~mask);
+    stream.BitStreamCount = stream.BitStreamCount + load * 8 - length;
+    stream.Position += load;
+}
+
+// Reads the given number of bits, up to eight, from the bitstream.
+inline uint32_t TSSCDecoder::ReadBits(StreamPosition& stream, uint32_t length, uint32_t nextByte)
+{
+    const uint32_t window = PeekBits(stream, nextByte);
+
+    SkipBits(stream, length, nextByte);
+
+    return window >> (8 - length);
+}
+
+// Gets the next codeword of the given point's encoding mode, its length in bits and the length
+// in nibbles of the XOR read for its code without consuming it, where next byte is the byte that
+// would be read next from the buffer.
+inline uint8_t TSSCDecoder::PeekCode(const StreamPosition& stream, const PointMetadata& point, uint32_t nextByte, uint32_t& length, uint32_t& xorLength)
+{
+    // The code of a predictable point is nearly always the single bit 1, which is
+    // usually still held in the bitstream cache, so it is read without the table
+    if (point.Predictable && ((stream.BitStreamCache << 1) >> stream.BitStreamCount & 1U) != 0)
+    {
+        length = 1;
+        xorLength = point.XORLengths >> 8 & 0xF;
+        return static_cast<uint8_t>(point.Codes >> 8);
+    }
+
+    const CodeWordTable::Entry& entry = CodeWords.Entries[static_cast<size_t>(point.Mode) - 1][PeekBits(stream, nextByte)];
+
+    length = entry.Length;
+
+    // The literal fills the zero first byte of the codes, so one shift selects the code of any slot,
+    // and the XOR length is selected the same way without waiting on the code to look it up
+    xorLength = (point.XORLengths | entry.LiteralXORLength) >> entry.Shift & 0xF;
+    return static_cast<uint8_t>((point.Codes | entry.Literal) >> entry.Shift);
+}
+
+// Reads the next codeword of the given point's encoding mode.
+inline uint8_t TSSCDecoder::ReadCode(StreamPosition& stream, PointMetadata& point)
+{
+    const uint32_t nextByte = PeekByte(stream);
+    uint32_t length;
+    uint32_t xorLength;
+    const uint8_t code = PeekCode(stream, point, nextByte, length, xorLength);
+
+    SkipBits(stream, length, nextByte);
+    UpdateCodeStatistics(point, code);
+
+    return code;
+}
+
+// Reads the XOR of a value code, given its length in nibbles. Codes ValueXOR4 through ValueXOR32
+// read alternately a nibble and whole bytes of the XOR, and the other value codes read nothing.
+// When not checked, the stream must hold at least MaxValueBytes - 1 more bytes.
+template<bool Checked>
+inline uint32_t TSSCDecoder::ReadXOR(StreamPosition& stream, uint32_t xorLength)
+{
+    const uint32_t nibbleBits = (xorLength & 1U) << 2;
+    const uint32_t byteCount = xorLength >> 1;
+    const uint32_t nextByte = Checked ? PeekByte(stream) : stream.Data[stream.Position];
+
+    // The nibble is taken from the top of the remaining bits by one shift and masked off for even lengths
+    const uint32_t nibble = (stream.BitStreamCache << 8 | nextByte) >> (stream.BitStreamCount + 8 - nibbleBits) & (0U - (xorLength & 1U)) & 0xF;
+
+    SkipBits(stream, nibbleBits, nextByte);
+
+    const uint32_t bytes = Checked ? PeekBytes(stream) : ByteOrder::LoadLittleEndian<uint32_t>(stream.Data + stream.Position);
+    stream.Position += byteCount;
+
+    return nibble | (bytes & ValueByteMasks[byteCount]) << nibbleBits;
+}
+
+// Reads the XOR for the given value code, given its length in nibbles, and decodes the value from the history of the point.
+template<bool Checked>
+inline uint32_t TSSCDecoder::DecodeValue(StreamPosition& stream, PointMetadata& point, uint8_t code, uint32_t xorLength, bool predictable)
+{
+    // The value codes of a predictable point are branched on, which
+    // leaves out selecting the history for the most frequent codes
+    if (predictable)
+    {
+        if (code == TSSCCodeWords::Value1)
+            return point.PrevValue1;
+
+        if (code >= TSSCCodeWords::ValueXOR4)
+        {
+            const uint32_t bits = ReadXOR<Checked>(stream, xorLength);
+
+            point.PrevValue3 = point.PrevValue2;
+            point.PrevValue2 = point.PrevValue1;
+            point.PrevValue1 ^= bits;
+
+            return point.PrevValue1;
+        }
+    }
+
+    // The value codes of any other point are hard to predict,
+    // so every value code is decoded by the same branch-free sequence
+    const ValueCode& valueCode = ValueCodes[static_cast<size_t>(code) - TSSCCodeWords::Value1];
+    const uint32_t bits = ReadXOR<Checked>(stream, xorLength);
+    const uint32_t values[] = { point.PrevValue1 ^ bits, point.PrevValue1, point.PrevValue2, point.PrevValue3, 0U };
+    const uint32_t value = values[valueCode.Value];
+
+    point.PrevValue3 = values[valueCode.PrevValue3];
+    point.PrevValue2 = values[valueCode.PrevValue2];
+    point.PrevValue1 = value;
+
+    return value;
+}
+
+// Decodes the next measurement from the buffer.
+TSSCDecodeResult TSSCDecoder::DecodeNext(uint16_t& id, int64_t& timestamp, uint32_t& quality, float32_t& value)
+{
+    TSSCMeasurement measurement;
+    uint32_t count;
+    const TSSCDecodeResult result = DecodeBlock(&measurement, 1, count);
+
+    if (count > 0)
+    {
+        id = measurement.ID;
+        timestamp = measurement.Timestamp;
+        quality = measurement.Quality;
+        value = measurement.Value;
+    }
+
+    return result;
+}
+
+// Decodes measurements that carry only a value code for an existing point whose codes are not due
+// to adapt, until the given end of the measurements or a measurement that needs the general decoding
+// of DecodeBlock. Runs of these measurements are decoded without any calls, so unlike in DecodeBlock,
+// the stream state is never spilled around calls and stays in registers throughout the loop. Only
+// measurements that start at least MaxValueBytes before the end of the buffer are decoded here, so
+// none of their reads need to be checked and the last few of each buffer are left to DecodeBlock.
+TSSCMeasurement* TSSCDecoder::DecodeValues(StreamPosition& stream, PointMetadata* points, size_t pointCount, int64_t timestamp, PointMetadata*& lastPoint, TSSCMeasurement* measurement, TSSCMeasurement* measurementsEnd)
+{
+    StreamPosition position = stream;
+    PointMetadata* point = lastPoint;
+
+    if (position.LastPosition < MaxValueBytes)
+        return measurement;
+
+    const uint32_t lastValuePosition = position.LastPosition - MaxValueBytes;
+
+    while (measurement < measurementsEnd && position.Position <= lastValuePosition)
+    {
+        const uint32_t nextIndex = point->PrevNextPointId1 + 1U;
+
+        if (nextIndex >= pointCount || point->CommandsSentSinceLastChange >= point->AdaptCommandCount)
+            break;
+
+        const uint32_t nextByte = position.Data[position.Position];
+        uint32_t length;
+        uint32_t xorLength;
+        const uint8_t code = PeekCode(position, *point, nextByte, length, xorLength);
+
+        if (code < TSSCCodeWords::Value1 || code > TSSCCodeWords::ValueXOR32)
+            break;
+
+        SkipBits(position, length, nextByte);
+        point->CommandsSentSinceLastChange++;
+        point->CommandStats[code]++;
+
+        PointMetadata& nextPoint = points[nextIndex];
+        const uint32_t value = DecodeValue<false>(position, nextPoint, code, xorLength, point->Predictable);
+
+        measurement->ID = point->PrevNextPointId1;
+        measurement->Timestamp = timestamp;
+        measurement->Quality = nextPoint.PrevQuality1;
+        memcpy(&measurement->Value, &value, sizeof(float32_t));
+        measurement++;
+        point = &nextPoint;
+    }
+
+    stream = position;
+    lastPoint = point;
+
+    return measurement;
+}
+
+// Decodes up to the given number of measurements from the buffer. The stream position and point
+// array are held in locals whose addresses never escape, so they stay in registers across the loop
+// even though the byte-sized code statistics stores could otherwise alias any member.
+TSSCDecodeResult TSSCDecoder::DecodeBlock(TSSCMeasurement* measurements, uint32_t capacity, uint32_t& count)
+{
+    StreamPosition stream = m_stream;
+    PointMetadata* points = m_points.data();
+    PointMetadata* lastPoint = points + m_lastPoint;
+    TSSCMeasurement* measurement = measurements;
+    TSSCMeasurement* measurementsEnd = measurements + capacity;
+    TSSCDecodeResult result = TSSCDecodeResult::Measurement;
+
+    // Describes the failure once the loop is left
+    const char* errorMessage = nullptr;
+    uint8_t expectedCode = 0;
+    uint8_t code = 0;
+
+    while (measurement < measurementsEnd)
+    {
+        // Most measurements carry only a value code, which are decoded in runs
+        measurement = DecodeValues(stream, points, m_points.size(), m_prevTimestamp1, lastPoint, measurement, measurementsEnd);
+
+        if (measurement == measurementsEnd)
+            break;
+
+        if (stream.Position == stream.LastPosition && stream.BitStreamCount == 0)
+        {
+            result = TSSCDecodeResult::EndOfStream;
+            break;
+        }
+
+        // The most recently received point holds the coding
+        // algorithm for the codes of the next measurement
+        code = ReadCode(stream, *lastPoint);
+
+        if (code == TSSCCodeWords::EndOfStream)
+        {
+            if (stream.Position > stream.LastPosition)
+                errorMessage = "Unexpected end of stream";
+            else
+                result = TSSCDecodeResult::EndOfStream;
+
+            break;
+        }
+
+        if (code <= TSSCCodeWords::PointIDXOR16)
+        {
+            if (!DecodePointID(stream, code, *lastPoint))
+            {
+                errorMessage = "Unexpected end of stream";
+                break;
+            }
+
+            code = ReadCode(stream, *lastPoint);
+
+            if (code < TSSCCodeWords::TimeDelta1Forward)
+            {
+                expectedCode = TSSCCodeWords::TimeDelta1Forward;
+                break;
+            }
+        }
+
+        const uint16_t id = lastPoint->PrevNextPointId1;
+        const uint32_t nextIndex = id + 1U;
+
+        // Points are created in order of their IDs so that each point
+        // has the same initial state as when the parser creates it
+        if (nextIndex >= m_points.size())
+        {
+            const ptrdiff_t lastIndex = lastPoint - points;
+
+            for (uint32_t i = static_cast<uint32_t>(m_points.size()); i <= nextIndex; i++)
+                m_points.emplace_back(static_cast<uint16_t>(i));
+
+            points = m_points.data();
+            lastPoint = points + lastIndex;
+        }
+
+        PointMetadata& nextPoint = points[nextIndex];
+
+        if (code <= TSSCCodeWords::TimeXOR7Bit)
+        {
+            uint64_t bits = 0UL;
+
+            if (code == TSSCCodeWords::TimeXOR7Bit)
+            {
+                // Position is copied so that its address does not escape
+                uint32_t position = stream.Position;
+
+                if (!TryDecode7BitUInt(stream.Data, position, stream.LastPosition, bits))
+                {
+                    errorMessage = "Unexpected end of stream";
+                    break;
+                }
+
+                stream.Position = position;
+            }
+
+            DecodeTimestamp(code, bits);
+            code = ReadCode(stream, *lastPoint);
+
+            if (code < TSSCCodeWords::Quality2)
+            {
+                expectedCode = TSSCCodeWords::Quality2;
+                break;
+            }
+        }
+
+        if (code <= TSSCCodeWords::Quality7Bit32)
+        {
+            uint32_t quality = nextPoint.PrevQuality2;
+
+            if (code == TSSCCodeWords::Quality7Bit32)
+            {
+                uint32_t position = stream.Position;
+
+                if (!TryDecode7BitUInt(stream.Data, position, stream.LastPosition, quality))
+                {
+                    errorMessage = "Unexpected end of stream";
+                    break;
+                }
+
+                stream.Position = position;
+            }
+
+            nextPoint.PrevQuality2 = nextPoint.PrevQuality1;
+            nextPoint.PrevQuality1 = quality;
+            code = ReadCode(stream, *lastPoint);
+
+            if (code < TSSCCodeWords::Value1)
+            {
+                expectedCode = TSSCCodeWords::Value1;
+                break;
+            }
+        }
+
+        if (code > TSSCCodeWords::ValueXOR32)
+        {
+            errorMessage = "Invalid code received";
+            break;
+        }
+
+        const uint32_t value = DecodeValue<true>(stream, nextPoint, code, GetXORLength(code), lastPoint->Predictable);
+
+        if (stream.Position > stream.LastPosition)
+        {
+            errorMessage = "Unexpected end of stream";
+            break;
+        }
+
+        measurement->ID = id;
+        measurement->Timestamp = m_prevTimestamp1;
+        measurement->Quality = nextPoint.PrevQuality1;
+        memcpy(&measurement->Value, &value, sizeof(float32_t));
+        measurement++;
+        lastPoint = &nextPoint;
+    }
+
+    m_stream = stream;
+    m_lastPoint = static_cast<uint32_t>(lastPoint - points);
+    count = static_cast<uint32_t>(measurement - measurements);
+
+    if (errorMessage != nullptr)
+    {
+        if (code > TSSCCodeWords::ValueXOR32)
+            return Fail(string(errorMessage) + " " + to_string(static_cast<int>(code)));
+
+        return Fail(errorMessage);
+    }
+
+    if (expectedCode != 0)
+        return FailUnexpectedCode(expectedCode, code);
+
+    if (result == TSSCDecodeResult::EndOfStream)
+        ClearBitStream(m_stream);
+
+    return result;
+}
+
+inline void TSSCDecoder::UpdateCodeStatistics(PointMetadata& point, uint8_t code)
+{
+    point.CommandsSentSinceLastChange++;
+    point.CommandStats[code]++;
+
+    // Codes are adapted after 5, then 20, then every 100 commands
+    if (point.CommandsSentSinceLastChange > point.AdaptCommandCount)
+    {
+        point.AdaptCommandCount = point.AdaptCommandCount < 20 ? 20 : 100;
+        AdaptCommands(point);
+    }
+}
+
+void TSSCDecoder::AdaptCommands(PointMetadata& point)
+{
+    uint8_t code1 = 0;
+    int32_t count1 = 0;
+
+    uint8_t code2 = 1;
+    int32_t count2 = 0;
+
+    uint8_t code3 = 2;
+    int32_t count3 = 0;
+
+    int32_t total = 0;
+
+    for (int32_t i = 0; i < CommandStatsLength; i++)
+    {
+        const int32_t count = point.CommandStats[i];
+        point.CommandStats[i] = 0;
+
+        total += count;
+
+        if (count > count3)
+        {
+            if (count > count1)
+            {
+                code3 = code2;
+                count3 = count2;
+
+                code2 = code1;
+                count2 = count1;
+
+                code1 = static_cast<uint8_t>(i);
+                count1 = count;
+            }
+            else if (count > count2)
+            {
+                code3 = code2;
+                count3 = count2;
+
+                code2 = static_cast<uint8_t>(i);
+                count2 = count;
+            }
+            else
+            {
+                code3 = static_cast<uint8_t>(i);
+                count3 = count;
+            }
+        }
+    }
+
+    const int32_t mode1Size = total * 5;
+    const int32_t mode2Size = count1 * 1 + (total - count1) * 6;
+    const int32_t mode3Size = count1 * 1 + count2 * 2 + (total - count1 - count2) * 7;
+    const int32_t mode4Size = count1 * 1 + count2 * 2 + count3 * 3 + (total - count1 - count2 - count3) * 8;
+
+    const int32_t minSize = min(min(mode1Size, mode2Size), min(mode3Size, mode4Size));
+
+    // Only the codes of the selected mode are ever read
+    // When the first code is read for nearly every command, branching on it costs less than
+    // decoding every code the same way
+    point.Predictable = minSize != mode1Size && count1 * 3 >= total * 2;
+
+    if (minSize == mode1Size)
+    {
+        point.Mode = 1;
+    }
+    else if (minSize == mode2Size)
+    {
+        point.Mode = 2;
+        point.Codes = code1 << 8;
+        point.XORLengths = GetXORLength(code1) << 8;
+    }
+    else if (minSize == mode3Size)
+    {
+        point.Mode = 3;
+        point.Codes = code1 << 8 | code2 << 16;
+        point.XORLengths = GetXORLength(code1) << 8 | GetXORLength(code2) << 16;
+    }
+    else
+    {
+        point.Mode = 4;
+        point.Codes = code1 << 8 | code2 << 16 | code3 << 24;
+        point.XORLengths = GetXORLength(code1) << 8 | GetXORLength(code2) << 16 | GetXORLength(code3) << 24;
+    }
+
+    point.CommandsSentSinceLastChange = 0;
+}
+
+// Returns false when the point ID runs past the end of the stream.
+inline bool TSSCDecoder::DecodePointID(StreamPosition& stream, uint8_t code, PointMetadata& lastPoint)
+{
+    if (code == TSSCCodeWords::PointIDXOR4)
+    {
+        lastPoint.PrevNextPointId1 ^= static_cast<uint16_t>(ReadBits(stream, 4, PeekByte(stream)));
+    }
+    else if (code == TSSCCodeWords::PointIDXOR8)
+    {
+        if (stream.Position + 1 > stream.LastPosition)
+            return false;
+
+        lastPoint.PrevNextPointId1 ^= static_cast<uint16_t>(stream.Data[stream.Position++]);
+    }
+    else if (code == TSSCCodeWords::PointIDXOR12)
+    {
+        lastPoint.PrevNextPointId1 ^= static_cast<uint16_t>(ReadBits(stream, 4, PeekByte(stream)));
+
+        if (stream.Position + 1 > stream.LastPosition)
+            return false;
+
+        lastPoint.PrevNextPointId1 ^= static_cast<uint16_t>(stream.Data[stream.Position++] << 4);
+    }
+    else
+    {
+        if (stream.Position + 2 > stream.LastPosition)
+            return false;
+
+        lastPoint.PrevNextPointId1 ^= static_cast<uint16_t>(stream.Data[stream.Position++]);
+        lastPoint.PrevNextPointId1 ^= static_cast<uint16_t>(stream.Data[stream.Position++] << 8);
+    }
+
+    return true;
+}
+
+// Decodes the timestamp for the given code, where bits holds the 7-bit encoded XOR of a TimeXOR7Bit code.
+int64_t TSSCDecoder::DecodeTimestamp(uint8_t code, uint64_t bits)
+{
+    int64_t timestamp;
+
+    switch (code)
+    {
+        case TSSCCodeWords::TimeDelta1Forward:
+            timestamp = m_prevTimestamp1 + m_prevTimeDelta1;
+            break;
+        case TSSCCodeWords::TimeDelta2Forward:
+            timestamp = m_prevTimestamp1 + m_prevTimeDelta2;
+            break;
+        case TSSCCodeWords::TimeDelta3Forward:
+            timestamp = m_prevTimestamp1 + m_prevTimeDelta3;
+            break;
+        case TSSCCodeWords::TimeDelta4Forward:
+            timestamp = m_prevTimestamp1 + m_prevTimeDelta4;
+            break;
+        case TSSCCodeWords::TimeDelta1Reverse:
+            timestamp = m_prevTimestamp1 - m_prevTimeDelta1;
+            break;
+        case TSSCCodeWords::TimeDelta2Reverse:
+            timestamp = m_prevTimestamp1 - m_prevTimeDelta2;
+            break;
+        case TSSCCodeWords::TimeDelta3Reverse:
+            timestamp = m_prevTimestamp1 - m_prevTimeDelta3;
+            break;
+        case TSSCCodeWords::TimeDelta4Reverse:
+            timestamp = m_prevTimestamp1 - m_prevTimeDelta4;
+            break;
+        case TSSCCodeWords::Timestamp2:
+            timestamp = m_prevTimestamp2;
+            break;
+        default:
+            timestamp = m_prevTimestamp1 ^ static_cast<int64_t>(bits);
+            break;
+    }
+
+    // Save the smallest delta time
+    const int64_t minDelta = abs(m_prevTimestamp1 - timestamp);
+
+    if (minDelta < m_prevTimeDelta4 && minDelta != m_prevTimeDelta1 && minDelta != m_prevTimeDelta2 && minDelta != m_prevTimeDelta3)
+    {
+        if (minDelta < m_prevTimeDelta1)
+        {
+            m_prevTimeDelta4 = m_prevTimeDelta3;
+            m_prevTimeDelta3 = m_prevTimeDelta2;
+            m_prevTimeDelta2 = m_prevTimeDelta1;
+            m_prevTimeDelta1 = minDelta;
+        }
+        else if (minDelta < m_prevTimeDelta2)
+        {
+            m_prevTimeDelta4 = m_prevTimeDelta3;
+            m_prevTimeDelta3 = m_prevTimeDelta2;
+            m_prevTimeDelta2 = minDelta;
+        }
+        else if (minDelta < m_prevTimeDelta3)
+        {
+            m_prevTimeDelta4 = m_prevTimeDelta3;
+            m_prevTimeDelta3 = minDelta;
+        }
+        else
+        {
+            m_prevTimeDelta4 = minDelta;
+        }
+    }
+
+    m_prevTimestamp2 = m_prevTimestamp1;
+    m_prevTimestamp1 = timestamp;
+
+    return timestamp;
+}
+
+void TSSCDecoder::ClearBitStream(StreamPosition& stream)
+{
+    stream.BitStreamCount = 0;
+    stream.BitStreamCache = 0;
+}
+
+// Records the reason decoding failed. Decoding cannot continue until the decoder is reset.
+TSSCDecodeResult TSSCDecoder::Fail(const string& message)
+{
+    stringstream errorMessageStream;
+
+    errorMessageStream << message;
+    errorMessageStream << " at position ";
+    errorMessageStream << m_stream.Position;
+    errorMessageStream << " with last position ";
+    errorMessageStream << m_stream.LastPosition;
+
+    m_errorMessage = errorMessageStream.str();
+    ClearBitStream(m_stream);
+
+    return TSSCDecodeResult::Error;
+}
+
+TSSCDecodeResult TSSCDecoder::FailUnexpectedCode(uint8_t expectedCode, uint8_t code)
+{
+    stringstream errorMessageStream;
+
+    errorMessageStream << "Expecting code >= ";
+    errorMessageStream << static_cast<int>(expectedCode);
+    errorMessageStream << " Received ";
+    errorMessageStream << static_cast<int>(code);
+
+    return Fail(errorMessageStream.str());
+}
+
+// Gets the description of the error that caused decoding to fail.
+const string& TSSCDecoder::GetErrorMessage() const
+{
+    return m_errorMessage;
+}
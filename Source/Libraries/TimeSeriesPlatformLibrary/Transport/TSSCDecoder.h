@@ -0,0 +1,214 @@
+//******************************************************************************************************
+//  TSSCDecoder.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __TSSC_DECODER_H
+#define __TSSC_DECODER_H
+
+#include "TransportTypes.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Result of decoding the next measurement from a TSSC stream.
+    enum class TSSCDecodeResult
+    {
+        Measurement,
+        EndOfStream,
+        Error
+    };
+
+    // A measurement decoded from a TSSC stream.
+    struct TSSCMeasurement
+    {
+        int64_t Timestamp;
+        uint32_t Quality;
+        float32_t Value;
+        uint16_t ID;
+    };
+
+    // High-performance decoder for the TSSC measurement format of the Gateway Exchange Protocol.
+    //
+    // Decoding produces exactly the same measurements as the TSSCMeasurementParser, but rather
+    // than reading codeword prefixes one bit at a time, the decoder peeks at the next eight bits
+    // of the bitstream and resolves the codeword of any encoding mode with a single table lookup.
+    // The codes of a point whose values mostly repeat are predictable and are branched on, while
+    // the codes and values of any other point are decoded without branching on the data, so the
+    // decode loop does not stall on mispredicted branches when successive codes are irregular.
+    // Runs of measurements that carry only a value code, as in a frame of measurements sharing
+    // one timestamp, are decoded by a loop that makes no calls and keeps the stream in registers.
+    // The state of each point is stored by value in one contiguous array and errors are reported
+    // through the decode result, so the decode loop has no reference counting or exceptions.
+    // Every read is checked against the end of the stream, or for runs of values that start far
+    // enough from the end, the whole measurement is checked at once, so a truncated or corrupt
+    // packet fails with an error rather than reading past the buffer.
+    class TSSCDecoder // NOLINT
+    {
+    private:
+        static const uint8_t CommandStatsLength = 32;
+
+        // Most bytes read for a value code and its XOR, including the bitstream bytes
+        // the codeword and the nibble may load and the whole four bytes read for the XOR
+        static const uint32_t MaxValueBytes = 6;
+
+        // The metadata kept for each point ID.
+        struct PointMetadata
+        {
+            uint8_t CommandStats[CommandStatsLength];
+            int32_t CommandsSentSinceLastChange;
+
+            // Number of commands after which the codes are next adapted
+            int32_t AdaptCommandCount;
+
+            // Encoding mode and the codes assigned to the prefixes 1, 01 and 001 of that
+            // mode, held in the second, third and fourth byte with the first byte zero
+            uint8_t Mode;
+            bool Predictable;
+            uint32_t Codes;
+
+            // Lengths in nibbles of the XOR read for each of the codes, in the same bytes as the codes
+            uint32_t XORLengths;
+
+            uint16_t PrevNextPointId1;
+
+            uint32_t PrevQuality1;
+            uint32_t PrevQuality2;
+            uint32_t PrevValue1;
+            uint32_t PrevValue2;
+            uint32_t PrevValue3;
+
+            PointMetadata(uint16_t prevNextPointId1 = 0);
+        };
+
+        // Read position within the buffer and its bitstream.
+        struct StreamPosition
+        {
+            const uint8_t* Data;
+            uint32_t Position;
+            uint32_t LastPosition;
+
+            // Bits remaining in the most recently read bitstream byte
+            uint32_t BitStreamCount;
+            uint32_t BitStreamCache;
+
+            StreamPosition();
+        };
+
+        StreamPosition m_stream;
+
+        int64_t m_prevTimestamp1;
+        int64_t m_prevTimestamp2;
+
+        int64_t m_prevTimeDelta1;
+        int64_t m_prevTimeDelta2;
+        int64_t m_prevTimeDelta3;
+        int64_t m_prevTimeDelta4;
+
+        // Index zero holds the state used before the first measurement,
+        // the state of point ID n is held at index n + 1
+        std::vector<PointMetadata> m_points;
+        uint32_t m_lastPoint;
+
+        // Details of the last decode error
+        std::string m_errorMessage;
+
+        static uint32_t PeekByte(const StreamPosition& stream);
+        static uint32_t PeekBytes(const StreamPosition& stream);
+        static uint32_t PeekBits(const StreamPosition& stream, uint32_t nextByte);
+        static void SkipBits(StreamPosition& stream, uint32_t length, uint32_t nextByte);
+        static uint32_t ReadBits(StreamPosition& stream, uint32_t length, uint32_t nextByte);
+        static uint8_t PeekCode(const StreamPosition& stream, const PointMetadata& point, uint32_t nextByte, uint32_t& length, uint32_t& xorLength);
+        static uint8_t ReadCode(StreamPosition& stream, PointMetadata& point);
+        static void UpdateCodeStatistics(PointMetadata& point, uint8_t code);
+        static void AdaptCommands(PointMetadata& point);
+        static void ClearBitStream(StreamPosition& stream);
+
+        static bool DecodePointID(StreamPosition& stream, uint8_t code, PointMetadata& lastPoint);
+
+        template<bool Checked>
+        static uint32_t ReadXOR(StreamPosition& stream, uint32_t xorLength);
+
+        template<bool Checked>
+        static uint32_t DecodeValue(StreamPosition& stream, PointMetadata& point, uint8_t code, uint32_t xorLength, bool predictable);
+
+        static TSSCMeasurement* DecodeValues(StreamPosition& stream, PointMetadata* points, size_t pointCount, int64_t timestamp, PointMetadata*& lastPoint, TSSCMeasurement* measurement, TSSCMeasurement* measurementsEnd);
+        int64_t DecodeTimestamp(uint8_t code, uint64_t bits);
+
+        TSSCDecodeResult Fail(const std::string& message);
+        TSSCDecodeResult FailUnexpectedCode(uint8_t expectedCode, uint8_t code);
+
+    public:
+        // Creates a new instance of the TSSC decoder.
+        TSSCDecoder();
+
+        // Resets the decoder to the initial state.
+        void Reset();
+
+        // Sets the buffer to decode measurements from, the length is the position
+        // within the data at which the TSSC stream ends.
+        void SetBuffer(const uint8_t* data, uint32_t offset, uint32_t length);
+
+        // Decodes the next measurement from the buffer.
+        TSSCDecodeResult DecodeNext(uint16_t& id, int64_t& timestamp, uint32_t& quality, float32_t& value);
+
+        // Decodes up to the given number of measurements from the buffer into the array, setting
+        // count to the number decoded. The result is Measurement while more may remain in the buffer.
+        TSSCDecodeResult DecodeBlock(TSSCMeasurement* measurements, uint32_t capacity, uint32_t& count);
+
+        // Decodes every measurement in the given buffer, passing each one to the handler in the
+        // form handler(id, timestamp, quality, value). Returns false if the stream is invalid.
+        template<class Handler>
+        bool Decode(const uint8_t* data, uint32_t offset, uint32_t length, Handler handler);
+
+        // Gets the description of the error that caused decoding to fail.
+        const std::string& GetErrorMessage() const;
+    };
+
+    // Decodes every measurement in the given buffer.
+    template<class Handler>
+    bool TSSCDecoder::Decode(const uint8_t* data, uint32_t offset, uint32_t length, Handler handler)
+    {
+        const uint32_t BlockSize = 256;
+
+        TSSCMeasurement measurements[BlockSize];
+        uint32_t count;
+        TSSCDecodeResult result;
+
+        SetBuffer(data, offset, length);
+
+        // Measurements are decoded in blocks so the stream state
+        // stays in registers across the whole decode loop
+        do
+        {
+            result = DecodeBlock(measurements, BlockSize, count);
+
+            for (uint32_t i = 0; i < count; i++)
+                handler(measurements[i].ID, measurements[i].Timestamp, measurements[i].Quality, measurements[i].Value);
+        }
+        while (result == TSSCDecodeResult::Measurement);
+
+        return result == TSSCDecodeResult::EndOfStream;
+    }
+}}}
+
+#endif
@@ -0,0 +1,588 @@
+//******************************************************************************************************
+//  TSSCMeasurementEncoder.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "TSSCMeasurementEncoder.h"
+#include "Constants.h"
+#include <cstring>
+
+using namespace std;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+void Encode7BitUInt32(uint8_t* stream, uint32_t& position, uint32_t value);
+void Encode7BitUInt64(uint8_t* stream, uint32_t& position, uint64_t value);
+
+// Space that must remain in the buffer before a measurement is added, enough
+// for the largest possible encoding of a measurement and the end of stream
+static const uint32_t MinimumFreeSpace = 100U;
+
+TSSCMeasurementEncoder::PointMetadata::PointMetadata(uint16_t prevNextPointId1) :
+    CommandsSentSinceLastChange(0),
+    StartupMode(0),
+    Mode(4),
+    Mode21(0),
+    Mode31(0),
+    Mode301(0),
+    Mode41(TSSCCodeWords::Value1),
+    Mode401(TSSCCodeWords::Value2),
+    Mode4001(TSSCCodeWords::Value3),
+    PrevNextPointId1(prevNextPointId1),
+    PrevQuality1(0),
+    PrevQuality2(0),
+    PrevValue1(0),
+    PrevValue2(0),
+    PrevValue3(0)
+{
+    memset(CommandStats, 0, CommandStatsLength);
+}
+
+TSSCMeasurementEncoder::TSSCMeasurementEncoder() :
+    m_data(nullptr),
+    m_startPosition(0),
+    m_position(0),
+    m_lastPosition(0),
+    m_prevTimestamp1(0L),
+    m_prevTimestamp2(0L),
+    m_prevTimeDelta1(Int64::MaxValue),
+    m_prevTimeDelta2(Int64::MaxValue),
+    m_prevTimeDelta3(Int64::MaxValue),
+    m_prevTimeDelta4(Int64::MaxValue),
+    m_lastPoint(0),
+    m_bitStreamCount(0),
+    m_bitStreamCache(0),
+    m_bitStreamIndex(-1)
+{
+    m_points.emplace_back();
+}
+
+// Resets the encoder to the initial state.
+void TSSCMeasurementEncoder::Reset()
+{
+    m_data = nullptr;
+    m_startPosition = 0;
+    m_position = 0;
+    m_lastPosition = 0;
+    m_points.clear();
+    m_points.emplace_back();
+    m_lastPoint = 0;
+    m_bitStreamCount = 0;
+    m_bitStreamCache = 0;
+    m_bitStreamIndex = -1;
+    m_prevTimeDelta1 = Int64::MaxValue;
+    m_prevTimeDelta2 = Int64::MaxValue;
+    m_prevTimeDelta3 = Int64::MaxValue;
+    m_prevTimeDelta4 = Int64::MaxValue;
+    m_prevTimestamp1 = 0L;
+    m_prevTimestamp2 = 0L;
+}
+
+// Sets the buffer to write the next block of measurements to.
+void TSSCMeasurementEncoder::SetBuffer(uint8_t* data, uint32_t offset, uint32_t length)
+{
+    m_bitStreamCount = 0;
+    m_bitStreamCache = 0;
+    m_bitStreamIndex = -1;
+    m_data = data;
+    m_startPosition = offset;
+    m_position = offset;
+    m_lastPosition = offset + length;
+}
+
+// Adds a measurement to the current block.
+bool TSSCMeasurementEncoder::TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t quality, float32_t value)
+{
+    if (m_data == nullptr || m_lastPosition - m_position < MinimumFreeSpace)
+        return false;
+
+    const uint32_t index = id + 1U;
+
+    // Points are created in order of their IDs so that each point
+    // has the same initial state as when the parser creates it
+    for (uint32_t i = static_cast<uint32_t>(m_points.size()); i <= index; i++)
+        m_points.emplace_back(static_cast<uint16_t>(i));
+
+    // The most recently encoded point holds the coding algorithm for this
+    // measurement since the decoder cannot know the incoming point ID
+    if (m_points[m_lastPoint].PrevNextPointId1 != id)
+        WritePointIDChange(id);
+
+    if (m_prevTimestamp1 != timestamp)
+        WriteTimestampChange(timestamp);
+
+    PointMetadata& point = m_points[index];
+    PointMetadata& lastPoint = m_points[m_lastPoint];
+
+    if (point.PrevQuality1 != quality)
+        WriteQualityChange(quality, point);
+
+    uint32_t valueRaw;
+    memcpy(&valueRaw, &value, sizeof(float32_t));
+
+    if (point.PrevValue1 == valueRaw)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::Value1);
+    }
+    else if (point.PrevValue2 == valueRaw)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::Value2);
+        point.PrevValue2 = point.PrevValue1;
+        point.PrevValue1 = valueRaw;
+    }
+    else if (point.PrevValue3 == valueRaw)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::Value3);
+        point.PrevValue3 = point.PrevValue2;
+        point.PrevValue2 = point.PrevValue1;
+        point.PrevValue1 = valueRaw;
+    }
+    else if (valueRaw == 0)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::ValueZero);
+        point.PrevValue3 = point.PrevValue2;
+        point.PrevValue2 = point.PrevValue1;
+        point.PrevValue1 = 0;
+    }
+    else
+    {
+        const uint32_t bitsChanged = valueRaw ^ point.PrevValue1;
+
+        if (bitsChanged <= 0xF)
+        {
+            WriteCode(lastPoint, TSSCCodeWords::ValueXOR4);
+            WriteBits(bitsChanged & 0xF, 4);
+        }
+        else if (bitsChanged <= 0xFF)
+        {
+            WriteCode(lastPoint, TSSCCodeWords::ValueXOR8);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged);
+        }
+        else if (bitsChanged <= 0xFFF)
+        {
+            WriteCode(lastPoint, TSSCCodeWords::ValueXOR12);
+            WriteBits(bitsChanged & 0xF, 4);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 4);
+        }
+        else if (bitsChanged <= 0xFFFF)
+        {
+            WriteCode(lastPoint, TSSCCodeWords::ValueXOR16);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 8);
+        }
+        else if (bitsChanged <= 0xFFFFF)
+        {
+            WriteCode(lastPoint, TSSCCodeWords::ValueXOR20);
+            WriteBits(bitsChanged & 0xF, 4);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 4);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 12);
+        }
+        else if (bitsChanged <= 0xFFFFFF)
+        {
+            WriteCode(lastPoint, TSSCCodeWords::ValueXOR24);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 8);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 16);
+        }
+        else if (bitsChanged <= 0xFFFFFFF)
+        {
+            WriteCode(lastPoint, TSSCCodeWords::ValueXOR28);
+            WriteBits(bitsChanged & 0xF, 4);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 4);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 12);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 20);
+        }
+        else
+        {
+            WriteCode(lastPoint, TSSCCodeWords::ValueXOR32);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 8);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 16);
+            m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 24);
+        }
+
+        point.PrevValue3 = point.PrevValue2;
+        point.PrevValue2 = point.PrevValue1;
+        point.PrevValue1 = valueRaw;
+    }
+
+    m_lastPoint = index;
+
+    return true;
+}
+
+// Completes the current block, returning the number of bytes written to the buffer.
+uint32_t TSSCMeasurementEncoder::FinishBlock()
+{
+    BitStreamFlush();
+    return m_position - m_startPosition;
+}
+
+void TSSCMeasurementEncoder::WritePointIDChange(uint16_t id)
+{
+    PointMetadata& lastPoint = m_points[m_lastPoint];
+    const uint32_t bitsChanged = static_cast<uint32_t>(id ^ lastPoint.PrevNextPointId1);
+
+    if (bitsChanged <= 0xF)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::PointIDXOR4);
+        WriteBits(bitsChanged & 0xF, 4);
+    }
+    else if (bitsChanged <= 0xFF)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::PointIDXOR8);
+        m_data[m_position++] = static_cast<uint8_t>(bitsChanged);
+    }
+    else if (bitsChanged <= 0xFFF)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::PointIDXOR12);
+        WriteBits(bitsChanged & 0xF, 4);
+        m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 4);
+    }
+    else
+    {
+        WriteCode(lastPoint, TSSCCodeWords::PointIDXOR16);
+        m_data[m_position++] = static_cast<uint8_t>(bitsChanged);
+        m_data[m_position++] = static_cast<uint8_t>(bitsChanged >> 8);
+    }
+
+    lastPoint.PrevNextPointId1 = id;
+}
+
+void TSSCMeasurementEncoder::WriteTimestampChange(int64_t timestamp)
+{
+    PointMetadata& lastPoint = m_points[m_lastPoint];
+
+    if (m_prevTimestamp1 + m_prevTimeDelta1 == timestamp)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::TimeDelta1Forward);
+    }
+    else if (m_prevTimestamp1 + m_prevTimeDelta2 == timestamp)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::TimeDelta2Forward);
+    }
+    else if (m_prevTimestamp1 + m_prevTimeDelta3 == timestamp)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::TimeDelta3Forward);
+    }
+    else if (m_prevTimestamp1 + m_prevTimeDelta4 == timestamp)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::TimeDelta4Forward);
+    }
+    else if (m_prevTimestamp1 - m_prevTimeDelta1 == timestamp)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::TimeDelta1Reverse);
+    }
+    else if (m_prevTimestamp1 - m_prevTimeDelta2 == timestamp)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::TimeDelta2Reverse);
+    }
+    else if (m_prevTimestamp1 - m_prevTimeDelta3 == timestamp)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::TimeDelta3Reverse);
+    }
+    else if (m_prevTimestamp1 - m_prevTimeDelta4 == timestamp)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::TimeDelta4Reverse);
+    }
+    else if (m_prevTimestamp2 == timestamp)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::Timestamp2);
+    }
+    else
+    {
+        WriteCode(lastPoint, TSSCCodeWords::TimeXOR7Bit);
+        Encode7BitUInt64(m_data, m_position, static_cast<uint64_t>(timestamp ^ m_prevTimestamp1));
+    }
+
+    // Save the smallest delta time
+    const int64_t minDelta = abs(m_prevTimestamp1 - timestamp);
+
+    if (minDelta < m_prevTimeDelta4 && minDelta != m_prevTimeDelta1 && minDelta != m_prevTimeDelta2 && minDelta != m_prevTimeDelta3)
+    {
+        if (minDelta < m_prevTimeDelta1)
+        {
+            m_prevTimeDelta4 = m_prevTimeDelta3;
+            m_prevTimeDelta3 = m_prevTimeDelta2;
+            m_prevTimeDelta2 = m_prevTimeDelta1;
+            m_prevTimeDelta1 = minDelta;
+        }
+        else if (minDelta < m_prevTimeDelta2)
+        {
+            m_prevTimeDelta4 = m_prevTimeDelta3;
+            m_prevTimeDelta3 = m_prevTimeDelta2;
+            m_prevTimeDelta2 = minDelta;
+        }
+        else if (minDelta < m_prevTimeDelta3)
+        {
+            m_prevTimeDelta4 = m_prevTimeDelta3;
+            m_prevTimeDelta3 = minDelta;
+        }
+        else
+        {
+            m_prevTimeDelta4 = minDelta;
+        }
+    }
+
+    m_prevTimestamp2 = m_prevTimestamp1;
+    m_prevTimestamp1 = timestamp;
+}
+
+void TSSCMeasurementEncoder::WriteQualityChange(uint32_t quality, PointMetadata& point)
+{
+    PointMetadata& lastPoint = m_points[m_lastPoint];
+
+    if (point.PrevQuality2 == quality)
+    {
+        WriteCode(lastPoint, TSSCCodeWords::Quality2);
+    }
+    else
+    {
+        WriteCode(lastPoint, TSSCCodeWords::Quality7Bit32);
+        Encode7BitUInt32(m_data, m_position, quality);
+    }
+
+    point.PrevQuality2 = point.PrevQuality1;
+    point.PrevQuality1 = quality;
+}
+
+void TSSCMeasurementEncoder::WriteCode(PointMetadata& point, uint8_t code)
+{
+    switch (point.Mode)
+    {
+        case 1:
+            WriteBits(code, 5);
+            break;
+        case 2:
+            if (code == point.Mode21)
+                WriteBits(1, 1);
+            else
+                WriteBits(code, 6);
+            break;
+        case 3:
+            if (code == point.Mode31)
+                WriteBits(1, 1);
+            else if (code == point.Mode301)
+                WriteBits(1, 2);
+            else
+                WriteBits(code, 7);
+            break;
+        default:
+            if (code == point.Mode41)
+                WriteBits(1, 1);
+            else if (code == point.Mode401)
+                WriteBits(1, 2);
+            else if (code == point.Mode4001)
+                WriteBits(1, 3);
+            else
+                WriteBits(code, 8);
+            break;
+    }
+
+    UpdateCodeStatistics(point, code);
+}
+
+void TSSCMeasurementEncoder::UpdateCodeStatistics(PointMetadata& point, uint8_t code)
+{
+    point.CommandsSentSinceLastChange++;
+    point.CommandStats[code]++;
+
+    if (point.StartupMode == 0 && point.CommandsSentSinceLastChange > 5)
+    {
+        point.StartupMode++;
+        AdaptCommands(point);
+    }
+    else if (point.StartupMode == 1 && point.CommandsSentSinceLastChange > 20)
+    {
+        point.StartupMode++;
+        AdaptCommands(point);
+    }
+    else if (point.StartupMode == 2 && point.CommandsSentSinceLastChange > 100)
+    {
+        AdaptCommands(point);
+    }
+}
+
+void TSSCMeasurementEncoder::AdaptCommands(PointMetadata& point)
+{
+    uint8_t code1 = 0;
+    int32_t count1 = 0;
+
+    uint8_t code2 = 1;
+    int32_t count2 = 0;
+
+    uint8_t code3 = 2;
+    int32_t count3 = 0;
+
+    int32_t total = 0;
+
+    for (int32_t i = 0; i < CommandStatsLength; i++)
+    {
+        const int32_t count = point.CommandStats[i];
+        point.CommandStats[i] = 0;
+
+        total += count;
+
+        if (count > count3)
+        {
+            if (count > count1)
+            {
+                code3 = code2;
+                count3 = count2;
+
+                code2 = code1;
+                count2 = count1;
+
+                code1 = static_cast<uint8_t>(i);
+                count1 = count;
+            }
+            else if (count > count2)
+            {
+                code3 = code2;
+                count3 = count2;
+
+                code2 = static_cast<uint8_t>(i);
+                count2 = count;
+            }
+            else
+            {
+                code3 = static_cast<uint8_t>(i);
+                count3 = count;
+            }
+        }
+    }
+
+    const int32_t mode1Size = total * 5;
+    const int32_t mode2Size = count1 * 1 + (total - count1) * 6;
+    const int32_t mode3Size = count1 * 1 + count2 * 2 + (total - count1 - count2) * 7;
+    const int32_t mode4Size = count1 * 1 + count2 * 2 + count3 * 3 + (total - count1 - count2 - count3) * 8;
+
+    const int32_t minSize = min(min(mode1Size, mode2Size), min(mode3Size, mode4Size));
+
+    if (minSize == mode1Size)
+    {
+        point.Mode = 1;
+    }
+    else if (minSize == mode2Size)
+    {
+        point.Mode = 2;
+        point.Mode21 = code1;
+    }
+    else if (minSize == mode3Size)
+    {
+        point.Mode = 3;
+        point.Mode31 = code1;
+        point.Mode301 = code2;
+    }
+    else
+    {
+        point.Mode = 4;
+        point.Mode41 = code1;
+        point.Mode401 = code2;
+        point.Mode4001 = code3;
+    }
+
+    point.CommandsSentSinceLastChange = 0;
+}
+
+// Adds bits to the bitstream, which reserves a byte of the buffer
+// for its bits whenever the previously reserved byte is full.
+void TSSCMeasurementEncoder::WriteBits(uint32_t code, int32_t length)
+{
+    if (m_bitStreamIndex < 0)
+        m_bitStreamIndex = static_cast<int32_t>(m_position++);
+
+    m_bitStreamCache = (m_bitStreamCache << length) | code;
+    m_bitStreamCount += length;
+
+    if (m_bitStreamCount > 7)
+        BitStreamEnd();
+}
+
+void TSSCMeasurementEncoder::BitStreamEnd()
+{
+    while (m_bitStreamCount > 7)
+    {
+        m_data[m_bitStreamIndex] = static_cast<uint8_t>(m_bitStreamCache >> (m_bitStreamCount - 8));
+        m_bitStreamCount -= 8;
+
+        if (m_bitStreamCount > 0)
+            m_bitStreamIndex = static_cast<int32_t>(m_position++);
+        else
+            m_bitStreamIndex = -1;
+    }
+}
+
+// Writes any bits remaining in the bitstream, followed by an end of stream
+// code so the parser does not read the padding bits as another measurement.
+void TSSCMeasurementEncoder::BitStreamFlush()
+{
+    if (m_bitStreamCount == 0)
+        return;
+
+    if (m_bitStreamIndex < 0)
+        m_bitStreamIndex = static_cast<int32_t>(m_position++);
+
+    WriteCode(m_points[m_lastPoint], TSSCCodeWords::EndOfStream);
+
+    if (m_bitStreamCount > 7)
+        BitStreamEnd();
+
+    if (m_bitStreamCount > 0)
+    {
+        // Make up 8 bits by padding
+        m_bitStreamCache <<= 8 - m_bitStreamCount;
+        m_data[m_bitStreamIndex] = static_cast<uint8_t>(m_bitStreamCache);
+        m_bitStreamCache = 0;
+        m_bitStreamIndex = -1;
+        m_bitStreamCount = 0;
+    }
+}
+
+void Encode7BitUInt32(uint8_t* stream, uint32_t& position, uint32_t value)
+{
+    while (value >= 128U)
+    {
+        stream[position++] = static_cast<uint8_t>(value | 128U);
+        value >>= 7;
+    }
+
+    stream[position++] = static_cast<uint8_t>(value);
+}
+
+// The ninth byte of a 64-bit value holds all eight remaining bits.
+void Encode7BitUInt64(uint8_t* stream, uint32_t& position, uint64_t value)
+{
+    for (int32_t i = 0; i < 8; i++)
+    {
+        if (value < 128UL)
+        {
+            stream[position++] = static_cast<uint8_t>(value);
+            return;
+        }
+
+        stream[position++] = static_cast<uint8_t>(value | 128UL);
+        value >>= 7;
+    }
+
+    stream[position++] = static_cast<uint8_t>(value);
+}
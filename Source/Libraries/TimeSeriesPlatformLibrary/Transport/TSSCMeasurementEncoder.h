@@ -0,0 +1,128 @@
+//******************************************************************************************************
+//  TSSCMeasurementEncoder.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __TSSC_MEASUREMENT_ENCODER_H
+#define __TSSC_MEASUREMENT_ENCODER_H
+
+#include "TransportTypes.h"
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Encoder for the TSSC measurement format of the Gateway Exchange Protocol.
+    //
+    // This is the counterpart of the TSSCMeasurementParser: each point keeps the same code statistics
+    // and adapts its encoding mode at the same time as the parser does, so the state of both sides
+    // stays in step as long as every block that is encoded is also decoded, in order.
+    class TSSCMeasurementEncoder // NOLINT
+    {
+    private:
+        static const uint8_t CommandStatsLength = 32;
+
+        // The metadata kept for each point ID.
+        struct PointMetadata
+        {
+            uint8_t CommandStats[CommandStatsLength];
+            int32_t CommandsSentSinceLastChange;
+            int32_t StartupMode;
+
+            // Bit codes for the 4 modes of encoding, mode 1 means no prefix
+            uint8_t Mode;
+            uint8_t Mode21;
+            uint8_t Mode31;
+            uint8_t Mode301;
+            uint8_t Mode41;
+            uint8_t Mode401;
+            uint8_t Mode4001;
+
+            uint16_t PrevNextPointId1;
+
+            uint32_t PrevQuality1;
+            uint32_t PrevQuality2;
+            uint32_t PrevValue1;
+            uint32_t PrevValue2;
+            uint32_t PrevValue3;
+
+            PointMetadata(uint16_t prevNextPointId1 = 0);
+        };
+
+        uint8_t* m_data;
+        uint32_t m_startPosition;
+        uint32_t m_position;
+        uint32_t m_lastPosition;
+
+        int64_t m_prevTimestamp1;
+        int64_t m_prevTimestamp2;
+
+        int64_t m_prevTimeDelta1;
+        int64_t m_prevTimeDelta2;
+        int64_t m_prevTimeDelta3;
+        int64_t m_prevTimeDelta4;
+
+        // Index zero holds the state used before the first measurement,
+        // the state of point ID n is held at index n + 1
+        std::vector<PointMetadata> m_points;
+        uint32_t m_lastPoint;
+
+        // The number of bits in m_bitStreamCache that are valid. 0 Means the bitstream is empty.
+        int32_t m_bitStreamCount;
+
+        // A cache of bits that need to be flushed to m_data when full. Bits filled starting from the right moving left.
+        uint32_t m_bitStreamCache;
+
+        // Position of the byte the bitstream is currently filling, -1 when no byte has been reserved.
+        int32_t m_bitStreamIndex;
+
+        void WriteCode(PointMetadata& point, uint8_t code);
+        void UpdateCodeStatistics(PointMetadata& point, uint8_t code);
+        void AdaptCommands(PointMetadata& point);
+
+        void WritePointIDChange(uint16_t id);
+        void WriteTimestampChange(int64_t timestamp);
+        void WriteQualityChange(uint32_t quality, PointMetadata& point);
+
+        void WriteBits(uint32_t code, int32_t length);
+        void BitStreamEnd();
+        void BitStreamFlush();
+
+    public:
+        // Creates a new instance of the TSSC measurement encoder.
+        TSSCMeasurementEncoder();
+
+        // Resets the encoder to the initial state.
+        void Reset();
+
+        // Sets the buffer to write the next block of measurements to.
+        void SetBuffer(uint8_t* data, uint32_t offset, uint32_t length);
+
+        // Adds a measurement to the current block. Returns false, without adding the
+        // measurement, when the buffer does not have enough space left for it.
+        bool TryAddMeasurement(uint16_t id, int64_t timestamp, uint32_t quality, float32_t value);
+
+        // Completes the current block, returning the number of bytes written to the buffer.
+        uint32_t FinishBlock();
+    };
+}}}
+
+#endif
@@ -0,0 +1,194 @@
+//******************************************************************************************************
+//  TSSCPartitionDecoder.cpp - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#include "TSSCPartitionDecoder.h"
+
+using namespace std;
+using namespace boost::asio;
+using namespace GSF;
+using namespace GSF::TimeSeries;
+using namespace GSF::TimeSeries::Transport;
+
+TSSCPartitionDecoder::Partition::Partition() :
+    Data(nullptr),
+    Offset(0),
+    Length(0)
+{
+}
+
+TSSCPartitionDecoder::TSSCPartitionDecoder(const SubscriberExecutorPtr& executor) :
+    m_partitions(1),
+    m_nextPartition(0),
+    m_generation(0),
+    m_executor(executor),
+    m_work(make_work_guard(m_ioContext))
+{
+}
+
+TSSCPartitionDecoder::~TSSCPartitionDecoder()
+{
+    // Tasks left from earlier calls to Decode find no partition to take, but still refer to the decoder
+    m_pendingTasks.WaitForCompletion();
+    m_work.reset();
+    m_ioContext.stop();
+
+    for (const SharedPtr<Thread>& thread : m_threads)
+        thread->join();
+}
+
+// Takes the next partition no thread has started, if any, for the given call to Decode.
+bool TSSCPartitionDecoder::TryTakePartition(const uint32_t generation, uint32_t& partition)
+{
+    uint64_t next = m_nextPartition.load();
+
+    do
+    {
+        if (static_cast<uint32_t>(next >> 32) != generation || static_cast<uint32_t>(next) >= m_partitions.size())
+            return false;
+    }
+    while (!m_nextPartition.compare_exchange_weak(next, next + 1));
+
+    partition = static_cast<uint32_t>(next);
+    return true;
+}
+
+// Decodes partitions until every partition of the given call to Decode has been taken.
+void TSSCPartitionDecoder::DecodePartitions(const uint32_t generation)
+{
+    uint32_t partition;
+
+    while (TryTakePartition(generation, partition))
+    {
+        DecodePartition(m_partitions[partition]);
+        m_pendingPartitions.End();
+    }
+}
+
+// Decodes the stream of the partition into its measurement arrays.
+void TSSCPartitionDecoder::DecodePartition(Partition& partition)
+{
+    partition.IDs.clear();
+    partition.Timestamps.clear();
+    partition.Qualities.clear();
+    partition.Values.clear();
+    partition.ErrorMessage.clear();
+
+    if (partition.Data == nullptr)
+        return;
+
+    try
+    {
+        const bool decoded = partition.Decoder.Decode(partition.Data, partition.Offset, partition.Length, [&partition](uint16_t id, int64_t timestamp, uint32_t quality, float32_t value)
+        {
+            partition.IDs.push_back(id);
+            partition.Timestamps.push_back(timestamp);
+            partition.Qualities.push_back(quality);
+            partition.Values.push_back(value);
+        });
+
+        if (!decoded)
+            partition.ErrorMessage = partition.Decoder.GetErrorMessage();
+    }
+    catch (const exception& ex)
+    {
+        partition.ErrorMessage = ex.what();
+    }
+
+    partition.Data = nullptr;
+}
+
+uint32_t TSSCPartitionDecoder::GetPartitionCount() const
+{
+    return static_cast<uint32_t>(m_partitions.size());
+}
+
+// Sets the number of partitions, resetting every partition.
+void TSSCPartitionDecoder::SetPartitionCount(const uint32_t partitionCount)
+{
+    // Tasks left from earlier calls to Decode read the partitions, so wait for them before the partitions
+    // are replaced, and start a new generation so that no task of an earlier call takes a new partition
+    m_pendingTasks.WaitForCompletion();
+    m_nextPartition = static_cast<uint64_t>(++m_generation) << 32;
+
+    m_partitions.clear();
+    m_partitions.resize(max(partitionCount, 1U));
+
+    // Executor threads decode the partitions when there is an executor
+    if (m_executor != nullptr)
+        return;
+
+    // Calling thread decodes partitions too, so one less worker is needed
+    const uint32_t threadCount = min(static_cast<uint32_t>(m_partitions.size()), max(Thread::hardware_concurrency(), 1U)) - 1;
+
+    while (m_threads.size() < threadCount)
+        m_threads.push_back(NewSharedPtr<Thread>([this] { m_ioContext.run(); }));
+}
+
+// Resets the decoder state of the given partition.
+void TSSCPartitionDecoder::ResetPartition(const uint32_t partition)
+{
+    m_partitions[partition].Decoder.Reset();
+}
+
+// Sets the stream of the partition to decode with the next call to Decode.
+void TSSCPartitionDecoder::SetPartitionData(const uint32_t partition, const uint8_t* data, const uint32_t offset, const uint32_t length)
+{
+    Partition& target = m_partitions[partition];
+
+    target.Data = data;
+    target.Offset = offset;
+    target.Length = length;
+}
+
+// Decodes the streams of all partitions.
+void TSSCPartitionDecoder::Decode()
+{
+    if (m_partitions.size() == 1 || (m_executor == nullptr && m_threads.empty()))
+    {
+        for (Partition& partition : m_partitions)
+            DecodePartition(partition);
+
+        return;
+    }
+
+    IOContext& ioContext = m_executor != nullptr ? m_executor->GetIOContext() : m_ioContext;
+    const uint32_t generation = ++m_generation;
+
+    m_nextPartition = static_cast<uint64_t>(generation) << 32;
+
+    for (size_t i = 0; i < m_partitions.size(); i++)
+        m_pendingPartitions.Begin();
+
+    for (size_t i = 1; i < m_partitions.size(); i++)
+        post(ioContext, m_pendingTasks.Track([this, generation] { DecodePartitions(generation); }));
+
+    // Only partitions other threads have already started are waited on
+    DecodePartitions(generation);
+    m_pendingPartitions.WaitForCompletion();
+}
+
+// Gets the description of the error that caused decoding of the given partition to fail.
+const string& TSSCPartitionDecoder::GetErrorMessage(const uint32_t partition) const
+{
+    return m_partitions[partition].ErrorMessage;
+}
@@ -0,0 +1,137 @@
+//******************************************************************************************************
+//  TSSCPartitionDecoder.h - Gbtc
+//
+//  Copyright  2026, Grid Protection Alliance.  All Rights Reserved.
+//
+//  Licensed to the Grid Protection Alliance (GPA) under one or more contributor license agreements. See
+//  the NOTICE file distributed with this work for additional information regarding copyright ownership.
+//  The GPA licenses this file to you under the MIT License (MIT), the "License"; you may not use this
+//  file except in compliance with the License. You may obtain a copy of the License at:
+//
+//      http://opensource.org/licenses/MIT
+//
+//  Unless agreed to in writing, the subject software distributed under the License is distributed on an
+//  "AS-IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied. Refer to the
+//  License for the specific language governing permissions and limitations.
+//
+//  Code Modification History:
+//  ----------------------------------------------------------------------------------------------------
+//  10/15/2026 - GSF Development Team
+//       Generated original version of source code.
+//
+//******************************************************************************************************
+
+#ifndef __TSSC_PARTITION_DECODER_H
+#define __TSSC_PARTITION_DECODER_H
+
+#include "TSSCDecoder.h"
+#include "SubscriberExecutor.h"
+#include <atomic>
+
+namespace GSF {
+namespace TimeSeries {
+namespace Transport
+{
+    // Decodes the partitions of partitioned TSSC data packets in parallel.
+    //
+    // With partitioned TSSC, the publisher splits the subscribed signals into independent TSSC
+    // streams, each with its own sequence number and decoder state, so the streams of a packet
+    // can be decoded at the same time. Each partition is decoded into its own arrays, which are
+    // then read back in partition order so the merged measurements do not depend on timing.
+    //
+    // Partitions are decoded on the I/O threads of the subscriber executor when one is given,
+    // otherwise on worker threads of the decoder. The thread that calls Decode takes any partition
+    // no other thread has started, so it never waits on partitions still queued behind other work.
+    class TSSCPartitionDecoder // NOLINT
+    {
+    private:
+        typedef boost::asio::executor_work_guard<IOContext::executor_type> WorkGuard;
+
+        // Decoder state and the decoded measurements of a partition.
+        struct Partition
+        {
+            TSSCDecoder Decoder;
+
+            // Stream to decode, no data skips the partition
+            const uint8_t* Data;
+            uint32_t Offset;
+            uint32_t Length;
+
+            std::vector<uint16_t> IDs;
+            std::vector<int64_t> Timestamps;
+            std::vector<uint32_t> Qualities;
+            std::vector<float32_t> Values;
+
+            std::string ErrorMessage;
+
+            Partition();
+        };
+
+        std::vector<Partition> m_partitions;
+
+        // Generation of the current call to Decode in the upper half and the
+        // index of the next partition to take in the lower half
+        std::atomic<uint64_t> m_nextPartition;
+        uint32_t m_generation;
+
+        SubscriberExecutorPtr m_executor;
+        IOContext m_ioContext;
+        WorkGuard m_work;
+        std::vector<SharedPtr<Thread>> m_threads;
+        AsyncOperationTracker m_pendingTasks;
+        AsyncOperationTracker m_pendingPartitions;
+
+        bool TryTakePartition(uint32_t generation, uint32_t& partition);
+        void DecodePartitions(uint32_t generation);
+        static void DecodePartition(Partition& partition);
+
+    public:
+        // Creates a new instance of the TSSC partition decoder that decodes partitions on the
+        // I/O threads of the given executor, or on its own worker threads without one.
+        TSSCPartitionDecoder(const SubscriberExecutorPtr& executor = nullptr);
+
+        // Waits for queued decode tasks and stops the worker threads of the decoder.
+        ~TSSCPartitionDecoder();
+
+        // Gets the number of partitions.
+        uint32_t GetPartitionCount() const;
+
+        // Sets the number of partitions, resetting every partition. Without an executor, worker threads
+        // are started as needed so that, with the calling thread, there is up to one thread per partition.
+        void SetPartitionCount(uint32_t partitionCount);
+
+        // Resets the decoder state of the given partition.
+        void ResetPartition(uint32_t partition);
+
+        // Sets the stream of the partition to decode with the next call to Decode, the length is the
+        // position within the data at which the stream ends. A null data pointer skips the partition.
+        void SetPartitionData(uint32_t partition, const uint8_t* data, uint32_t offset, uint32_t length);
+
+        // Decodes the streams of all partitions, returning once every partition has been decoded.
+        void Decode();
+
+        // Gets the description of the error that caused decoding of the given partition to fail,
+        // empty when the partition was decoded successfully.
+        const std::string& GetErrorMessage(uint32_t partition) const;
+
+        // Passes every decoded measurement, in partition order, to the handler in
+        // the form handler(id, timestamp, quality, value).
+        template<class Handler>
+        void ForEachMeasurement(Handler handler) const;
+    };
+
+    // Passes every decoded measurement to the handler.
+    template<class Handler>
+    void TSSCPartitionDecoder::ForEachMeasurement(Handler handler) const
+    {
+        for (const Partition& partition : m_partitions)
+        {
+            const size_t count = partition.IDs.size();
+
+            for (size_t i = 0; i < count; i++)
+                handler(partition.IDs[i], partition.Timestamps[i], partition.Qualities[i], partition.Values[i]);
+        }
+    }
+}}}
+
+#endif
@@ -18,6 +18,8 @@
 //  ----------------------------------------------------------------------------------------------------
 //  03/09/2012 - Stephen C. Wills
 //       Generated original version of source code.
+//  10/15/2026 - GSF Development Team
+//       Added PublicationRecord for publishing measurements by publication handle.
 //
 //******************************************************************************************************
 
@@ -105,6 +107,24 @@ namespace TimeSeries
 
     typedef SharedPtr<Measurement> MeasurementPtr;
 
+    // Compact measurement record used to publish values of signals that were
+    // registered with a DataPublisher ahead of time. Value is published as is,
+    // i.e., it is expected to already include any adder and multiplier.
+    struct PublicationRecord
+    {
+        // Handle returned by DataPublisher::RegisterPublication.
+        uint32_t Handle;
+
+        // Flags indicating the state of the measurement.
+        uint32_t Flags;
+
+        // The time, in ticks, that the measurement was taken.
+        int64_t Timestamp;
+
+        // Value of the measurement.
+        float64_t Value;
+    };
+
     enum SignalKind : int16_t
     {
         Angle,			// Phase angle